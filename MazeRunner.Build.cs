@@ -1,5 +1,6 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
+using System.Linq;
 using UnrealBuildTool;
 
 public class MazeRunner : ModuleRules
@@ -15,6 +16,7 @@ public class MazeRunner : ModuleRules
 			"InputCore",
 			"UMG",           // For UI widgets
 			"AIModule",      // For AI pathfinding
+			"NavigationSystem", // Grid navigation data (AMazeNavigationData)
 			"Niagara"        // For weather particle effects
 		});
 
@@ -22,5 +24,26 @@ public class MazeRunner : ModuleRules
 			"Slate",         // UI framework
 			"SlateCore"      // UI core
 		});
+
+		// Shared animation budget for the monster meshes, only when the project enables the plugin.
+		// Without it the meshes are plain skeletal meshes on the engine's update rate optimizations.
+		bool bWithAnimationBudget = IsPluginEnabled(Target, "AnimationBudgetAllocator");
+		if (bWithAnimationBudget)
+		{
+			PrivateDependencyModuleNames.Add("AnimationBudgetAllocator");
+		}
+		PrivateDefinitions.Add("MAZE_WITH_ANIMATION_BUDGET=" + (bWithAnimationBudget ? "1" : "0"));
+	}
+
+	// Looks the plugin up in the .uproject the target builds, false without a project
+	private static bool IsPluginEnabled(ReadOnlyTargetRules Target, string PluginName)
+	{
+		if (Target.ProjectFile == null)
+		{
+			return false;
+		}
+
+		ProjectDescriptor Project = ProjectDescriptor.FromFile(Target.ProjectFile);
+		return Project.Plugins != null && Project.Plugins.Any(Plugin => Plugin.Name == PluginName && Plugin.bEnabled);
 	}
 }
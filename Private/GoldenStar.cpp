@@ -152,14 +152,45 @@ void AGoldenStar::RevealPathToExit()
     // 3. Solve Path
     if (PlayerCell && ExitCell)
     {
-        TArray<AMazeCell*> Path = MazeManager->FindPathBFS(PlayerCell, ExitCell);
-        
-        UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] Path found with %d cells"), Path.Num());
+        // With traps or mud on the map the guide takes the cheapest path around them, not the shortest one
+        if (MazeManager->HasTerrain(EMazeTerrain::Trap | EMazeTerrain::Mud))
+        {
+            TArray<AMazeCell*> Path = MazeManager->FindPathWeighted(PlayerCell, ExitCell, FMazeCostProfile::PlayerGuide());
+            
+            UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] Terrain-weighted path found with %d cells"), Path.Num());
+            
+            MazeManager->HighlightPath(Path);
+            return;
+        }
         
-        // 4. Highlight
-        MazeManager->HighlightPath(Path);
+        // A still-valid exit distance field answers right away with no search
+        if (MazeManager->HasExitDistanceField())
+        {
+            TArray<AMazeCell*> Path = MazeManager->FindPathToExit(PlayerCell);
+            
+            UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] Path found with %d cells"), Path.Num());
+            
+            // 4. Highlight
+            MazeManager->HighlightPath(Path);
+            
+            UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] ✓ Path highlighted successfully!"));
+            return;
+        }
         
-        UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] ✓ Path highlighted successfully!"));
+        // Otherwise queue it ahead of the monsters instead of searching inside the overlap event.
+        // The star is gone a second later, so the manager does the highlighting.
+        TWeakObjectPtr<AMazeManager> WeakManager(MazeManager);
+        MazeManager->RequestPath(this, PlayerCell, ExitCell, EMazePathPriority::High,
+            [WeakManager](const TArray<AMazeCell*>& Path)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] Path found with %d cells"), Path.Num());
+                
+                if (WeakManager.IsValid())
+                {
+                    WeakManager->HighlightPath(Path);
+                    UE_LOG(LogTemp, Warning, TEXT("[GoldenStar] ✓ Path highlighted successfully!"));
+                }
+            });
     }
     else
     {
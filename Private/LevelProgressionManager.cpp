@@ -23,18 +23,22 @@ void ALevelProgressionManager::BeginPlay()
 
 void ALevelProgressionManager::InitializeLevelConfigs()
 {
-    LevelConfigs.Empty();
-    
-    CreateLevel1Config();
-    CreateLevel2Config();
-    CreateLevel3Config();
-    CreateLevel4Config();
-    CreateLevel5Config();
+    BuildDefaultLevelConfigs(LevelConfigs);
     
     UE_LOG(LogTemp, Warning, TEXT("[LevelProgressionManager] ✓ All 5 levels configured"));
 }
 
-void ALevelProgressionManager::CreateLevel1Config()
+void ALevelProgressionManager::BuildDefaultLevelConfigs(TArray<FLevelConfig>& OutConfigs)
+{
+    OutConfigs.Reset();
+    OutConfigs.Add(CreateLevel1Config());
+    OutConfigs.Add(CreateLevel2Config());
+    OutConfigs.Add(CreateLevel3Config());
+    OutConfigs.Add(CreateLevel4Config());
+    OutConfigs.Add(CreateLevel5Config());
+}
+
+FLevelConfig ALevelProgressionManager::CreateLevel1Config()
 {
     FLevelConfig Level1;
     Level1.LevelNumber = 1;
@@ -84,10 +88,10 @@ void ALevelProgressionManager::CreateLevel1Config()
     
     Level1.NewHazards.Add(TEXT("No hazards - just learn the basics!"));
     
-    LevelConfigs.Add(Level1);
+    return Level1;
 }
 
-void ALevelProgressionManager::CreateLevel2Config()
+FLevelConfig ALevelProgressionManager::CreateLevel2Config()
 {
     FLevelConfig Level2;
     Level2.LevelNumber = 2;
@@ -139,10 +143,10 @@ void ALevelProgressionManager::CreateLevel2Config()
     Level2.NewHazards.Add(TEXT("Monster AI (spawns after 90s)"));
     Level2.NewHazards.Add(TEXT("Muddy Patches (3 total)"));
     
-    LevelConfigs.Add(Level2);
+    return Level2;
 }
 
-void ALevelProgressionManager::CreateLevel3Config()
+FLevelConfig ALevelProgressionManager::CreateLevel3Config()
 {
     FLevelConfig Level3;
     Level3.LevelNumber = 3;
@@ -196,10 +200,10 @@ void ALevelProgressionManager::CreateLevel3Config()
     Level3.NewHazards.Add(TEXT("Maze Regeneration at 2:00 (find purple safe zone!)"));
     Level3.NewHazards.Add(TEXT("Faster Monster (spawns at 1:00)"));
     
-    LevelConfigs.Add(Level3);
+    return Level3;
 }
 
-void ALevelProgressionManager::CreateLevel4Config()
+FLevelConfig ALevelProgressionManager::CreateLevel4Config()
 {
     FLevelConfig Level4;
     Level4.LevelNumber = 4;
@@ -255,10 +259,10 @@ void ALevelProgressionManager::CreateLevel4Config()
     Level4.NewHazards.Add(TEXT("Very aggressive monster (30s spawn)"));
     Level4.NewHazards.Add(TEXT("Earlier maze regeneration (1:30)"));
     
-    LevelConfigs.Add(Level4);
+    return Level4;
 }
 
-void ALevelProgressionManager::CreateLevel5Config()
+FLevelConfig ALevelProgressionManager::CreateLevel5Config()
 {
     FLevelConfig Level5;
     Level5.LevelNumber = 5;
@@ -317,7 +321,7 @@ void ALevelProgressionManager::CreateLevel5Config()
     Level5.NewHazards.Add(TEXT("AGGRESSIVE MODE AT 1:00"));
     Level5.NewHazards.Add(TEXT("NO GOLDEN STAR - PURE SURVIVAL"));
     
-    LevelConfigs.Add(Level5);
+    return Level5;
 }
 
 FLevelConfig ALevelProgressionManager::GetLevelConfig(int32 LevelNumber) const
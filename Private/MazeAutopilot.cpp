@@ -0,0 +1,371 @@
+// MazeAutopilot.cpp
+#include "MazeAutopilot.h"
+#include "MazeGameMode.h"
+#include "MazeManager.h"
+#include "MazeCell.h"
+#include "MazeDialSearch.h"
+#include "MonsterAI.h"
+#include "GoldenStar.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "UObject/UObjectArray.h"
+
+namespace
+{
+    // Nearest-rank percentile of sorted samples
+    float Percentile(const TArray<float>& Sorted, float Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0f;
+        }
+        const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+}
+
+AMazeAutopilot::AMazeAutopilot()
+    : GameMode(nullptr)
+    , LastPlayerCell(nullptr)
+    , PathIndex(0)
+    , ReplanTimer(0.0f)
+    , StuckTimer(0.0f)
+    , RunIndex(0)
+    , RunLevel(1)
+    , RunSeed(0)
+    , bRunActive(false)
+    , bLevelPlaying(false)
+    , StateTimer(0.0f)
+    , PlayStartSeconds(0.0)
+    , LastFrameSeconds(0.0)
+{
+    PrimaryActorTick.bCanEverTick = true;
+}
+
+bool AMazeAutopilot::IsRequested()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("autopilot"));
+}
+
+void AMazeAutopilot::Configure(AMazeGameMode* InGameMode)
+{
+    GameMode = InGameMode;
+
+    const TCHAR* CommandLine = FCommandLine::Get();
+    FParse::Value(CommandLine, TEXT("seed="), Seed);
+    FParse::Value(CommandLine, TEXT("autopilotruns="), MaxRuns);
+
+    int32 OnlyLevel = 0;
+    if (FParse::Value(CommandLine, TEXT("autopilotlevel="), OnlyLevel))
+    {
+        FirstLevel = LastLevel = FMath::Clamp(OnlyLevel, 1, 5);
+    }
+    LastLevel = FMath::Max(FirstLevel, LastLevel);
+
+    SessionDirectory = FPaths::ProjectSavedDir() / TEXT("Autopilot") / FDateTime::Now().ToString();
+    IFileManager::Get().MakeDirectory(*SessionDirectory, true);
+
+    // Start right away
+    bRunActive = false;
+    StateTimer = RestartDelay;
+
+    UE_LOG(LogTemp, Warning, TEXT("[Autopilot] Levels %d-%d, seed %d, %d runs -> %s"),
+           FirstLevel, LastLevel, Seed, MaxRuns, *SessionDirectory);
+}
+
+void AMazeAutopilot::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!GameMode)
+    {
+        return;
+    }
+
+    const double NowSeconds = FPlatformTime::Seconds();
+    const float FrameMs = LastFrameSeconds > 0.0 ? static_cast<float>((NowSeconds - LastFrameSeconds) * 1000.0) : 0.0f;
+    LastFrameSeconds = NowSeconds;
+    StateTimer += DeltaTime;
+
+    if (!bRunActive)
+    {
+        if (StateTimer >= RestartDelay)
+        {
+            StartRun();
+        }
+        return;
+    }
+
+    const EGameState State = GameMode->CurrentGameState;
+    if (!bLevelPlaying)
+    {
+        if (State == EGameState::Playing)
+        {
+            bLevelPlaying = true;
+            PlayStartSeconds = NowSeconds;
+            StuckTimer = 0.0f;
+            LastPlayerCell = nullptr;
+            Path.Reset();
+        }
+        else if (StateTimer > StartTimeout)
+        {
+            FinishRun(TEXT("softlock-start"));
+        }
+        return;
+    }
+
+    switch (State)
+    {
+    case EGameState::Playing:
+        FrameMilliseconds.Add(FrameMs);
+        Steer(DeltaTime);
+        break;
+
+    case EGameState::Won:
+        FinishRun(TEXT("won"));
+        break;
+
+    case EGameState::Lost:
+        FinishRun(GameMode->RemainingTime <= 0.0f ? TEXT("timeout") : TEXT("caught"));
+        break;
+
+    default:
+        // Paused or back at the menu: nothing the autopilot did, so the flow itself is stuck
+        FinishRun(TEXT("softlock-state"));
+        break;
+    }
+}
+
+void AMazeAutopilot::StartRun()
+{
+    const int32 NumLevels = LastLevel - FirstLevel + 1;
+    RunLevel = FirstLevel + RunIndex % NumLevels;
+    RunSeed = Seed + RunIndex;
+
+    // Maze, spawns and hazards all draw from the global stream
+    FMath::RandInit(RunSeed);
+    FMath::SRandInit(RunSeed);
+
+    bRunActive = true;
+    bLevelPlaying = false;
+    StateTimer = 0.0f;
+    FrameMilliseconds.Reset();
+
+    UE_LOG(LogTemp, Warning, TEXT("[Autopilot] Run %d: level %d, seed %d"), RunIndex, RunLevel, RunSeed);
+    GameMode->StartLevel(RunLevel);
+}
+
+void AMazeAutopilot::FinishRun(const TCHAR* Outcome)
+{
+    const float LevelSeconds = bLevelPlaying ? static_cast<float>(FPlatformTime::Seconds() - PlayStartSeconds) : 0.0f;
+
+    if (GameMode->CurrentGameState == EGameState::Playing)
+    {
+        GameMode->PlayerLost(TEXT("Autopilot soft-lock"));
+    }
+
+    AppendRunRow(Outcome, LevelSeconds);
+    UE_LOG(LogTemp, Warning, TEXT("[Autopilot] Run %d: level %d seed %d %s after %.1f s"), RunIndex, RunLevel, RunSeed, Outcome, LevelSeconds);
+
+    bRunActive = false;
+    bLevelPlaying = false;
+    StateTimer = 0.0f;
+    Path.Reset();
+    RunIndex++;
+
+    if (MaxRuns > 0 && RunIndex >= MaxRuns)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[Autopilot] %d runs done, quitting"), RunIndex);
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+// ==================== STEERING ====================
+
+void AMazeAutopilot::Steer(float DeltaTime)
+{
+    ACharacter* Pawn = Cast<ACharacter>(GameMode->Player);
+    AMazeManager* MazeManager = GameMode->MazeManager;
+    if (!Pawn || !MazeManager)
+    {
+        return;
+    }
+
+    const FVector Location = Pawn->GetActorLocation();
+    AMazeCell* PlayerCell = MazeManager->GetCellAtLocation(Location);
+    if (!PlayerCell)
+    {
+        return;
+    }
+
+    if (PlayerCell != LastPlayerCell)
+    {
+        LastPlayerCell = PlayerCell;
+        StuckTimer = 0.0f;
+        ReplanTimer = 0.0f;
+    }
+    else
+    {
+        StuckTimer += DeltaTime;
+        if (StuckTimer > StuckTimeout)
+        {
+            FinishRun(TEXT("softlock-stuck"));
+            return;
+        }
+    }
+
+    ReplanTimer -= DeltaTime;
+    if (ReplanTimer <= 0.0f || !Path.IsValidIndex(PathIndex))
+    {
+        Replan(PlayerCell);
+        ReplanTimer = ReplanInterval;
+    }
+
+    while (Path.IsValidIndex(PathIndex) && Path[PathIndex] &&
+           FVector::Dist2D(Location, Path[PathIndex]->GetActorLocation()) < WaypointRadius)
+    {
+        PathIndex++;
+    }
+    if (!Path.IsValidIndex(PathIndex) || !Path[PathIndex])
+    {
+        return;
+    }
+
+    const FVector Direction = (Path[PathIndex]->GetActorLocation() - Location).GetSafeNormal2D();
+    Pawn->AddMovementInput(Direction, 1.0f);
+
+    // Look where we go, so the camera and flashlight render what a player would see
+    if (AController* Controller = Pawn->GetController())
+    {
+        Controller->SetControlRotation(Direction.Rotation());
+    }
+}
+
+void AMazeAutopilot::Replan(AMazeCell* PlayerCell)
+{
+    AMazeManager* MazeManager = GameMode->MazeManager;
+    Path.Reset();
+    PathIndex = 0;
+
+    // The star first while it is up, it shows the way; then the exit
+    AMazeCell* Goal = MazeManager->GetEscapeCell();
+    if (IsValid(GameMode->SpawnedStar) && !GameMode->SpawnedStar->IsHidden())
+    {
+        Goal = MazeManager->GetCellAtLocation(GameMode->SpawnedStar->GetActorLocation());
+    }
+    if (!Goal)
+    {
+        return;
+    }
+
+    Path = MazeManager->FindPathWeighted(PlayerCell, Goal, FMazeCostProfile::PlayerGuide());
+    PathIndex = Path.Num() > 1 ? 1 : 0;
+
+    // Nearest monster by walking distance
+    const TArray<int32>& FromPlayer = MazeManager->GetPlayerDistanceField(PlayerCell);
+    AMazeCell* ThreatCell = nullptr;
+    int32 ThreatDistance = MAX_int32;
+    for (AMonsterAI* Monster : GameMode->SpawnedMonsters)
+    {
+        if (!IsValid(Monster))
+        {
+            continue;
+        }
+
+        AMazeCell* MonsterCell = MazeManager->GetCellAtLocation(Monster->GetActorLocation());
+        const int32 MonsterIndex = MazeManager->GetCellIndex(MonsterCell);
+        if (FromPlayer.IsValidIndex(MonsterIndex) && FromPlayer[MonsterIndex] >= 0 && FromPlayer[MonsterIndex] < ThreatDistance)
+        {
+            ThreatDistance = FromPlayer[MonsterIndex];
+            ThreatCell = MonsterCell;
+        }
+    }
+
+    if (!ThreatCell || ThreatDistance > FleeCells || !Path.IsValidIndex(PathIndex))
+    {
+        return;
+    }
+
+    // Keep the plan unless its next step closes in on the monster
+    MazeManager->ComputeDistanceField(ThreatCell, MonsterDistances);
+    const int32 PlayerIndex = MazeManager->GetCellIndex(PlayerCell);
+    const int32 NextIndex = MazeManager->GetCellIndex(Path[PathIndex]);
+    if (!MonsterDistances.IsValidIndex(PlayerIndex) || !MonsterDistances.IsValidIndex(NextIndex) ||
+        MonsterDistances[NextIndex] > MonsterDistances[PlayerIndex])
+    {
+        return;
+    }
+
+    if (AMazeCell* FleeCell = FindFleeCell(PlayerCell, ThreatCell))
+    {
+        Path.Reset();
+        Path.Add(FleeCell);
+        PathIndex = 0;
+    }
+}
+
+AMazeCell* AMazeAutopilot::FindFleeCell(AMazeCell* PlayerCell, AMazeCell* MonsterCell)
+{
+    AMazeManager* MazeManager = GameMode->MazeManager;
+    const FMazeGrid& Grid = MazeManager->NavGrid;
+    const int32 PlayerIndex = MazeManager->GetCellIndex(PlayerCell);
+    if (PlayerIndex < 0 || PlayerIndex >= Grid.Num() || MonsterDistances.Num() != Grid.Num())
+    {
+        return nullptr;
+    }
+
+    int32 BestIndex = INDEX_NONE;
+    int32 BestDistance = MonsterDistances[PlayerIndex];
+    for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(PlayerIndex))
+    {
+        if (MonsterDistances[Neighbor.Index] > BestDistance)
+        {
+            BestDistance = MonsterDistances[Neighbor.Index];
+            BestIndex = Neighbor.Index;
+        }
+    }
+    return BestIndex != INDEX_NONE ? MazeManager->GetCell(Grid.GetRow(BestIndex), Grid.GetCol(BestIndex)) : nullptr;
+}
+
+// ==================== REPORT ====================
+
+void AMazeAutopilot::AppendRunRow(const TCHAR* Outcome, float LevelSeconds)
+{
+    TArray<float> Sorted = FrameMilliseconds;
+    Sorted.Sort();
+
+    double TotalMs = 0.0;
+    int32 Hitches = 0;
+    for (const float Ms : Sorted)
+    {
+        TotalMs += Ms;
+        Hitches += Ms > HitchMilliseconds;
+    }
+
+    const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+    const FString CsvPath = SessionDirectory / FString::Printf(TEXT("Level%d.csv"), RunLevel);
+
+    FString Csv;
+    if (!IFileManager::Get().FileExists(*CsvPath))
+    {
+        Csv = TEXT("run,seed,level,outcome,level_s,frames,mean_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches,used_physical_mb,live_uobjects\n");
+    }
+    Csv += FString::Printf(TEXT("%d,%d,%d,%s,%.2f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.1f,%d\n"),
+                           RunIndex, RunSeed, RunLevel, Outcome, LevelSeconds, Sorted.Num(),
+                           Sorted.Num() > 0 ? TotalMs / Sorted.Num() : 0.0,
+                           Percentile(Sorted, 0.50f), Percentile(Sorted, 0.95f), Percentile(Sorted, 0.99f),
+                           Sorted.Num() > 0 ? Sorted.Last() : 0.0f, Hitches,
+                           Memory.UsedPhysical / (1024.0 * 1024.0), GUObjectArray.GetObjectArrayNumMinusAvailable());
+
+    if (!FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[Autopilot] Could not write %s"), *CsvPath);
+    }
+}
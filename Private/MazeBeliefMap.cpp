@@ -0,0 +1,209 @@
+// MazeBeliefMap.cpp
+#include "MazeBeliefMap.h"
+#include "MazeGrid.h"
+
+namespace MazeBeliefConstants
+{
+    // Floats per VectorRegister4Float
+    const int32 Lanes = 4;
+
+    // Probabilities below this are flushed to zero. The tail of a spreading belief would otherwise
+    // decay into denormals, which are an order of magnitude slower on most CPUs.
+    const float MinProbability = 1.e-20f;
+}
+
+FMazeBeliefMap::FMazeBeliefMap()
+    : Rows(0)
+    , Cols(0)
+    , Stride(0)
+    , WallVersion(0)
+{
+}
+
+void FMazeBeliefMap::SyncWalls(const FMazeGrid& Grid)
+{
+    using namespace MazeBeliefConstants;
+
+    const bool bResized = Grid.Rows != Rows || Grid.Cols != Cols;
+    if (!bResized && Grid.WallVersion == WallVersion)
+    {
+        return;
+    }
+
+    if (bResized)
+    {
+        Rows = Grid.Rows;
+        Cols = Grid.Cols;
+        Stride = Align(Cols + 2, Lanes);
+
+        // Init, not SetNumZeroed: the stride changed, old values would land in padding and other cells
+        const int32 PlaneSize = (Rows + 2) * Stride;
+        Belief.Init(0.0f, PlaneSize);
+        Scratch.Init(0.0f, PlaneSize);
+        OpenNorth.Init(0.0f, PlaneSize);
+        OpenEast.Init(0.0f, PlaneSize);
+        OpenSouth.Init(0.0f, PlaneSize);
+        OpenWest.Init(0.0f, PlaneSize);
+    }
+    WallVersion = Grid.WallVersion;
+
+    // Bit N = wall towards EMazeDirection N (North, East, South, West); the padding keeps weight 0
+    for (int32 Index = 0; Index < Grid.Num(); Index++)
+    {
+        const uint8 Walls = Grid.WallMasks[Index];
+        const int32 Padded = ToPadded(Index);
+        OpenNorth[Padded] = (Walls & (1 << 0)) ? 0.0f : 1.0f;
+        OpenEast[Padded] = (Walls & (1 << 1)) ? 0.0f : 1.0f;
+        OpenSouth[Padded] = (Walls & (1 << 2)) ? 0.0f : 1.0f;
+        OpenWest[Padded] = (Walls & (1 << 3)) ? 0.0f : 1.0f;
+    }
+
+    if (bResized)
+    {
+        SpreadUniform();
+    }
+}
+
+void FMazeBeliefMap::CollapseTo(int32 CellIndex)
+{
+    if (CellIndex < 0 || CellIndex >= Rows * Cols)
+    {
+        return;
+    }
+
+    FMemory::Memzero(Belief.GetData(), Belief.Num() * sizeof(float));
+    Belief[ToPadded(CellIndex)] = 1.0f;
+}
+
+void FMazeBeliefMap::SpreadUniform()
+{
+    const int32 NumCells = Rows * Cols;
+    if (NumCells == 0)
+    {
+        return;
+    }
+
+    const float Share = 1.0f / NumCells;
+    for (int32 Row = 0; Row < Rows; Row++)
+    {
+        float* RowData = Belief.GetData() + (Row + 1) * Stride + 1;
+        for (int32 Col = 0; Col < Cols; Col++)
+        {
+            RowData[Col] = Share;
+        }
+    }
+}
+
+void FMazeBeliefMap::ClearCells(TArrayView<const int32> CellIndices)
+{
+    const int32 NumCells = Rows * Cols;
+    for (const int32 CellIndex : CellIndices)
+    {
+        if (CellIndex >= 0 && CellIndex < NumCells)
+        {
+            Belief[ToPadded(CellIndex)] = 0.0f;
+        }
+    }
+}
+
+void FMazeBeliefMap::Diffuse(int32 Steps, float Rate)
+{
+    using namespace MazeBeliefConstants;
+
+    if (Rows == 0 || Steps <= 0)
+    {
+        return;
+    }
+
+    // P' = P + Rate * sum over open passages (P[neighbor] - P). The sweep covers the padded rows
+    // 1..Rows whole: padding cells have zero weights and zero belief, so they stay zero.
+    const VectorRegister4Float RateVec = VectorSetFloat1(FMath::Clamp(Rate, 0.0f, MaxDiffusionRate));
+    const VectorRegister4Float FloorVec = VectorSetFloat1(MinProbability);
+    const float* North = OpenNorth.GetData();
+    const float* East = OpenEast.GetData();
+    const float* South = OpenSouth.GetData();
+    const float* West = OpenWest.GetData();
+    const int32 First = Stride;
+    const int32 Last = (Rows + 1) * Stride;
+
+    for (int32 Step = 0; Step < Steps; Step++)
+    {
+        const float* P = Belief.GetData();
+        float* Out = Scratch.GetData();
+
+        for (int32 i = First; i < Last; i += Lanes)
+        {
+            const VectorRegister4Float Center = VectorLoad(P + i);
+
+            VectorRegister4Float Flow = VectorMultiply(VectorLoad(North + i), VectorSubtract(VectorLoad(P + i - Stride), Center));
+            Flow = VectorMultiplyAdd(VectorLoad(East + i), VectorSubtract(VectorLoad(P + i + 1), Center), Flow);
+            Flow = VectorMultiplyAdd(VectorLoad(South + i), VectorSubtract(VectorLoad(P + i + Stride), Center), Flow);
+            Flow = VectorMultiplyAdd(VectorLoad(West + i), VectorSubtract(VectorLoad(P + i - 1), Center), Flow);
+
+            const VectorRegister4Float Result = VectorMultiplyAdd(RateVec, Flow, Center);
+            VectorStore(VectorBitwiseAnd(Result, VectorCompareGE(Result, FloorVec)), Out + i);
+        }
+
+        Swap(Belief, Scratch);
+    }
+}
+
+float FMazeBeliefMap::Normalize()
+{
+    using namespace MazeBeliefConstants;
+
+    if (Rows == 0)
+    {
+        return 0.0f;
+    }
+
+    const int32 First = Stride;
+    const int32 Last = (Rows + 1) * Stride;
+    float* P = Belief.GetData();
+
+    VectorRegister4Float SumVec = VectorZeroFloat();
+    for (int32 i = First; i < Last; i += Lanes)
+    {
+        SumVec = VectorAdd(SumVec, VectorLoad(P + i));
+    }
+    alignas(16) float Lane[Lanes];
+    VectorStoreAligned(SumVec, Lane);
+    const float Total = Lane[0] + Lane[1] + Lane[2] + Lane[3];
+
+    if (Total <= UE_SMALL_NUMBER)
+    {
+        SpreadUniform();
+        return Total;
+    }
+
+    const VectorRegister4Float Scale = VectorSetFloat1(1.0f / Total);
+    for (int32 i = First; i < Last; i += Lanes)
+    {
+        VectorStore(VectorMultiply(VectorLoad(P + i), Scale), P + i);
+    }
+    return Total;
+}
+
+float FMazeBeliefMap::GetProbability(int32 CellIndex) const
+{
+    return CellIndex >= 0 && CellIndex < Rows * Cols ? Belief[ToPadded(CellIndex)] : 0.0f;
+}
+
+int32 FMazeBeliefMap::FindMostLikelyCell() const
+{
+    int32 Best = INDEX_NONE;
+    float BestProbability = 0.0f;
+    for (int32 Row = 0; Row < Rows; Row++)
+    {
+        const float* RowData = Belief.GetData() + (Row + 1) * Stride + 1;
+        for (int32 Col = 0; Col < Cols; Col++)
+        {
+            if (RowData[Col] > BestProbability)
+            {
+                BestProbability = RowData[Col];
+                Best = Row * Cols + Col;
+            }
+        }
+    }
+    return Best;
+}
@@ -0,0 +1,483 @@
+// MazeBitboard.cpp
+#include "MazeBitboard.h"
+#include "MazeGrid.h"
+
+namespace MazeBitboardConstants
+{
+    // EMazeDirection values
+    const int32 East = 1;
+    const int32 South = 2;
+
+    // Smallest row span (in rows) a frontier needs before whole-row sweeps are considered
+    const int32 DenseMinRows = 3;
+
+    // A cell visit of the shared walk (a 64-bit word, a bit loop for the planes) against one of a
+    // single-source field, and the share of the 2 * Radius + 1 possible layers the waves of a
+    // cluster actually reach a cell on; both measured on 15x15 to 256x256 mazes
+    const int32 SharedVisitCostPercent = 150;
+    const int32 SharedLayersPercent = 60;
+
+    uint16 ToPlaneDistance(int32 Distance)
+    {
+        return Distance < 0 ? FMazeDistancePlanes::Unreachable
+            : static_cast<uint16>(FMath::Min(Distance, static_cast<int32>(FMazeDistancePlanes::MaxDistance)));
+    }
+}
+
+FMazeBitboard::FMazeBitboard()
+    : Rows(0)
+    , Cols(0)
+    , WordsPerRow(0)
+    , Stride(0)
+    , StrideShift(0)
+    , SourceWallVersion(0)
+    , LastLayers(0)
+    , LastDenseLayers(0)
+    , LastSharedBatches(0)
+{
+}
+
+void FMazeBitboard::Build(const FMazeGrid& Grid)
+{
+    using namespace MazeBitboardConstants;
+
+    Rows = Grid.Rows;
+    Cols = Grid.Cols;
+    WordsPerRow = (Cols + 63) / 64;
+    StrideShift = FMath::CeilLogTwo(WordsPerRow + 2);
+    Stride = 1 << StrideShift;
+
+    const int32 TotalWords = (Rows + 4) * Stride;
+    EastOpen.Reset();
+    EastOpen.SetNumZeroed(TotalWords);
+    SouthOpen.Reset();
+    SouthOpen.SetNumZeroed(TotalWords);
+    Previous.Reset();
+    Previous.SetNumZeroed(TotalWords);
+    FrontierBits.Reset();
+    FrontierBits.SetNumZeroed(TotalWords);
+    NextBits.Reset();
+    NextBits.SetNumZeroed(TotalWords);
+
+    OpenMasks.Reset();
+    OpenMasks.SetNumUninitialized(Grid.Num());
+    ProbeDistances.Init(-1, Grid.Num());
+
+    for (int32 Row = 0; Row < Rows; Row++)
+    {
+        for (int32 Col = 0; Col < Cols; Col++)
+        {
+            const int32 Index = Grid.ToIndex(Row, Col);
+            OpenMasks[Index] = Grid.GetOpenMask(Index);
+
+            const int32 Word = RowOffset(Row) + (Col >> 6);
+            const uint64 Bit = 1ull << (Col & 63);
+
+            if (Grid.IsOpen(Index, East))
+            {
+                EastOpen[Word] |= Bit;
+            }
+            if (Grid.IsOpen(Index, South))
+            {
+                SouthOpen[Word] |= Bit;
+            }
+        }
+    }
+
+    SourceWallVersion = Grid.WallVersion;
+}
+
+uint64 FMazeBitboard::ExpandWord(int32 Offset, const uint64* Frontier, uint64* Next) const
+{
+    const uint64* F = Frontier + Offset;
+    const uint64* E = EastOpen.GetData() + Offset;
+    const uint64* S = SouthOpen.GetData() + Offset;
+
+    const uint64 FromWest = ((F[0] & E[0]) << 1) | ((F[-1] & E[-1]) >> 63);
+    const uint64 FromEast = ((F[0] >> 1) | (F[1] << 63)) & E[0];
+    const uint64 FromNorth = F[-Stride] & S[-Stride];
+    const uint64 FromSouth = F[Stride] & S[0];
+
+    // Neighbours of layer L are in layers L - 1, L or L + 1, so masking the last two layers is enough
+    const uint64 Reached = (FromWest | FromEast | FromNorth | FromSouth) & ~(F[0] | Previous[Offset]);
+    Next[Offset] = Reached;
+    return Reached;
+}
+
+bool FMazeBitboard::ExpandRow(int32 Row, const uint64* Frontier, uint64* Next) const
+{
+    const int32 Offset = RowOffset(Row);
+    uint64 Any = 0;
+    for (int32 W = 0; W < WordsPerRow; W++)
+    {
+        Any |= ExpandWord(Offset + W, Frontier, Next);
+    }
+
+    return Any != 0;
+}
+
+void FMazeBitboard::SetCellBits(uint64* Words, const TArray<FFrontierCell>& Cells, bool bSet) const
+{
+    for (const FFrontierCell& Cell : Cells)
+    {
+        const int32 Col = Cell.Index - Cell.Row * Cols;
+        uint64& Word = Words[RowOffset(Cell.Row) + (Col >> 6)];
+        if (bSet)
+        {
+            Word |= 1ull << (Col & 63);
+        }
+        else
+        {
+            Word = 0;
+        }
+    }
+}
+
+int32 FMazeBitboard::ComputeDistanceField(int32 SourceIndex, TArray<int32>& OutDistances, int32 StopIndex)
+{
+    using namespace MazeBitboardConstants;
+
+    const int32 NumCells = Rows * Cols;
+    OutDistances.Init(-1, NumCells);
+    LastLayers = 0;
+    LastDenseLayers = 0;
+
+    if (SourceIndex < 0 || SourceIndex >= NumCells)
+    {
+        return 0;
+    }
+
+    int32* Distances = OutDistances.GetData();
+    const uint8* Open = OpenMasks.GetData();
+    const int32 NeighborOffset[4] = { -Cols, 1, Cols, -1 };
+
+    Distances[SourceIndex] = 0;
+    int32 Reached = 1;
+    bool bStop = (SourceIndex == StopIndex);
+
+    PreviousCells.Reset();
+    CurrentCells.Reset();
+    CurrentCells.Add({ SourceIndex, SourceIndex / Cols });
+
+    for (int32 Layer = 1; !bStop && CurrentCells.Num() > 0; Layer++)
+    {
+        NextCells.Reset();
+
+        // A maze frontier is usually a handful of cells, expanding them one by one is cheapest.
+        // Once it covers at least one cell per word of its row span, sweep whole rows instead.
+        bool bDense = false;
+        int32 MinRow = Rows;
+        int32 MaxRow = -1;
+        if (CurrentCells.Num() >= DenseMinRows * WordsPerRow)
+        {
+            for (const FFrontierCell& Cell : CurrentCells)
+            {
+                MinRow = FMath::Min(MinRow, Cell.Row);
+                MaxRow = FMath::Max(MaxRow, Cell.Row);
+            }
+            bDense = CurrentCells.Num() >= (MaxRow - MinRow + 3) * WordsPerRow;
+        }
+
+        if (bDense)
+        {
+            uint64* Frontier = FrontierBits.GetData();
+            uint64* Next = NextBits.GetData();
+            SetCellBits(Frontier, CurrentCells, true);
+            SetCellBits(Previous.GetData(), PreviousCells, true);
+
+            const int32 FirstRow = FMath::Max(MinRow - 1, 0);
+            const int32 LastRow = FMath::Min(MaxRow + 1, Rows - 1);
+            for (int32 Row = FirstRow; Row <= LastRow; Row++)
+            {
+                if (!ExpandRow(Row, Frontier, Next))
+                {
+                    continue;
+                }
+
+                const int32 Offset = RowOffset(Row);
+                for (int32 W = 0; W < WordsPerRow; W++)
+                {
+                    uint64 Bits = Next[Offset + W];
+                    Next[Offset + W] = 0;
+
+                    while (Bits)
+                    {
+                        const int32 Index = Row * Cols + W * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+                        Distances[Index] = Layer;
+                        NextCells.Add({ Index, Row });
+                        bStop |= (Index == StopIndex);
+                        Bits &= Bits - 1;
+                    }
+                }
+            }
+
+            SetCellBits(Frontier, CurrentCells, false);
+            SetCellBits(Previous.GetData(), PreviousCells, false);
+            LastDenseLayers++;
+        }
+        else
+        {
+            for (const FFrontierCell& Cell : CurrentCells)
+            {
+                uint32 OpenDirs = Open[Cell.Index];
+                while (OpenDirs)
+                {
+                    const int32 Dir = static_cast<int32>(FMath::CountTrailingZeros(OpenDirs));
+                    OpenDirs &= OpenDirs - 1;
+
+                    const int32 Neighbor = Cell.Index + NeighborOffset[Dir];
+                    if (Distances[Neighbor] < 0)
+                    {
+                        Distances[Neighbor] = Layer;
+                        NextCells.Add({ Neighbor, Cell.Row + FMazeGrid::RowDelta[Dir] });
+                        bStop |= (Neighbor == StopIndex);
+                    }
+                }
+            }
+        }
+
+        Reached += NextCells.Num();
+
+        // Rotate Previous <- Current <- Next
+        Swap(PreviousCells, CurrentCells);
+        Swap(CurrentCells, NextCells);
+        LastLayers = Layer;
+    }
+
+    return Reached;
+}
+
+int32 FMazeBitboard::GetPathDistance(int32 FromIndex, int32 ToIndex)
+{
+    const int32 NumCells = Rows * Cols;
+    if (ToIndex < 0 || ToIndex >= NumCells)
+    {
+        return -1;
+    }
+
+    ComputeDistanceField(FromIndex, DistanceScratch, ToIndex);
+    return DistanceScratch[ToIndex];
+}
+
+void FMazeBitboard::ComputeDistancePlanes(TArrayView<const int32> Sources, FMazeDistancePlanes& OutPlanes)
+{
+    const int32 NumCells = Rows * Cols;
+    OutPlanes.NumCells = NumCells;
+    OutPlanes.Sources = TArray<int32>(Sources.GetData(), Sources.Num());
+    OutPlanes.Data.Init(FMazeDistancePlanes::Unreachable, Sources.Num() * NumCells);
+    LastLayers = 0;
+    LastSharedBatches = 0;
+
+    if (NumCells == 0)
+    {
+        return;
+    }
+
+    SeenSources.SetNumZeroed(NumCells);
+    VisitSources.SetNumZeroed(NumCells);
+    VisitNextSources.SetNumZeroed(NumCells);
+
+    for (int32 First = 0; First < Sources.Num(); First += 64)
+    {
+        const int32 Count = FMath::Min(64, Sources.Num() - First);
+        const TArrayView<const int32> Batch = Sources.Slice(First, Count);
+        if (ShouldShareWalk(Batch))
+        {
+            RunMultiSourceBatch(Batch, First, OutPlanes);
+            LastSharedBatches++;
+        }
+        else
+        {
+            RunSingleFieldBatch(Batch, First, OutPlanes);
+        }
+    }
+}
+
+bool FMazeBitboard::ShouldShareWalk(TArrayView<const int32> Sources)
+{
+    using namespace MazeBitboardConstants;
+
+    const int32 NumCells = Rows * Cols;
+    if (Sources.Num() < 2)
+    {
+        return false;
+    }
+    if (Sources[0] < 0 || Sources[0] >= NumCells)
+    {
+        return true;
+    }
+
+    // With every source within Radius of the first, d(Source, Cell) takes at most 2 * Radius + 1
+    // values per cell, which bounds the visits of each cell in the shared walk; single fields
+    // visit each cell once per source. Largest radius at which sharing still wins:
+    const int64 MaxLayers = static_cast<int64>(Sources.Num()) * 100 * 100 / (SharedLayersPercent * SharedVisitCostPercent);
+    const int32 MaxRadius = static_cast<int32>((MaxLayers - 1) / 2);
+    if (MaxRadius < 0)
+    {
+        return false;
+    }
+
+    // Walking distance is never shorter than the Manhattan distance: far-flung batches are turned
+    // down without a search
+    const int32 FirstRow = Sources[0] / Cols;
+    const int32 FirstCol = Sources[0] % Cols;
+    for (int32 Source : Sources)
+    {
+        if (Source >= 0 && Source < NumCells &&
+            FMath::Abs(Source / Cols - FirstRow) + FMath::Abs(Source % Cols - FirstCol) > MaxRadius)
+        {
+            return false;
+        }
+    }
+
+    // BFS from the first source cut off at MaxRadius: it only touches the cluster's neighbourhood,
+    // not the whole maze. ProbeDistances is all -1 between calls, only the touched cells are reset.
+    const uint8* Open = OpenMasks.GetData();
+    const int32 NeighborOffset[4] = { -Cols, 1, Cols, -1 };
+    ProbeCells.Reset();
+    ProbeCells.Add(Sources[0]);
+    ProbeDistances[Sources[0]] = 0;
+    for (int32 Head = 0; Head < ProbeCells.Num(); Head++)
+    {
+        const int32 Cell = ProbeCells[Head];
+        if (ProbeDistances[Cell] >= MaxRadius)
+        {
+            continue;
+        }
+
+        uint32 OpenDirs = Open[Cell];
+        while (OpenDirs)
+        {
+            const int32 Dir = static_cast<int32>(FMath::CountTrailingZeros(OpenDirs));
+            OpenDirs &= OpenDirs - 1;
+
+            const int32 Neighbor = Cell + NeighborOffset[Dir];
+            if (ProbeDistances[Neighbor] < 0)
+            {
+                ProbeDistances[Neighbor] = ProbeDistances[Cell] + 1;
+                ProbeCells.Add(Neighbor);
+            }
+        }
+    }
+
+    // A source the cut-off search missed is too far away (or in another component)
+    bool bShare = true;
+    for (int32 Source : Sources)
+    {
+        if (Source >= 0 && Source < NumCells && ProbeDistances[Source] < 0)
+        {
+            bShare = false;
+            break;
+        }
+    }
+
+    for (int32 Cell : ProbeCells)
+    {
+        ProbeDistances[Cell] = -1;
+    }
+    return bShare;
+}
+
+void FMazeBitboard::RunSingleFieldBatch(TArrayView<const int32> Sources, int32 FirstPlane, FMazeDistancePlanes& OutPlanes)
+{
+    using namespace MazeBitboardConstants;
+
+    const int32 NumCells = Rows * Cols;
+    uint16* Planes = OutPlanes.Data.GetData() + FirstPlane * NumCells;
+
+    for (int32 Slot = 0; Slot < Sources.Num(); Slot++)
+    {
+        if (Sources[Slot] < 0 || Sources[Slot] >= NumCells)
+        {
+            continue;
+        }
+
+        ComputeDistanceField(Sources[Slot], DistanceScratch);
+        uint16* Plane = Planes + Slot * NumCells;
+        for (int32 Cell = 0; Cell < NumCells; Cell++)
+        {
+            Plane[Cell] = ToPlaneDistance(DistanceScratch[Cell]);
+        }
+    }
+}
+
+void FMazeBitboard::RunMultiSourceBatch(TArrayView<const int32> Sources, int32 FirstPlane, FMazeDistancePlanes& OutPlanes)
+{
+    const int32 NumCells = Rows * Cols;
+    const uint8* Open = OpenMasks.GetData();
+    const int32 NeighborOffset[4] = { -Cols, 1, Cols, -1 };
+
+    uint64* Seen = SeenSources.GetData();
+    uint64* Visit = VisitSources.GetData();
+    uint64* VisitNext = VisitNextSources.GetData();
+    uint16* Planes = OutPlanes.Data.GetData() + FirstPlane * NumCells;
+
+    FMemory::Memzero(Seen, NumCells * sizeof(uint64));
+    ActiveCells.Reset();
+
+    for (int32 Slot = 0; Slot < Sources.Num(); Slot++)
+    {
+        const int32 Source = Sources[Slot];
+        if (Source < 0 || Source >= NumCells)
+        {
+            continue;
+        }
+
+        const uint64 Bit = 1ull << Slot;
+        if (!Visit[Source])
+        {
+            ActiveCells.Add(Source);
+        }
+        Visit[Source] |= Bit;
+        Seen[Source] |= Bit;
+        Planes[Slot * NumCells + Source] = 0;
+    }
+
+    for (int32 Layer = 1; ActiveCells.Num() > 0; Layer++)
+    {
+        const uint16 Distance = static_cast<uint16>(FMath::Min(Layer, static_cast<int32>(FMazeDistancePlanes::MaxDistance)));
+        NextActiveCells.Reset();
+
+        for (int32 Cell : ActiveCells)
+        {
+            const uint64 Frontier = Visit[Cell];
+            uint32 OpenDirs = Open[Cell];
+            while (OpenDirs)
+            {
+                const int32 Dir = static_cast<int32>(FMath::CountTrailingZeros(OpenDirs));
+                OpenDirs &= OpenDirs - 1;
+
+                // Every source whose frontier is here and has not seen the neighbor yet
+                const int32 Neighbor = Cell + NeighborOffset[Dir];
+                uint64 NewSources = Frontier & ~Seen[Neighbor];
+                if (!NewSources)
+                {
+                    continue;
+                }
+
+                if (!VisitNext[Neighbor])
+                {
+                    NextActiveCells.Add(Neighbor);
+                }
+                VisitNext[Neighbor] |= NewSources;
+                Seen[Neighbor] |= NewSources;
+
+                while (NewSources)
+                {
+                    const int32 Slot = static_cast<int32>(FMath::CountTrailingZeros64(NewSources));
+                    Planes[Slot * NumCells + Neighbor] = Distance;
+                    NewSources &= NewSources - 1;
+                }
+            }
+        }
+
+        for (int32 Cell : ActiveCells)
+        {
+            Visit[Cell] = 0;
+        }
+
+        Swap(Visit, VisitNext);
+        Swap(ActiveCells, NextActiveCells);
+        LastLayers = Layer;
+    }
+}
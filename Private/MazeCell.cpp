@@ -1,5 +1,6 @@
 // MazeCell.cpp
 #include "MazeCell.h"
+#include "MazeManager.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/StaticMesh.h"
@@ -199,6 +200,7 @@ void AMazeCell::RemoveWall(EMazeDirection Direction)
         Wall->SetVisibility(false);
         Wall->SetCollisionEnabled(ECollisionEnabled::NoCollision);
         bWallsActive[static_cast<int32>(Direction)] = false;
+        NotifyWallsChanged();
     }
 }
 
@@ -343,6 +345,12 @@ void AMazeCell::ShowAllWalls()
         WallWest->SetHiddenInGame(false);
     }
     
+    for (int32 i = 0; i < 4; i++)
+    {
+        bWallsActive[i] = true;
+    }
+    NotifyWallsChanged();
+    
     UE_LOG(LogTemp, Warning, TEXT("[MazeCell] All walls shown and collision enabled for cell (%d, %d)"), Row, Col);
 }
 
@@ -373,5 +381,20 @@ void AMazeCell::HideAllWalls()
         WallWest->SetHiddenInGame(true);
     }
     
+    for (int32 i = 0; i < 4; i++)
+    {
+        bWallsActive[i] = false;
+    }
+    NotifyWallsChanged();
+    
     UE_LOG(LogTemp, Warning, TEXT("[MazeCell] All walls hidden and collision disabled for cell (%d, %d)"), Row, Col);
 }
+
+void AMazeCell::NotifyWallsChanged()
+{
+    // Keep the manager's packed nav grid in sync (cells are spawned with the manager as owner)
+    if (AMazeManager* Manager = Cast<AMazeManager>(GetOwner()))
+    {
+        Manager->NotifyCellWallsChanged(this);
+    }
+}
@@ -0,0 +1,128 @@
+// MazeChokepoints.cpp
+#include "MazeChokepoints.h"
+#include "MazeGrid.h"
+
+FMazeChokepoints::FMazeChokepoints()
+    : ExitIndex(INDEX_NONE)
+    , WallVersion(0)
+    , NumArticulationPoints(0)
+    , NumBridges(0)
+{
+}
+
+bool FMazeChokepoints::IsUpToDate(const FMazeGrid& Grid, int32 InExitIndex) const
+{
+    return ExitIndex != INDEX_NONE && ExitIndex == InExitIndex && WallVersion == Grid.WallVersion && Flags.Num() == Grid.Num();
+}
+
+void FMazeChokepoints::Build(const FMazeGrid& Grid, int32 InExitIndex)
+{
+    const int32 NumCells = Grid.Num();
+    ExitIndex = INDEX_NONE;
+    WallVersion = Grid.WallVersion;
+    NumArticulationPoints = 0;
+    NumBridges = 0;
+
+    Flags.Init(0, NumCells);
+    NextChoke.Init(INDEX_NONE, NumCells);
+    LastChoke.Init(INDEX_NONE, NumCells);
+    ChokeCount.Init(0, NumCells);
+
+    if (InExitIndex < 0 || InExitIndex >= NumCells)
+    {
+        return;
+    }
+    ExitIndex = InExitIndex;
+
+    Discovery.Init(-1, NumCells);
+    Low.SetNumUninitialized(NumCells);
+    Parent.Init(INDEX_NONE, NumCells);
+    PreOrder.Reset(NumCells);
+    Stack.Reset();
+
+    // Iterative DFS (a recursive one would overflow on long corridors): each frame resumes with the
+    // passages it has not tried yet
+    int32 Time = 0;
+    int32 RootChildren = 0;
+    Discovery[ExitIndex] = Low[ExitIndex] = Time++;
+    PreOrder.Add(ExitIndex);
+    Stack.Add(FFrame{ ExitIndex, static_cast<uint32>(~Grid.WallMasks[ExitIndex] & FMazeGrid::AllWalls) });
+
+    while (Stack.Num() > 0)
+    {
+        FFrame& Top = Stack.Last();
+        const int32 Cell = Top.Cell;
+
+        if (Top.OpenMask != 0)
+        {
+            const int32 Dir = static_cast<int32>(FMath::CountTrailingZeros(Top.OpenMask));
+            Top.OpenMask &= Top.OpenMask - 1;
+            const int32 Next = Cell + Grid.IndexDelta[Grid.GetRowParity(Cell)][Dir];
+
+            if (Discovery[Next] < 0)
+            {
+                Parent[Next] = Cell;
+                Discovery[Next] = Low[Next] = Time++;
+                PreOrder.Add(Next);
+                Stack.Add(FFrame{ Next, static_cast<uint32>(~Grid.WallMasks[Next] & FMazeGrid::AllWalls) });
+            }
+            else if (Next != Parent[Cell])
+            {
+                // Back edge (grids have no parallel passages, so skipping the parent is enough)
+                Low[Cell] = FMath::Min(Low[Cell], Discovery[Next]);
+            }
+            continue;
+        }
+
+        Stack.Pop();
+        const int32 Up = Parent[Cell];
+        if (Up == INDEX_NONE)
+        {
+            continue;
+        }
+
+        Low[Up] = FMath::Min(Low[Up], Low[Cell]);
+        if (Low[Cell] > Discovery[Up])
+        {
+            Flags[Cell] |= static_cast<uint8>(EMazeChokepoint::Bridge);
+            NumBridges++;
+        }
+
+        if (Up == ExitIndex)
+        {
+            RootChildren++;
+        }
+        else if (Low[Cell] >= Discovery[Up] && !(Flags[Up] & static_cast<uint8>(EMazeChokepoint::Articulation)))
+        {
+            Flags[Up] |= static_cast<uint8>(EMazeChokepoint::Articulation);
+            NumArticulationPoints++;
+        }
+    }
+
+    if (RootChildren > 1)
+    {
+        Flags[ExitIndex] |= static_cast<uint8>(EMazeChokepoint::Articulation);
+        NumArticulationPoints++;
+    }
+
+    // Parents come before their children in discovery order, so one pass fills the route tables.
+    // Up is forced on Cell's way out when nothing below Cell reaches above Up; the rest are Up's own.
+    for (int32 Order = 1; Order < PreOrder.Num(); Order++)
+    {
+        const int32 Cell = PreOrder[Order];
+        const int32 Up = Parent[Cell];
+
+        if (Up != ExitIndex && Low[Cell] >= Discovery[Up])
+        {
+            NextChoke[Cell] = Up;
+            LastChoke[Cell] = LastChoke[Up] != INDEX_NONE ? LastChoke[Up] : Up;
+            ChokeCount[Cell] = ChokeCount[Up] + 1;
+        }
+        else
+        {
+            NextChoke[Cell] = NextChoke[Up];
+            LastChoke[Cell] = LastChoke[Up];
+            ChokeCount[Cell] = ChokeCount[Up];
+        }
+    }
+}
@@ -0,0 +1,272 @@
+// MazeCooperativePathfinder.cpp
+#include "MazeCooperativePathfinder.h"
+#include "MazeGrid.h"
+#include "Algo/Reverse.h"
+
+// ==================== RESERVATION TABLE ====================
+
+FMazeReservationTable::FMazeReservationTable()
+    : NumTableCells(0)
+    , Window(0)
+    , RingMask(0)
+{
+}
+
+void FMazeReservationTable::Init(int32 NumCells, int32 WindowSteps)
+{
+    NumTableCells = FMath::Max(NumCells, 0);
+    Window = FMath::Max(WindowSteps, 1);
+
+    // One slot more than the window, rounded to a power of two so the slot is a mask
+    RingMask = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Window + 1))) - 1;
+
+    Slots.Reset();
+    Slots.SetNum(NumTableCells * (RingMask + 1));
+    for (TPair<int32, TArray<FIntPoint>>& Agent : AgentSlots)
+    {
+        Agent.Value.Reset();
+    }
+}
+
+void FMazeReservationTable::RegisterAgent(int32 AgentId)
+{
+    AgentSlots.FindOrAdd(AgentId);
+}
+
+void FMazeReservationTable::UnregisterAgent(int32 AgentId)
+{
+    Release(AgentId);
+    AgentSlots.Remove(AgentId);
+}
+
+void FMazeReservationTable::Reserve(int32 AgentId, int32 Cell, int32 Step)
+{
+    if (Cell < 0 || Cell >= NumTableCells)
+    {
+        return;
+    }
+
+    FSlot& Slot = Slots[Cell * (RingMask + 1) + (Step & RingMask)];
+    if (Slot.Step == Step && Slot.Agent != INDEX_NONE && Slot.Agent != AgentId)
+    {
+        return;
+    }
+
+    Slot.Step = Step;
+    Slot.Agent = AgentId;
+    AgentSlots.FindOrAdd(AgentId).Add(FIntPoint(Cell, Step));
+}
+
+void FMazeReservationTable::Release(int32 AgentId)
+{
+    TArray<FIntPoint>* Reserved = AgentSlots.Find(AgentId);
+    if (!Reserved)
+    {
+        return;
+    }
+
+    for (const FIntPoint& CellStep : *Reserved)
+    {
+        // Stale slots may have been taken over by someone else since
+        FSlot& Slot = Slots[CellStep.X * (RingMask + 1) + (CellStep.Y & RingMask)];
+        if (Slot.Step == CellStep.Y && Slot.Agent == AgentId)
+        {
+            Slot = FSlot();
+        }
+    }
+    Reserved->Reset();
+}
+
+int32 FMazeReservationTable::GetOwner(int32 Cell, int32 Step) const
+{
+    if (Cell < 0 || Cell >= NumTableCells)
+    {
+        return INDEX_NONE;
+    }
+
+    const FSlot& Slot = Slots[Cell * (RingMask + 1) + (Step & RingMask)];
+    return Slot.Step == Step ? Slot.Agent : INDEX_NONE;
+}
+
+bool FMazeReservationTable::IsClaimedByOther(int32 Cell, int32 AgentId, int32 FromStep, int32 ToStep) const
+{
+    if (Cell < 0 || Cell >= NumTableCells)
+    {
+        return false;
+    }
+
+    const FSlot* Ring = Slots.GetData() + Cell * (RingMask + 1);
+    ToStep = FMath::Min(ToStep, FromStep + RingMask);
+    for (int32 Step = FromStep; Step <= ToStep; Step++)
+    {
+        const FSlot& Slot = Ring[Step & RingMask];
+        if (Slot.Step == Step && Slot.Agent != INDEX_NONE && Slot.Agent != AgentId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ==================== COOPERATIVE A* ====================
+
+FMazeCooperativePathfinder::FMazeCooperativePathfinder()
+    : LastExpansions(0)
+{
+}
+
+bool FMazeCooperativePathfinder::FindPath(const FMazeGrid& Grid, FMazeReservationTable& Table, int32 AgentId, int32 StartIndex,
+                                          int32 GoalIndex, const TArray<int32>& GoalDistances, int32 NowStep, int32 WindowSteps,
+                                          int32 CrowdPenalty, TArray<int32>& OutPath)
+{
+    OutPath.Reset();
+    LastExpansions = 0;
+
+    const int32 NumCells = Grid.Num();
+    if (StartIndex < 0 || StartIndex >= NumCells || GoalIndex < 0 || GoalIndex >= NumCells ||
+        GoalDistances.Num() != NumCells || GoalDistances[StartIndex] < 0)
+    {
+        return false;
+    }
+    WindowSteps = FMath::Max(WindowSteps, 1);
+
+    // The previous plan is not in its own way
+    Table.Release(AgentId);
+
+    Nodes.Reset();
+    OpenHeap.Reset();
+    StateNodes.Reset();
+
+    auto StateKey = [](int32 Cell, int32 Time)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(Cell)) << 32) | static_cast<uint32>(Time);
+    };
+
+    Nodes.Add(FNode{ StartIndex, 0, 0, INDEX_NONE });
+    StateNodes.Add(StateKey(StartIndex, 0), 0);
+    OpenHeap.HeapPush(FOpenEntry{ GoalDistances[StartIndex], 0, 0 });
+
+    int32 BestNode = INDEX_NONE;
+    while (OpenHeap.Num() > 0)
+    {
+        FOpenEntry Entry;
+        OpenHeap.HeapPop(Entry);
+
+        // Copied: adding nodes below may reallocate the array
+        const FNode Node = Nodes[Entry.Node];
+        if (Entry.G > Node.G)
+        {
+            continue;
+        }
+        LastExpansions++;
+
+        // The distance field is exact past the window, so the first edge state popped is the best plan
+        if (Node.Cell == GoalIndex || Node.Time == WindowSteps)
+        {
+            BestNode = Entry.Node;
+            break;
+        }
+
+        const int32 Step = NowStep + Node.Time + 1;
+        auto TryStep = [&](int32 Next)
+        {
+            if (GoalDistances[Next] < 0)
+            {
+                return;
+            }
+
+            const int32 Owner = Table.GetOwner(Next, Step);
+            if (Owner != INDEX_NONE && Owner != AgentId)
+            {
+                return;
+            }
+
+            // Head-on: whoever takes this cell next step is coming out of Next
+            if (Next != Node.Cell)
+            {
+                const int32 Oncoming = Table.GetOwner(Node.Cell, Step);
+                if (Oncoming != INDEX_NONE && Oncoming != AgentId && Table.GetOwner(Next, Step - 1) == Oncoming)
+                {
+                    return;
+                }
+            }
+
+            int32 G = Node.G + 1;
+            if (CrowdPenalty > 0 && Table.IsClaimedByOther(Next, AgentId, Step, NowStep + WindowSteps))
+            {
+                G += CrowdPenalty;
+            }
+
+            const uint64 Key = StateKey(Next, Node.Time + 1);
+            int32 NextNode = INDEX_NONE;
+            if (const int32* Existing = StateNodes.Find(Key))
+            {
+                if (Nodes[*Existing].G <= G)
+                {
+                    return;
+                }
+                NextNode = *Existing;
+                Nodes[NextNode].G = G;
+                Nodes[NextNode].Parent = Entry.Node;
+            }
+            else
+            {
+                NextNode = Nodes.Add(FNode{ Next, Node.Time + 1, G, Entry.Node });
+                StateNodes.Add(Key, NextNode);
+            }
+            OpenHeap.HeapPush(FOpenEntry{ G + GoalDistances[Next], G, NextNode });
+        };
+
+        TryStep(Node.Cell);
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Node.Cell))
+        {
+            TryStep(Neighbor.Index);
+        }
+    }
+
+    if (BestNode == INDEX_NONE)
+    {
+        // Boxed in for the whole window
+        return false;
+    }
+
+    PlanScratch.Reset();
+    for (int32 NodeIndex = BestNode; NodeIndex != INDEX_NONE; NodeIndex = Nodes[NodeIndex].Parent)
+    {
+        PlanScratch.Add(Nodes[NodeIndex].Cell);
+    }
+    Algo::Reverse(PlanScratch);
+
+    for (int32 Time = 0; Time < PlanScratch.Num(); Time++)
+    {
+        Table.Reserve(AgentId, PlanScratch[Time], NowStep + Time);
+        if (OutPath.Num() == 0 || OutPath.Last() != PlanScratch[Time])
+        {
+            OutPath.Add(PlanScratch[Time]);
+        }
+    }
+
+    // Past the window nobody is in the way: downhill on the distance field
+    int32 Current = OutPath.Last();
+    while (GoalDistances[Current] > 0)
+    {
+        int32 NextIndex = INDEX_NONE;
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+        {
+            if (GoalDistances[Neighbor.Index] == GoalDistances[Current] - 1)
+            {
+                NextIndex = Neighbor.Index;
+                break;
+            }
+        }
+        if (NextIndex == INDEX_NONE)
+        {
+            // Field out of date with the walls
+            OutPath.Reset();
+            return false;
+        }
+        OutPath.Add(NextIndex);
+        Current = NextIndex;
+    }
+    return true;
+}
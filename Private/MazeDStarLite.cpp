@@ -0,0 +1,345 @@
+// MazeDStarLite.cpp
+#include "MazeDStarLite.h"
+#include "MazeGrid.h"
+
+FMazeDStarLite::FMazeDStarLite()
+{
+    Rows = 0;
+    Cols = 0;
+    StartIndex = INDEX_NONE;
+    GoalIndex = INDEX_NONE;
+    LastStartIndex = INDEX_NONE;
+    KeyModifier = 0;
+    KnownWallVersion = 0;
+    LastExpansions = 0;
+    LastChangedCells = 0;
+    bLastSearchRestarted = false;
+}
+
+void FMazeDStarLite::Reset(const FMazeGrid& Grid, int32 InStartIndex, int32 InGoalIndex)
+{
+    const int32 NumCells = Grid.Num();
+
+    Rows = Grid.Rows;
+    Cols = Grid.Cols;
+    StartIndex = InStartIndex;
+    LastStartIndex = InStartIndex;
+    GoalIndex = InGoalIndex;
+    KeyModifier = 0;
+    KnownWallVersion = Grid.WallVersion;
+    KnownMasks = Grid.WallMasks;
+
+    G.Init(Infinity, NumCells);
+    Rhs.Init(Infinity, NumCells);
+    HeapPosition.Init(INDEX_NONE, NumCells);
+    Heap.Reset();
+
+    Rhs[GoalIndex] = 0;
+    QueueInsertOrUpdate(GoalIndex, CalculateKey(GoalIndex));
+}
+
+bool FMazeDStarLite::FindPath(const FMazeGrid& Grid, int32 InStartIndex, int32 InGoalIndex, TArray<int32>& OutPath)
+{
+    OutPath.Reset();
+    LastExpansions = 0;
+    LastChangedCells = 0;
+    bLastSearchRestarted = false;
+
+    const int32 NumCells = Grid.Num();
+    if (InStartIndex < 0 || InStartIndex >= NumCells || InGoalIndex < 0 || InGoalIndex >= NumCells)
+    {
+        return false;
+    }
+
+    if (GoalIndex == INDEX_NONE || Grid.Rows != Rows || Grid.Cols != Cols ||
+        Grid.GetManhattanDistance(GoalIndex, InGoalIndex) > MaxGoalMoveCells)
+    {
+        Reset(Grid, InStartIndex, InGoalIndex);
+        bLastSearchRestarted = true;
+    }
+    else
+    {
+        // The start moved: keys already queued were computed against the old start, so the
+        // heuristic drift is folded into km instead of re-keying the whole queue
+        StartIndex = InStartIndex;
+        if (StartIndex != LastStartIndex)
+        {
+            KeyModifier += Grid.GetManhattanDistance(LastStartIndex, StartIndex);
+            LastStartIndex = StartIndex;
+        }
+
+        // The goal moved: the heuristic measures towards the start, so no key drifts, only the root changes
+        if (InGoalIndex != GoalIndex)
+        {
+            MoveGoal(Grid, InGoalIndex);
+        }
+
+        if (Grid.WallVersion != KnownWallVersion && !ApplyWallChanges(Grid))
+        {
+            Reset(Grid, InStartIndex, InGoalIndex);
+            bLastSearchRestarted = true;
+        }
+    }
+
+    ComputeShortestPath(Grid);
+
+    if (G[StartIndex] >= Infinity)
+    {
+        return false;
+    }
+
+    // Walk down the g values, every step goes to an open neighbor one closer to the goal
+    OutPath.Reserve(G[StartIndex] + 1);
+    OutPath.Add(StartIndex);
+
+    int32 Current = StartIndex;
+    while (Current != GoalIndex)
+    {
+        int32 Best = INDEX_NONE;
+        int32 BestCost = Infinity;
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+        {
+            if (G[Neighbor.Index] < BestCost)
+            {
+                BestCost = G[Neighbor.Index];
+                Best = Neighbor.Index;
+            }
+        }
+
+        if (Best == INDEX_NONE || BestCost >= G[Current] || OutPath.Num() > NumCells)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[DStarLite] Path extraction stalled at cell %d"), Current);
+            OutPath.Reset();
+            return false;
+        }
+
+        OutPath.Add(Best);
+        Current = Best;
+    }
+
+    return true;
+}
+
+int32 FMazeDStarLite::Heuristic(int32 Cell) const
+{
+    return FMath::Abs(Cell / Cols - StartIndex / Cols) + FMath::Abs(Cell % Cols - StartIndex % Cols);
+}
+
+FMazeDStarLite::FKey FMazeDStarLite::CalculateKey(int32 Cell) const
+{
+    const int32 Best = FMath::Min(G[Cell], Rhs[Cell]);
+    return FKey{ Best + Heuristic(Cell) + KeyModifier, Best };
+}
+
+void FMazeDStarLite::UpdateVertex(const FMazeGrid& Grid, int32 Cell)
+{
+    if (Cell != GoalIndex)
+    {
+        int32 Best = Infinity;
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+        {
+            Best = FMath::Min(Best, G[Neighbor.Index] + 1);
+        }
+        Rhs[Cell] = Best;
+    }
+
+    if (G[Cell] != Rhs[Cell])
+    {
+        QueueInsertOrUpdate(Cell, CalculateKey(Cell));
+    }
+    else if (HeapPosition[Cell] != INDEX_NONE)
+    {
+        QueueRemove(Cell);
+    }
+}
+
+void FMazeDStarLite::ComputeShortestPath(const FMazeGrid& Grid)
+{
+    while (Heap.Num() > 0)
+    {
+        const FKey StartKey = CalculateKey(StartIndex);
+        const FQueueEntry Top = Heap[0];
+        if (!(Top.Key < StartKey) && Rhs[StartIndex] == G[StartIndex])
+        {
+            break;
+        }
+
+        const int32 Cell = Top.Cell;
+        const FKey NewKey = CalculateKey(Cell);
+        LastExpansions++;
+
+        if (Top.Key < NewKey)
+        {
+            // Stale key from before a start move
+            QueueInsertOrUpdate(Cell, NewKey);
+        }
+        else if (G[Cell] > Rhs[Cell])
+        {
+            // Overconsistent: settle it and let the neighbors pick up the shorter route
+            G[Cell] = Rhs[Cell];
+            QueueRemove(Cell);
+            for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+            {
+                UpdateVertex(Grid, Neighbor.Index);
+            }
+        }
+        else
+        {
+            // Underconsistent: the old route got longer, invalidate it and re-derive
+            G[Cell] = Infinity;
+            UpdateVertex(Grid, Cell);
+            for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+            {
+                UpdateVertex(Grid, Neighbor.Index);
+            }
+        }
+    }
+}
+
+bool FMazeDStarLite::ApplyWallChanges(const FMazeGrid& Grid)
+{
+    const int32 NumCells = Grid.Num();
+
+    TArray<int32>& ChangedCells = ChangedScratch;
+    ChangedCells.Reset();
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        if (KnownMasks[Index] != Grid.WallMasks[Index])
+        {
+            ChangedCells.Add(Index);
+        }
+    }
+
+    LastChangedCells = ChangedCells.Num();
+
+    // A regeneration touches every cell - a fresh search is cheaper than repairing all of it
+    if (ChangedCells.Num() > NumCells / 4)
+    {
+        return false;
+    }
+
+    for (int32 Index : ChangedCells)
+    {
+        const uint8 ChangedDirs = KnownMasks[Index] ^ Grid.WallMasks[Index];
+        KnownMasks[Index] = Grid.WallMasks[Index];
+
+        // Both ends of a changed passage have to re-derive rhs (the neighbor is usually in the list too)
+        UpdateVertex(Grid, Index);
+        for (uint32 Bits = ChangedDirs; Bits != 0; Bits &= Bits - 1)
+        {
+            UpdateVertex(Grid, Grid.GetNeighborIndex(Index, static_cast<int32>(FMath::CountTrailingZeros(Bits))));
+        }
+    }
+
+    KnownWallVersion = Grid.WallVersion;
+    return true;
+}
+
+void FMazeDStarLite::MoveGoal(const FMazeGrid& Grid, int32 NewGoalIndex)
+{
+    const int32 OldGoalIndex = GoalIndex;
+    GoalIndex = NewGoalIndex;
+
+    Rhs[GoalIndex] = 0;
+    UpdateVertex(Grid, GoalIndex);
+
+    // Cells routed through the old goal turn underconsistent from here and re-derive
+    UpdateVertex(Grid, OldGoalIndex);
+}
+
+// ==================== PRIORITY QUEUE ====================
+
+void FMazeDStarLite::QueueInsertOrUpdate(int32 Cell, const FKey& Key)
+{
+    int32 Position = HeapPosition[Cell];
+    if (Position == INDEX_NONE)
+    {
+        Position = Heap.Add(FQueueEntry{ Key, Cell });
+        HeapPosition[Cell] = Position;
+        SiftUp(Position);
+        return;
+    }
+
+    const bool bDecreased = Key < Heap[Position].Key;
+    Heap[Position].Key = Key;
+    if (bDecreased)
+    {
+        SiftUp(Position);
+    }
+    else
+    {
+        SiftDown(Position);
+    }
+}
+
+void FMazeDStarLite::QueueRemove(int32 Cell)
+{
+    const int32 Position = HeapPosition[Cell];
+    if (Position == INDEX_NONE)
+    {
+        return;
+    }
+
+    const int32 LastPosition = Heap.Num() - 1;
+    if (Position != LastPosition)
+    {
+        QueueSwap(Position, LastPosition);
+    }
+    Heap.Pop();
+    HeapPosition[Cell] = INDEX_NONE;
+
+    if (Position < Heap.Num())
+    {
+        const int32 MovedCell = Heap[Position].Cell;
+        SiftUp(Position);
+        SiftDown(HeapPosition[MovedCell]);
+    }
+}
+
+void FMazeDStarLite::SiftUp(int32 Position)
+{
+    while (Position > 0)
+    {
+        const int32 Parent = (Position - 1) / 2;
+        if (!(Heap[Position].Key < Heap[Parent].Key))
+        {
+            break;
+        }
+        QueueSwap(Position, Parent);
+        Position = Parent;
+    }
+}
+
+void FMazeDStarLite::SiftDown(int32 Position)
+{
+    const int32 Count = Heap.Num();
+    while (true)
+    {
+        const int32 Left = Position * 2 + 1;
+        const int32 Right = Left + 1;
+        int32 Smallest = Position;
+
+        if (Left < Count && Heap[Left].Key < Heap[Smallest].Key)
+        {
+            Smallest = Left;
+        }
+        if (Right < Count && Heap[Right].Key < Heap[Smallest].Key)
+        {
+            Smallest = Right;
+        }
+        if (Smallest == Position)
+        {
+            break;
+        }
+
+        QueueSwap(Position, Smallest);
+        Position = Smallest;
+    }
+}
+
+void FMazeDStarLite::QueueSwap(int32 A, int32 B)
+{
+    Swap(Heap[A], Heap[B]);
+    HeapPosition[Heap[A].Cell] = A;
+    HeapPosition[Heap[B].Cell] = B;
+}
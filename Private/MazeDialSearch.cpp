@@ -0,0 +1,177 @@
+// MazeDialSearch.cpp
+#include "MazeDialSearch.h"
+#include "MazeGrid.h"
+
+// ==================== COST PROFILE ====================
+
+FMazeCostProfile FMazeCostProfile::Make(int32 Open, int32 Mud, int32 Trap, int32 SafeZone)
+{
+    FMazeCostProfile Profile;
+    Profile.OpenCost = static_cast<uint8>(FMath::Clamp(Open, 1, 255));
+    Profile.MudCost = static_cast<uint8>(FMath::Clamp(Mud, 1, 255));
+    Profile.TrapCost = static_cast<uint8>(FMath::Clamp(Trap, 1, 255));
+    Profile.SafeZoneCost = static_cast<uint8>(FMath::Clamp(SafeZone, 1, 255));
+    return Profile;
+}
+
+int32 FMazeCostProfile::GetCost(uint8 Terrain) const
+{
+    const EMazeTerrain Flags = static_cast<EMazeTerrain>(Terrain);
+    if (Flags == EMazeTerrain::None)
+    {
+        return OpenCost;
+    }
+
+    int32 Cost = 0;
+    if (EnumHasAnyFlags(Flags, EMazeTerrain::Mud)) Cost = FMath::Max<int32>(Cost, MudCost);
+    if (EnumHasAnyFlags(Flags, EMazeTerrain::Trap)) Cost = FMath::Max<int32>(Cost, TrapCost);
+    if (EnumHasAnyFlags(Flags, EMazeTerrain::SafeZone)) Cost = FMath::Max<int32>(Cost, SafeZoneCost);
+    return FMath::Max(Cost, 1);
+}
+
+int32 FMazeCostProfile::GetMaxCost() const
+{
+    return FMath::Max(FMath::Max<int32>(OpenCost, MudCost), FMath::Max<int32>(TrapCost, SafeZoneCost));
+}
+
+// ==================== SEARCH ====================
+
+FMazeDialSearch::FMazeDialSearch()
+{
+    LastCost = -1;
+    LastExpansions = 0;
+}
+
+bool FMazeDialSearch::FindPath(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                               int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath)
+{
+    OutPath.Reset();
+
+    const int32 NumCells = Grid.Num();
+    if (StartIndex < 0 || StartIndex >= NumCells || GoalIndex < 0 || GoalIndex >= NumCells)
+    {
+        LastCost = -1;
+        LastExpansions = 0;
+        return false;
+    }
+
+    Run(Grid, Terrain, Profile, StartIndex, GoalIndex);
+    if (Cost[GoalIndex] == Infinity)
+    {
+        return false;
+    }
+
+    // Count first so the path is filled back to front in a single allocation
+    int32 Length = 0;
+    for (int32 Cell = GoalIndex; Cell != INDEX_NONE; Cell = Parent[Cell])
+    {
+        Length++;
+    }
+
+    OutPath.SetNumUninitialized(Length);
+    for (int32 Cell = GoalIndex; Cell != INDEX_NONE; Cell = Parent[Cell])
+    {
+        OutPath[--Length] = Cell;
+    }
+    return true;
+}
+
+void FMazeDialSearch::ComputeCostField(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                                       int32 SourceIndex, TArray<int32>& OutCosts)
+{
+    const int32 NumCells = Grid.Num();
+    OutCosts.Init(-1, NumCells);
+    if (SourceIndex < 0 || SourceIndex >= NumCells)
+    {
+        return;
+    }
+
+    Run(Grid, Terrain, Profile, SourceIndex, INDEX_NONE);
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        if (Cost[Index] != Infinity)
+        {
+            OutCosts[Index] = Cost[Index];
+        }
+    }
+}
+
+void FMazeDialSearch::Run(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                          int32 SourceIndex, int32 GoalIndex)
+{
+    const int32 NumCells = Grid.Num();
+    LastCost = -1;
+    LastExpansions = 0;
+
+    Cost.Init(Infinity, NumCells);
+    Parent.SetNumUninitialized(NumCells);
+
+    // Power of two ring no smaller than MaxCost + 1, so the bucket of a cost is a mask away
+    const int32 NumBuckets = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Profile.GetMaxCost() + 1)));
+    const int32 BucketMask = NumBuckets - 1;
+    if (Buckets.Num() < NumBuckets)
+    {
+        Buckets.SetNum(NumBuckets);
+    }
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        Buckets[Bucket].Reset();
+    }
+
+    // Terrain mask -> entry cost, one table load per relaxed passage
+    int32 CostTable[FMazeCostProfile::NumTerrainMasks];
+    for (int32 Mask = 0; Mask < FMazeCostProfile::NumTerrainMasks; Mask++)
+    {
+        CostTable[Mask] = Profile.GetCost(static_cast<uint8>(Mask));
+    }
+    const bool bHasTerrain = Terrain.Num() == NumCells;
+
+    Cost[SourceIndex] = 0;
+    Parent[SourceIndex] = INDEX_NONE;
+    Buckets[0].Add(SourceIndex);
+    int32 NumQueued = 1;
+    int32 CurrentCost = 0;
+
+    while (NumQueued > 0)
+    {
+        // Everything queued costs CurrentCost..CurrentCost + MaxCost, so the ring never laps itself
+        TArray<int32>* Bucket = &Buckets[CurrentCost & BucketMask];
+        while (Bucket->Num() == 0)
+        {
+            CurrentCost++;
+            Bucket = &Buckets[CurrentCost & BucketMask];
+        }
+
+        const int32 Cell = Bucket->Pop(false);
+        NumQueued--;
+
+        // Lazy decrease-key: a cell that got cheaper was pushed again, the old entry is skipped here
+        if (Cost[Cell] != CurrentCost)
+        {
+            continue;
+        }
+        LastExpansions++;
+
+        if (Cell == GoalIndex)
+        {
+            LastCost = CurrentCost;
+            return;
+        }
+
+        // Costs are positive, so a settled cell can never be improved and is never re-queued
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+        {
+            const int32 StepCost = bHasTerrain ? CostTable[Terrain[Neighbor.Index] & (FMazeCostProfile::NumTerrainMasks - 1)] : CostTable[0];
+            const int32 NewCost = CurrentCost + StepCost;
+            if (NewCost < Cost[Neighbor.Index])
+            {
+                Cost[Neighbor.Index] = NewCost;
+                Parent[Neighbor.Index] = Cell;
+                Buckets[NewCost & BucketMask].Add(Neighbor.Index);
+                NumQueued++;
+            }
+        }
+    }
+
+    LastCost = CurrentCost;
+}
@@ -25,6 +25,16 @@
 #include "TrapCell.h"
 #include "Engine/DirectionalLight.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
+#include "MazePathBenchmark.h"
+#include "MazePathBenchmarkSuite.h"
+#include "MazeLevelSimulation.h"
+#include "MazeAutopilot.h"
+#include "MazeStressTest.h"
+#include "MonsterDirector.h"
+#if MAZE_WITH_ANIMATION_BUDGET
+#include "IAnimationBudgetAllocator.h"
+#endif
+#include "DrawDebugHelpers.h"
 
 AMazeGameMode::AMazeGameMode()
 {
@@ -43,6 +53,16 @@ AMazeGameMode::AMazeGameMode()
     bMazeGenerated = false;
     bMonsterSpeedBoosted = false;
     bInMenuPreview = false;
+    MonsterDirector = nullptr;
+    Autopilot = nullptr;
+    StressTest = nullptr;
+    CatchCheckSeconds = 0.0;
+    
+    bFixedStepSimulation = true;
+    SimulationStepsPerSecond = 60.0f;
+    MaxSimulationStepsPerFrame = 8;
+    SimulationSeed = 0;
+    MonsterSpawnCountdown = -1.0f;
     OriginalMonsterSpeed = 0.0f;
     
     bSpawnRandomly = true;
@@ -100,6 +120,8 @@ void AMazeGameMode::BeginPlay()
     bMuddyEffectActive = false;
     MuddyEffectTimer = 0.0f;
     
+    ConfigureAnimationBudget();
+    
     // Step 1: Get player reference
     Player = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
     if (!Player)
@@ -204,6 +226,36 @@ void AMazeGameMode::BeginPlay()
         UE_LOG(LogTemp, Warning, TEXT("[MenuPreview] Player, star, and flashlight spawned for preview"));
     }, 0.2f, false);
     
+    // Unattended session: the autopilot starts the levels itself, no menu
+    if (AMazeAutopilot::IsRequested())
+    {
+        FActorSpawnParameters AutopilotSpawnParams;
+        AutopilotSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Autopilot = GetWorld()->SpawnActor<AMazeAutopilot>(AMazeAutopilot::StaticClass(), FTransform::Identity, AutopilotSpawnParams);
+        if (Autopilot)
+        {
+            Autopilot->Configure(this);
+            return;
+        }
+    }
+    
+    // Stress session: builds its own maze and monsters once the preview player is in
+    if (AMazeStressTest::IsRequested())
+    {
+        FTimerHandle StressTimer;
+        GetWorldTimerManager().SetTimer(StressTimer, [this]()
+        {
+            FActorSpawnParameters StressSpawnParams;
+            StressSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            StressTest = GetWorld()->SpawnActor<AMazeStressTest>(AMazeStressTest::StaticClass(), FTransform::Identity, StressSpawnParams);
+            if (StressTest)
+            {
+                StressTest->Configure(this);
+            }
+        }, 0.5f, false);
+        return;
+    }
+    
     // Step 6: Show main menu AFTER maze is ready
     if (MainMenuWidgetClass)
     {
@@ -314,6 +366,12 @@ void AMazeGameMode::StartGame()
     // Step 1: Initialize game state
     CurrentGameState = EGameState::Playing;
     RemainingTime = TotalGameTime;
+    SimulationClock.Configure(SimulationStepsPerSecond, MaxSimulationStepsPerFrame);
+    SimulationRandom.Initialize(SimulationSeed != 0 ? SimulationSeed : FMath::Rand());
+    if (MazeManager)
+    {
+        MazeManager->SetSimulationClock(bFixedStepSimulation ? &SimulationClock : nullptr);
+    }
     bMonsterSpawned = false;
     bMonsterSpeedBoosted = false;
     bInMenuPreview = false;  // Exit preview mode
@@ -380,12 +438,11 @@ void AMazeGameMode::StartGame()
         SpawnGoldenStar();
     }
     
-    // Step 4: Monster spawn timer (starts NOW when game begins) - only if enabled
+    // Step 4: Monster spawn countdown (starts NOW when game begins, runs on the simulation clock) - only if enabled
+    MonsterSpawnCountdown = MonsterSpawnTime;
     if (MonsterSpawnTime >= 0.0f)
     {
         UE_LOG(LogTemp, Warning, TEXT("[GameMode] Monster will spawn in %.0f seconds"), MonsterSpawnTime);
-        FTimerHandle MonsterTimer;
-        GetWorldTimerManager().SetTimer(MonsterTimer, this, &AMazeGameMode::SpawnMonster, MonsterSpawnTime, false);
     }
     else
     {
@@ -581,8 +638,14 @@ void AMazeGameMode::Tick(float DeltaTime)
     
     if (CurrentGameState == EGameState::Playing)
     {
-        // Update timer
-        RemainingTime -= DeltaTime;
+        // Gameplay runs in fixed steps of the simulation clock, so the frame rate does not change
+        // outcomes; a step that ends the level ends the frame's steps
+        const int32 NumSteps = bFixedStepSimulation ? SimulationClock.Advance(DeltaTime) : 1;
+        const float StepSeconds = bFixedStepSimulation ? SimulationClock.GetStepSeconds() : DeltaTime;
+        for (int32 Step = 0; Step < NumSteps && CurrentGameState == EGameState::Playing; Step++)
+        {
+            SimulateStep(StepSeconds);
+        }
         
         // Update HUD timer display
         if (HUDWidget)
@@ -594,69 +657,6 @@ void AMazeGameMode::Tick(float DeltaTime)
             }
         }
         
-        // Check conditions
-        CheckWinCondition();
-        CheckLoseCondition();
-        
-        // FEATURE: Increase monster speed and size in last 30 seconds
-        if (RemainingTime <= 30.0f && !bMonsterSpeedBoosted && SpawnedMonsters.Num() > 0)
-        {
-            bMonsterSpeedBoosted = true;
-            
-            // Boost first monster
-            AMonsterAI* FirstMonster = SpawnedMonsters[0];
-            if (FirstMonster)
-            {
-                // Store original speed if not already stored
-                if (OriginalMonsterSpeed == 0.0f)
-                {
-                    OriginalMonsterSpeed = FirstMonster->MoveSpeed;
-                }
-                
-                // Increase speed by 50%
-                float NewSpeed = OriginalMonsterSpeed * 1.5f;
-                FirstMonster->MoveSpeed = NewSpeed;
-                
-                // Update character movement component
-                if (FirstMonster->GetCharacterMovement())
-                {
-                    FirstMonster->GetCharacterMovement()->MaxWalkSpeed = NewSpeed;
-                }
-                
-                // GROW MONSTER TO 1.7x SIZE - Make it terrifying!
-                FVector NewScale = FVector(1.7f, 1.7f, 1.7f);
-                FirstMonster->SetActorScale3D(NewScale);
-                UE_LOG(LogTemp, Warning, TEXT("[GameMode] 👹 MONSTER GREW TO 1.7x SIZE! 👹"));
-                
-                UE_LOG(LogTemp, Warning, TEXT("[GameMode] Monster speed boosted from %.0f to %.0f"), 
-                       OriginalMonsterSpeed, NewSpeed);
-            }
-            
-            // Show warning
-            if (GEngine)
-            {
-                GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Orange,
-                    TEXT("⚠️ MONSTER IS NOW FASTER AND BIGGER!"));
-            }
-            
-            // Play transformation sound if set
-            if (MonsterTransformSound)
-            {
-                UGameplayStatics::PlaySound2D(GetWorld(), MonsterTransformSound, 1.0f);
-            }
-            else if (MonsterSpeedBoostSound)
-            {
-                UGameplayStatics::PlaySound2D(GetWorld(), MonsterSpeedBoostSound, 1.0f);
-            }
-        }
-        
-        // Time's up
-        if (RemainingTime <= 0.0f)
-        {
-            RemainingTime = 0.0f;
-            PlayerLost("Time's up!");
-        }
-        
         // CRITICAL: Keep player above floor
         if (Player)
         {
@@ -690,65 +690,170 @@ void AMazeGameMode::Tick(float DeltaTime)
                 PlayerFlashlight->SetWorldRotation(CameraRotation);
             }
         }
+    }
+}
+
+void AMazeGameMode::SimulateStep(float StepSeconds)
+{
+    // Update timer
+    RemainingTime -= StepSeconds;
+    
+    // Level's monster, counted down in steps rather than on a world timer
+    if (MonsterSpawnCountdown >= 0.0f)
+    {
+        MonsterSpawnCountdown -= StepSeconds;
+        if (MonsterSpawnCountdown <= 0.0f)
+        {
+            MonsterSpawnCountdown = -1.0f;
+            SpawnMonster();
+        }
+    }
+    
+    // Monster AI in spawn order, so every run steps them the same way
+    for (int32 i = 0; i < SpawnedMonsters.Num(); i++)
+    {
+        AMonsterAI* Monster = SpawnedMonsters[i];
+        if (IsValid(Monster) && Monster->IsOnSimulationClock() && !Monster->IsDirectorControlled())
+        {
+            Monster->AdvanceSimulationClock(StepSeconds);
+        }
+    }
+    if (bFixedStepSimulation && MonsterDirector)
+    {
+        MonsterDirector->SimulateStep(StepSeconds);
+    }
+    
+    for (ATrapCell* Trap : SpawnedTrapCells)
+    {
+        if (IsValid(Trap))
+        {
+            Trap->SimulateStep(StepSeconds);
+        }
+    }
+    
+    // Check conditions
+    CheckWinCondition();
+    
+    const double CatchCheckStart = FPlatformTime::Seconds();
+    CheckLoseCondition();
+    CatchCheckSeconds += FPlatformTime::Seconds() - CatchCheckStart;
+    
+    // FEATURE: Increase monster speed and size in last 30 seconds
+    if (RemainingTime <= 30.0f && !bMonsterSpeedBoosted && SpawnedMonsters.Num() > 0)
+    {
+        bMonsterSpeedBoosted = true;
         
-        // MUDDY EFFECT: Handle resolution reduction timer
-        if (bMuddyEffectActive)
+        // Boost first monster
+        AMonsterAI* FirstMonster = SpawnedMonsters[0];
+        if (FirstMonster)
         {
-            MuddyEffectTimer -= DeltaTime;
+            // Store original speed if not already stored
+            if (OriginalMonsterSpeed == 0.0f)
+            {
+                OriginalMonsterSpeed = FirstMonster->MoveSpeed;
+            }
+            
+            // Increase speed by 50%
+            float NewSpeed = OriginalMonsterSpeed * 1.5f;
+            FirstMonster->MoveSpeed = NewSpeed;
             
-            if (MuddyEffectTimer <= 0.0f)
+            // Update character movement component
+            if (FirstMonster->GetCharacterMovement())
             {
-                // Effect expired - restore resolution and speed
-                bMuddyEffectActive = false;
-                
-                if (GEngine)
-                {
-                    GEngine->Exec(GetWorld(), *FString::Printf(TEXT("r.ScreenPercentage %f"), OriginalResolution));
-                    UE_LOG(LogTemp, Warning, TEXT("[MuddyEffect] Effect expired! Resolution restored to %.0f%%"), OriginalResolution);
-                    
-                    GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
-                        TEXT("Vision and speed restored!"));
-                }
-                
-                // Restore player speed
-                if (Player)
-                {
-                    ACharacter* PlayerChar = Cast<ACharacter>(Player);
-                    if (PlayerChar && PlayerChar->GetCharacterMovement())
-                    {
-                        PlayerChar->GetCharacterMovement()->MaxWalkSpeed = OriginalPlayerSpeed;
-                        UE_LOG(LogTemp, Warning, TEXT("[MuddyEffect] Player speed restored to %.0f"), OriginalPlayerSpeed);
-                    }
-                }
+                FirstMonster->GetCharacterMovement()->MaxWalkSpeed = NewSpeed;
             }
+            
+            // GROW MONSTER TO 1.7x SIZE - Make it terrifying!
+            FVector NewScale = FVector(1.7f, 1.7f, 1.7f);
+            FirstMonster->SetActorScale3D(NewScale);
+            UE_LOG(LogTemp, Warning, TEXT("[GameMode] 👹 MONSTER GREW TO 1.7x SIZE! 👹"));
+            
+            UE_LOG(LogTemp, Warning, TEXT("[GameMode] Monster speed boosted from %.0f to %.0f"), 
+                   OriginalMonsterSpeed, NewSpeed);
         }
         
-        // Level 5 Blood Moon mechanics
-        if (CurrentLevel == 5 && CurrentGameState == EGameState::Playing && LevelManager)
+        // Show warning
+        if (GEngine)
         {
-            FLevelConfig Config = LevelManager->GetLevelConfig(5);
+            GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Orange,
+                TEXT("⚠️ MONSTER IS NOW FASTER AND BIGGER!"));
+        }
+        
+        // Play transformation sound if set
+        if (MonsterTransformSound)
+        {
+            UGameplayStatics::PlaySound2D(GetWorld(), MonsterTransformSound, 1.0f);
+        }
+        else if (MonsterSpeedBoostSound)
+        {
+            UGameplayStatics::PlaySound2D(GetWorld(), MonsterSpeedBoostSound, 1.0f);
+        }
+    }
+    
+    // Time's up
+    if (RemainingTime <= 0.0f)
+    {
+        RemainingTime = 0.0f;
+        PlayerLost("Time's up!");
+    }
+    
+    // MUDDY EFFECT: Handle resolution reduction timer
+    if (bMuddyEffectActive)
+    {
+        MuddyEffectTimer -= StepSeconds;
+        
+        if (MuddyEffectTimer <= 0.0f)
+        {
+            // Effect expired - restore resolution and speed
+            bMuddyEffectActive = false;
             
-            // Second monster spawn at 1:30
-            if (!bSecondMonsterSpawned && Config.SecondMonsterSpawnTime > 0.0f)
+            if (GEngine)
             {
-                if (RemainingTime <= Config.SecondMonsterSpawnTime)
-                {
-                    SpawnSecondMonster();
-                    bSecondMonsterSpawned = true;
-                }
+                GEngine->Exec(GetWorld(), *FString::Printf(TEXT("r.ScreenPercentage %f"), OriginalResolution));
+                UE_LOG(LogTemp, Warning, TEXT("[MuddyEffect] Effect expired! Resolution restored to %.0f%%"), OriginalResolution);
+                
+                GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
+                    TEXT("Vision and speed restored!"));
             }
             
-            // Aggressive mode at 1:00
-            if (!bAggressiveModeActivated && Config.AggressiveModeTime > 0.0f)
+            // Restore player speed
+            if (Player)
             {
-                if (RemainingTime <= Config.AggressiveModeTime)
+                ACharacter* PlayerChar = Cast<ACharacter>(Player);
+                if (PlayerChar && PlayerChar->GetCharacterMovement())
                 {
-                    ActivateAggressiveMode();
-                    bAggressiveModeActivated = true;
+                    PlayerChar->GetCharacterMovement()->MaxWalkSpeed = OriginalPlayerSpeed;
+                    UE_LOG(LogTemp, Warning, TEXT("[MuddyEffect] Player speed restored to %.0f"), OriginalPlayerSpeed);
                 }
             }
         }
     }
+    
+    // Level 5 Blood Moon mechanics
+    if (CurrentLevel == 5 && CurrentGameState == EGameState::Playing && LevelManager)
+    {
+        FLevelConfig Config = LevelManager->GetLevelConfig(5);
+        
+        // Second monster spawn at 1:30
+        if (!bSecondMonsterSpawned && Config.SecondMonsterSpawnTime > 0.0f)
+        {
+            if (RemainingTime <= Config.SecondMonsterSpawnTime)
+            {
+                SpawnSecondMonster();
+                bSecondMonsterSpawned = true;
+            }
+        }
+        
+        // Aggressive mode at 1:00
+        if (!bAggressiveModeActivated && Config.AggressiveModeTime > 0.0f)
+        {
+            if (RemainingTime <= Config.AggressiveModeTime)
+            {
+                ActivateAggressiveMode();
+                bAggressiveModeActivated = true;
+            }
+        }
+    }
 }
 
 void AMazeGameMode::SpawnPlayer()
@@ -763,19 +868,18 @@ void AMazeGameMode::SpawnPlayer()
     AMazeCell* EscapeCell = MazeManager->GetEscapeCell();
     int32 Attempts = 0;
     int32 MaxAttempts = 100;
-    float MinDistanceFromEscape = MazeManager->CellSize * 7.0f; // At least 7 cells away
+    const int32 MinCellsFromEscape = 7; // At least 7 cells of walking away
     
     if (bSpawnRandomly)
     {
-        // Find random non-exit cell that is far from escape
+        // Find random non-exit cell that is far from escape (walking distance, not straight line)
         do {
             SpawnCell = MazeManager->GetRandomCell();
             Attempts++;
             
             if (SpawnCell && !SpawnCell->bIsEscapeCell && EscapeCell)
             {
-                float Distance = FVector::Dist(SpawnCell->GetActorLocation(), EscapeCell->GetActorLocation());
-                if (Distance >= MinDistanceFromEscape)
+                if (MazeManager->GetPathDistance(SpawnCell, EscapeCell) >= MinCellsFromEscape)
                 {
                     break; // Good spawn location - far enough from escape
                 }
@@ -785,9 +889,8 @@ void AMazeGameMode::SpawnPlayer()
         // Log the distance for verification
         if (SpawnCell && EscapeCell)
         {
-            float FinalDistance = FVector::Dist(SpawnCell->GetActorLocation(), EscapeCell->GetActorLocation());
-            float CellsAway = FinalDistance / MazeManager->CellSize;
-            UE_LOG(LogTemp, Warning, TEXT("[GameMode] Player spawn is %.1f cells away from escape"), CellsAway);
+            UE_LOG(LogTemp, Warning, TEXT("[GameMode] Player spawn is %d cells (walking) away from escape"),
+                   MazeManager->GetPathDistance(SpawnCell, EscapeCell));
         }
     }
     else
@@ -829,7 +932,11 @@ void AMazeGameMode::SpawnGoldenStar()
     
     AMazeCell* StarCell = nullptr;
     int32 Attempts = 0;
-    float MinDistance = MazeManager->CellSize * 3.0f; // At least 3 cells away
+    const int32 MinCells = 3; // At least 3 cells of walking away
+    
+    // One distance field from the player's start answers every attempt
+    TArray<int32> PlayerDistances;
+    MazeManager->ComputeDistanceField(MazeManager->GetCellAtLocation(InitialPlayerLocation), PlayerDistances);
     
     do {
         StarCell = MazeManager->GetRandomCell();
@@ -837,8 +944,8 @@ void AMazeGameMode::SpawnGoldenStar()
         
         if (StarCell && !StarCell->bIsEscapeCell)
         {
-            float Distance = FVector::Dist(StarCell->GetActorLocation(), InitialPlayerLocation);
-            if (Distance >= MinDistance)
+            const int32 CellIndex = MazeManager->GetCellIndex(StarCell);
+            if (PlayerDistances.IsValidIndex(CellIndex) && PlayerDistances[CellIndex] >= MinCells)
             {
                 break; // Good spawn location
             }
@@ -876,10 +983,22 @@ void AMazeGameMode::SpawnMonster()
 		return;
 	}
 	
+	// Level 5 horde: a whole wave for every monster the level would spawn
+	if (bHordeMode && CurrentLevel == 5)
+	{
+		SpawnHorde(HordeWaveSize);
+		bMonsterSpawned = true;
+		return;
+	}
+	
 	// FIXED: Spawn monster far from player (at least 5 cells away)
 	AMazeCell* MonsterCell = nullptr;
 	int32 Attempts = 0;
-	float MinDistance = MazeManager->CellSize * 5.0f; // At least 5 cells away
+	const int32 MinCells = 5; // At least 5 cells of walking away
+	
+	// One distance field from the player's start answers every attempt
+	TArray<int32> PlayerDistances;
+	MazeManager->ComputeDistanceField(MazeManager->GetCellAtLocation(InitialPlayerLocation), PlayerDistances);
 	
 	do {
 		MonsterCell = MazeManager->GetRandomCell();
@@ -887,8 +1006,8 @@ void AMazeGameMode::SpawnMonster()
 		
 		if (MonsterCell && !MonsterCell->bIsEscapeCell)
 		{
-			float Distance = FVector::Dist(MonsterCell->GetActorLocation(), InitialPlayerLocation);
-			if (Distance >= MinDistance)
+			const int32 CellIndex = MazeManager->GetCellIndex(MonsterCell);
+			if (PlayerDistances.IsValidIndex(CellIndex) && PlayerDistances[CellIndex] >= MinCells)
 			{
 				break; // Good spawn location
 			}
@@ -939,7 +1058,7 @@ void AMazeGameMode::SpawnMonster()
         }
         
         // Add to monsters array
-        SpawnedMonsters.Add(Monster);
+        TrackMonster(Monster);
         bMonsterSpawned = true;
         
         UE_LOG(LogTemp, Warning, TEXT("[GameMode] Monster spawned (Total: %d)"), SpawnedMonsters.Num());
@@ -950,6 +1069,173 @@ void AMazeGameMode::SpawnMonster()
     }
 }
 
+void AMazeGameMode::ConfigureAnimationBudget()
+{
+#if MAZE_WITH_ANIMATION_BUDGET
+    // Monster meshes register with the allocator by themselves, only the shared budget is set here
+    IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld());
+    if (!Allocator)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[AnimBudget] No animation budget allocator, is the AnimationBudgetAllocator plugin enabled?"));
+        return;
+    }
+    
+    FAnimationBudgetAllocatorParameters Parameters;
+    Parameters.BudgetInMs = AnimationBudgetMs;
+    Parameters.MaxTickedOffsreenComponents = MaxOffscreenAnimatedMonsters;
+    Allocator->SetParameters(Parameters);
+    Allocator->SetEnabled(bUseAnimationBudget);
+    
+    UE_LOG(LogTemp, Log, TEXT("[AnimBudget] %s, %.2f ms per frame, %d offscreen monsters animated"),
+           bUseAnimationBudget ? TEXT("Enabled") : TEXT("Disabled"), AnimationBudgetMs, MaxOffscreenAnimatedMonsters);
+#else
+    if (bUseAnimationBudget)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[AnimBudget] Built without the AnimationBudgetAllocator plugin, enable it in the .uproject for the shared budget"));
+    }
+#endif
+}
+
+AMonsterDirector* AMazeGameMode::EnsureMonsterDirector()
+{
+    if (!MonsterDirector)
+    {
+        TArray<AActor*> FoundDirectors;
+        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMonsterDirector::StaticClass(), FoundDirectors);
+        MonsterDirector = FoundDirectors.Num() > 0 ? Cast<AMonsterDirector>(FoundDirectors[0]) : nullptr;
+    }
+    
+    if (!MonsterDirector)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        MonsterDirector = GetWorld()->SpawnActor<AMonsterDirector>(AMonsterDirector::StaticClass(), FTransform::Identity, SpawnParams);
+    }
+    
+    if (MonsterDirector)
+    {
+        MonsterDirector->SetMazeManager(MazeManager);
+        MonsterDirector->SetSimulationClock(bFixedStepSimulation ? &SimulationClock : nullptr, bFixedStepSimulation ? this : nullptr);
+    }
+    return MonsterDirector;
+}
+
+void AMazeGameMode::TrackMonster(AMonsterAI* Monster)
+{
+    // On the fixed-step clock SimulateStep steps it, otherwise it ticks on its own
+    Monster->SetSimulationClockOwner(bFixedStepSimulation ? this : nullptr, bFixedStepSimulation ? &SimulationRandom : nullptr);
+    SpawnedMonsters.Add(Monster);
+}
+
+void AMazeGameMode::SpawnHorde(int32 Count)
+{
+    if (!MazeManager || !MonsterClass || !Player || !MazeManager->bIsMazeGenerated)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GameMode] Cannot spawn horde: invalid state"));
+        return;
+    }
+    
+    AMonsterDirector* Director = EnsureMonsterDirector();
+    if (!Director) return;
+    
+    // Every cell at least 5 cells of walking from the player, and preferably 2 from every monster
+    // already hunting so the wave does not land on the pack. One multi-source pass gives the distances
+    // from the player (plane 0) and each monster; the pack is close to the player, where the shared
+    // walk beats one field per source.
+    const int32 MinCells = 5;
+    const int32 MinMonsterCells = 2;
+    TArray<AMazeCell*> Sources;
+    Sources.Add(MazeManager->GetCellAtLocation(Player->GetActorLocation()));
+    for (AMonsterAI* Monster : SpawnedMonsters)
+    {
+        AMazeCell* MonsterCell = IsValid(Monster) ? MazeManager->GetCellAtLocation(Monster->GetActorLocation()) : nullptr;
+        if (MonsterCell)
+        {
+            Sources.Add(MonsterCell);
+        }
+    }
+    
+    FMazeDistancePlanes Planes;
+    MazeManager->ComputeDistancePlanes(Sources, Planes);
+    
+    TArray<AMazeCell*> SpawnCells;
+    TArray<AMazeCell*> CrowdedCells;
+    for (int32 Index = 0; Index < Planes.NumCells; Index++)
+    {
+        const uint16 PlayerDistance = Planes.GetDistance(0, Index);
+        AMazeCell* Cell = PlayerDistance != FMazeDistancePlanes::Unreachable && PlayerDistance >= MinCells ? MazeManager->GetCellByIndex(Index) : nullptr;
+        if (!Cell || Cell->bIsEscapeCell)
+        {
+            continue;
+        }
+        
+        bool bCrowded = false;
+        for (int32 Plane = 1; Plane < Planes.GetNumPlanes() && !bCrowded; Plane++)
+        {
+            bCrowded = Planes.GetDistance(Plane, Index) < MinMonsterCells;
+        }
+        if (bCrowded)
+        {
+            CrowdedCells.Add(Cell);
+        }
+        else
+        {
+            SpawnCells.Add(Cell);
+        }
+    }
+    if (SpawnCells.Num() == 0)
+    {
+        SpawnCells = MoveTemp(CrowdedCells);
+    }
+    
+    if (SpawnCells.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GameMode] Cannot spawn horde: no cell far enough from the player"));
+        return;
+    }
+    
+    Count = FMath::Clamp(Count, 1, 1000);
+    int32 Spawned = 0;
+    for (int32 i = 0; i < Count; i++)
+    {
+        AMazeCell* Cell = SpawnCells[FMath::RandRange(0, SpawnCells.Num() - 1)];
+        
+        // Small offset so monsters sharing a cell start apart (the director spreads them further)
+        FVector Location = Cell->GetActorLocation();
+        Location.X += FMath::FRandRange(-50.0f, 50.0f);
+        Location.Y += FMath::FRandRange(-50.0f, 50.0f);
+        Location.Z = 100.0f;
+        const FTransform SpawnTransform(FRotator::ZeroRotator, Location);
+        
+        // Deferred so the monster gets the manager before BeginPlay instead of searching for it
+        AMonsterAI* Monster = GetWorld()->SpawnActorDeferred<AMonsterAI>(
+            MonsterClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+        if (!Monster) continue;
+        
+        Monster->SetMazeManager(MazeManager);
+        Monster->FinishSpawning(SpawnTransform);
+        
+        Director->AddMonster(Monster);
+        Monster->StartChasing(Player);
+        TrackMonster(Monster);
+        Spawned++;
+    }
+    
+    if (Spawned > 0 && SpawnedMonsters.Last() && SpawnedMonsters.Last()->GrowlSound)
+    {
+        UGameplayStatics::PlaySound2D(GetWorld(), SpawnedMonsters.Last()->GrowlSound, 0.9f);
+    }
+    
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red,
+            FString::Printf(TEXT("⚠️ A HORDE OF %d MONSTERS AWAKENS! RUN!"), Spawned));
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("[GameMode] Horde spawned: %d monsters (Total: %d, director: %d)"),
+           Spawned, SpawnedMonsters.Num(), Director->GetNumMonsters());
+}
+
 void AMazeGameMode::SpawnStars()
 {
 	if (!MazeManager)
@@ -1048,6 +1334,12 @@ void AMazeGameMode::PlayerWon()
 
 void AMazeGameMode::PlayerLost(const FString& Reason)
 {
+    // A stress session keeps measuring after the pack reaches the player
+    if (StressTest && StressTest->IsRunning())
+    {
+        return;
+    }
+    
     if (CurrentGameState == EGameState::Playing)
     {
         CurrentGameState = EGameState::Lost;
@@ -1081,6 +1373,12 @@ void AMazeGameMode::PlayerLost(const FString& Reason)
 
 void AMazeGameMode::ShowGameOverScreen(bool bWon)
 {
+    // Unattended runs must never stop on a paused screen
+    if (Autopilot)
+    {
+        return;
+    }
+    
     // Choose the correct widget class based on win/lose
     TSubclassOf<UUserWidget> WidgetClassToUse = bWon ? WinScreenWidgetClass : LoseScreenWidgetClass;
     
@@ -1848,6 +2146,12 @@ void AMazeGameMode::CompleteLevel()
             FString::Printf(TEXT("🎉 LEVEL %d COMPLETE! %s 🎉"), CurrentLevel, *StarText));
     }
     
+    // The autopilot picks the next run itself
+    if (Autopilot)
+    {
+        return;
+    }
+    
     // Wait 3 seconds then proceed
     FTimerHandle CompletionTimer;
     GetWorldTimerManager().SetTimer(CompletionTimer, [this]()
@@ -2446,6 +2750,12 @@ void AMazeGameMode::SpawnSecondMonster()
     
     // Spawn using existing logic
     SpawnMonster();
+    
+    // The first monster chases, this one cuts the player off at the last chokepoint before the exit
+    if (SpawnedMonsters.Num() > 1 && SpawnedMonsters.Last())
+    {
+        SpawnedMonsters.Last()->bAmbushPlayer = true;
+    }
 }
 
 void AMazeGameMode::ActivateAggressiveMode()
@@ -2507,3 +2817,280 @@ void AMazeGameMode::SetBloodMoonAtmosphere()
     }
 }
 
+void AMazeGameMode::BenchmarkPathfinding(int32 Size, int32 Iterations)
+{
+    const FString Headless = FMazePathBenchmark::RunDistanceFieldBenchmark(Size, Iterations);
+    const FString MultiSource = FMazePathBenchmark::RunMultiSourceBenchmark(Size, 64);
+    const FString Allocations = FMazePathBenchmark::RunAllocationCheck(FMath::Min(Size, 256));
+    const FString Topologies = FMazePathBenchmark::RunTopologyBenchmark(Size, Iterations);
+    const FString Weighted = FMazePathBenchmark::RunWeightedBenchmark(Size, Iterations);
+    const FString Smoothing = FMazePathBenchmark::RunSmoothingBenchmark(Size, Iterations);
+    const FString Belief = FMazePathBenchmark::RunBeliefMapBenchmark(FMath::Min(Size, 100), Iterations);
+    const FString Cooperative = FMazePathBenchmark::RunCooperativeBenchmark(FMath::Min(Size, 100), 64);
+    
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Headless);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, MultiSource);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Allocations);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Topologies);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Weighted);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Smoothing);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Belief);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Cooperative);
+    }
+    
+    // Live maze: legacy FindPathBFS (actor graph) against the bitboard path distance
+    if (!MazeManager || !Player || !MazeManager->GetEscapeCell()) return;
+    
+    AMazeCell* PlayerCell = MazeManager->GetCellAtLocation(Player->GetActorLocation());
+    AMazeCell* ExitCell = MazeManager->GetEscapeCell();
+    if (!PlayerCell) return;
+    
+    double Start = FPlatformTime::Seconds();
+    const int32 BFSLength = MazeManager->FindPathBFS(PlayerCell, ExitCell).Num() - 1;
+    const double BFSMicros = (FPlatformTime::Seconds() - Start) * 1000000.0;
+    
+    TArray<int32> Distances;
+    Start = FPlatformTime::Seconds();
+    MazeManager->ComputeDistanceField(ExitCell, Distances);
+    const double FieldMicros = (FPlatformTime::Seconds() - Start) * 1000000.0;
+    
+    // Once the queue and open set scratch are warm the returned path must be the only allocation
+    int32 BFSAllocations;
+    {
+        FMazeAllocationScope AllocationScope;
+        MazeManager->FindPathBFS(PlayerCell, ExitCell);
+        BFSAllocations = AllocationScope.GetCount();
+    }
+    
+    MazeManager->FindPathAStar(PlayerCell, ExitCell);
+    int32 AStarAllocations;
+    {
+        FMazeAllocationScope AllocationScope;
+        MazeManager->FindPathAStar(PlayerCell, ExitCell);
+        AStarAllocations = AllocationScope.GetCount();
+    }
+    
+    const bool bAllocationsPassed = BFSAllocations <= 1 && AStarAllocations <= 1;
+    const int32 PlayerIndex = MazeManager->GetCellIndex(PlayerCell);
+    const FString Live = FString::Printf(
+        TEXT("[Benchmark] Live %dx%d maze: FindPathBFS %.1f us (length %d), full distance field %.1f us (length %d), FindPathBFS %d / FindPathAStar %d allocations (1 = returned path) - %s"),
+        MazeManager->Rows, MazeManager->Cols, BFSMicros, BFSLength, FieldMicros,
+        Distances.IsValidIndex(PlayerIndex) ? Distances[PlayerIndex] : -1, BFSAllocations, AStarAllocations,
+        bAllocationsPassed ? TEXT("PASS") : TEXT("FAIL"));
+    
+    if (bAllocationsPassed)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Live);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Live);
+    }
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, bAllocationsPassed ? FColor::Cyan : FColor::Red, Live);
+    }
+}
+
+void AMazeGameMode::BenchmarkPathSuite(int32 MaxSize, int32 Queries)
+{
+    FMazeBenchmarkSuiteSettings Settings;
+    Settings.QueriesPerMaze = FMath::Max(1, Queries);
+    Settings.Sizes.RemoveAll([MaxSize](int32 Size) { return Size > MaxSize; });
+    
+    TArray<FMazeBenchmarkRow> Rows;
+    const int32 Mismatches = FMazePathBenchmarkSuite::Run(Settings, Rows);
+    const FString CsvPath = FMazePathBenchmarkSuite::GetDefaultCsvPath();
+    FMazePathBenchmarkSuite::WriteCsv(Rows, CsvPath);
+    
+    const FString Summary = FString::Printf(TEXT("[BenchmarkSuite] %d rows, %d mismatches -> %s"), Rows.Num(), Mismatches, *CsvPath);
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Summary);
+    
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, Mismatches > 0 ? FColor::Red : FColor::Cyan, Summary);
+    }
+}
+
+void AMazeGameMode::PathQueueStats()
+{
+    if (!MazeManager) return;
+    
+    const FString Stats = FString::Printf(TEXT("[PathQueue] %s"), *MazeManager->GetPathQueueStats().ToString());
+    const FString CacheStats = FString::Printf(TEXT("[PathCache] %s"), *MazeManager->GetPathCacheStats().ToString());
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Stats);
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *CacheStats);
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Stats);
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, CacheStats);
+    }
+}
+
+void AMazeGameMode::MonsterLODStats()
+{
+    static const TCHAR* TierNames[FMonsterLODStats::NumTiers] = { TEXT("Full"), TEXT("Reduced"), TEXT("Dormant") };
+    
+    TArray<AActor*> FoundMonsters;
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMonsterAI::StaticClass(), FoundMonsters);
+    
+    int32 Monsters[FMonsterLODStats::NumTiers] = {};
+    FMonsterLODStats Total;
+    for (AActor* Actor : FoundMonsters)
+    {
+        AMonsterAI* Monster = Cast<AMonsterAI>(Actor);
+        if (!Monster) continue;
+        
+        Monsters[static_cast<int32>(Monster->GetAILOD())]++;
+        const FMonsterLODStats& Stats = Monster->GetLODStats();
+        for (int32 Tier = 0; Tier < FMonsterLODStats::NumTiers; Tier++)
+        {
+            Total.Ticks[Tier] += Stats.Ticks[Tier];
+            Total.TickSeconds[Tier] += Stats.TickSeconds[Tier];
+            Total.TierSeconds[Tier] += Stats.TierSeconds[Tier];
+        }
+        Monster->ResetLODStats();
+    }
+    
+    for (int32 Tier = 0; Tier < FMonsterLODStats::NumTiers; Tier++)
+    {
+        // Per monster per second of game time: what one more monster in this tier costs
+        const double MicrosPerTick = Total.Ticks[Tier] > 0 ? Total.TickSeconds[Tier] * 1000000.0 / Total.Ticks[Tier] : 0.0;
+        const double MicrosPerSecond = Total.TierSeconds[Tier] > 0.0 ? Total.TickSeconds[Tier] * 1000000.0 / Total.TierSeconds[Tier] : 0.0;
+        
+        const FString Line = FString::Printf(TEXT("[MonsterLOD] %-7s %d monsters, %d ticks, %.1f us per tick, %.1f us per monster-second"),
+                                             TierNames[Tier], Monsters[Tier], Total.Ticks[Tier], MicrosPerTick, MicrosPerSecond);
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Line);
+        if (GEngine)
+        {
+            GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Line);
+        }
+    }
+    
+    if (MonsterDirector)
+    {
+        const FString Line = FString::Printf(TEXT("[MonsterDirector] %d monsters, %.3f ms last batched step"),
+                                             MonsterDirector->GetNumMonsters(), MonsterDirector->GetLastStepMilliseconds());
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Line);
+        if (GEngine)
+        {
+            GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Line);
+        }
+    }
+}
+
+void AMazeGameMode::ShowChokepoints()
+{
+    if (!MazeManager || !Player) return;
+    
+    const FMazeChokepoints& Chokepoints = MazeManager->GetChokepoints();
+    const int32 PlayerIndex = MazeManager->GetCellIndex(MazeManager->GetCellAtLocation(Player->GetActorLocation()));
+    const FVector Extent(MazeManager->CellSize * 0.3f, MazeManager->CellSize * 0.3f, 20.0f);
+    
+    for (int32 Index = 0; Index < MazeManager->NavGrid.Num(); Index++)
+    {
+        if (Chokepoints.IsChokepoint(Index))
+        {
+            if (AMazeCell* Cell = MazeManager->GetCellByIndex(Index))
+            {
+                DrawDebugBox(GetWorld(), Cell->GetActorLocation(), Extent, FColor::Red, false, 10.0f, 0, 8.0f);
+            }
+        }
+    }
+    
+    // The player's forced cells in the order they will be passed
+    for (int32 Index = Chokepoints.GetNextChokepoint(PlayerIndex); Index != INDEX_NONE; Index = Chokepoints.GetNextChokepoint(Index))
+    {
+        if (AMazeCell* Cell = MazeManager->GetCellByIndex(Index))
+        {
+            DrawDebugBox(GetWorld(), Cell->GetActorLocation(), Extent * 1.2f, FColor::Yellow, false, 10.0f, 0, 12.0f);
+        }
+    }
+    
+    const FString Line = FString::Printf(TEXT("[Chokepoints] %d articulation cells, %d bridges, %d on every route from the player to the exit (ambush at %d)"),
+                                         Chokepoints.GetNumArticulationPoints(), Chokepoints.GetNumBridges(),
+                                         Chokepoints.GetNumChokepointsToExit(PlayerIndex), Chokepoints.GetLastChokepoint(PlayerIndex));
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Line);
+    if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Line);
+    }
+}
+
+void AMazeGameMode::SimulateLevels(int32 Runs)
+{
+    // The live table when there is one, so tweaks made in the editor are what gets simulated
+    TArray<FLevelConfig> LevelConfigs;
+    if (LevelManager && LevelManager->LevelConfigs.Num() > 0)
+    {
+        LevelConfigs = LevelManager->LevelConfigs;
+    }
+    else
+    {
+        ALevelProgressionManager::BuildDefaultLevelConfigs(LevelConfigs);
+    }
+    
+    FMazeSimSweepSettings Settings;
+    Settings.RunsPerPoint = FMath::Max(1, Runs);
+    
+    TArray<FMazeSimSweepRow> Rows;
+    const double SpeedUp = FMazeLevelSimulationSweep::Run(LevelConfigs, Settings, Rows);
+    const FString CsvPath = FMazeLevelSimulationSweep::GetDefaultCsvPath();
+    FMazeLevelSimulationSweep::WriteCsv(Rows, CsvPath);
+    
+    // The shipped values of each level on screen, the whole sweep in the CSV
+    TArray<FString> Lines;
+    for (const FLevelConfig& Config : LevelConfigs)
+    {
+        for (const FMazeSimSweepRow& Row : Rows)
+        {
+            if (Row.Level == Config.LevelNumber && Row.TimeLimit == Config.TimeLimit &&
+                Row.MonsterSpeed == Config.MonsterSpeed && Row.MonsterSpawnDelay == Config.MonsterSpawnDelay &&
+                Row.OneStarTime == Config.OneStarTime && Row.ThreeStarTime == Config.ThreeStarTime)
+            {
+                Lines.Add(FString::Printf(TEXT("[LevelSimulation] Level %d: win %.0f%%, caught %.0f%% (median %.0f s), stars 0/1/2/3 = %d/%d/%d/%d"),
+                                          Row.Level, Row.WinRate * 100.0f, Row.CatchRate * 100.0f, Row.CatchP50,
+                                          Row.StarCounts[0], Row.StarCounts[1], Row.StarCounts[2], Row.StarCounts[3]));
+                break;
+            }
+        }
+    }
+    Lines.Add(FString::Printf(TEXT("[LevelSimulation] %d points x %d runs at %.0fx real time -> %s"), Rows.Num(), Settings.RunsPerPoint, SpeedUp, *CsvPath));
+    
+    for (const FString& Line : Lines)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Line);
+        if (GEngine)
+        {
+            GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Line);
+        }
+    }
+}
+
+void AMazeGameMode::RunStressTest(int32 MaxMonsters, int32 MazeSize, int32 NumHazards)
+{
+    if (StressTest && StressTest->IsRunning())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[StressTest] Already running"));
+        return;
+    }
+    
+    if (!StressTest)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        StressTest = GetWorld()->SpawnActor<AMazeStressTest>(AMazeStressTest::StaticClass(), FTransform::Identity, SpawnParams);
+    }
+    
+    if (StressTest)
+    {
+        StressTest->Begin(this, MaxMonsters, MazeSize, NumHazards);
+        if (GEngine)
+        {
+            GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan,
+                TEXT("[StressTest] Running, the scaling curve goes to Saved/Benchmarks when it is done"));
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// MazeGridMovementComponent.cpp
+#include "MazeGridMovementComponent.h"
+#include "MazeManager.h"
+#include "MazeGrid.h"
+#include "MazeWallAvoidance.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UMazeGridMovementComponent::UMazeGridMovementComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+
+    MazeManager = nullptr;
+    WaypointIndex = 0;
+    Velocity = FVector2D::ZeroVector;
+    CurrentSpeed = 0.0f;
+}
+
+void UMazeGridMovementComponent::SetWaypoints(const TArray<FVector>& InWaypoints)
+{
+    // Same buffer every replan, no allocation once it is as long as the longest path
+    Waypoints.Reset(InWaypoints.Num());
+    for (const FVector& Waypoint : InWaypoints)
+    {
+        Waypoints.Add(FVector2D(Waypoint.X, Waypoint.Y));
+    }
+    WaypointIndex = 0;
+}
+
+void UMazeGridMovementComponent::ClearWaypoints()
+{
+    Waypoints.Reset();
+    WaypointIndex = 0;
+    Velocity = FVector2D::ZeroVector;
+    CurrentSpeed = 0.0f;
+    PublishVelocity();
+}
+
+float UMazeGridMovementComponent::GetMaxSpeed() const
+{
+    if (const ACharacter* Character = Cast<ACharacter>(GetOwner()))
+    {
+        if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+        {
+            return Movement->MaxWalkSpeed;
+        }
+    }
+    return MaxSpeed;
+}
+
+void UMazeGridMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    AActor* Owner = GetOwner();
+    if (!Owner || DeltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    if (WaypointIndex >= Waypoints.Num())
+    {
+        if (!Velocity.IsZero())
+        {
+            Velocity = FVector2D::ZeroVector;
+            CurrentSpeed = 0.0f;
+            PublishVelocity();
+        }
+        return;
+    }
+
+    const FVector Location = Owner->GetActorLocation();
+    FVector2D Position(Location.X, Location.Y);
+
+    // Walk the polyline itself rather than integrating a velocity towards the next point: a long
+    // tick (low LOD tick intervals) cannot overshoot a corner into the wall behind it
+    CurrentSpeed = FMath::Min(CurrentSpeed + MaxAcceleration * DeltaTime, GetMaxSpeed());
+    double Budget = CurrentSpeed * DeltaTime;
+    FVector2D Heading = FVector2D::ZeroVector;
+
+    while (Budget > 0.0 && WaypointIndex < Waypoints.Num())
+    {
+        const FVector2D ToWaypoint = Waypoints[WaypointIndex] - Position;
+        const double Distance = ToWaypoint.Size();
+        if (Distance > UE_KINDA_SMALL_NUMBER)
+        {
+            Heading = ToWaypoint / Distance;
+        }
+
+        if (Distance <= Budget)
+        {
+            Position = Waypoints[WaypointIndex];
+            Budget -= Distance;
+            WaypointIndex++;
+        }
+        else
+        {
+            Position += Heading * Budget;
+            Budget = 0.0;
+        }
+    }
+
+    Velocity = WaypointIndex < Waypoints.Num() ? Heading * CurrentSpeed : FVector2D::ZeroVector;
+    if (Velocity.IsZero())
+    {
+        CurrentSpeed = 0.0f;
+    }
+
+    // Waypoints are cell centers or wall-clear string-pulled corners, so this only bites when the
+    // owner was put somewhere off the line (spawn, teleport, a path that no longer matches the walls).
+    // The cell is the one the owner ends up in: a long tick may have walked it into the next one.
+    if (MazeManager && MazeManager->CellSize > 0.0f)
+    {
+        const FMazeGrid& Grid = MazeManager->NavGrid;
+        const float CellSize = MazeManager->CellSize;
+        const int32 Row = FMath::RoundToInt(Position.X / CellSize);
+        const int32 Col = FMath::RoundToInt(Position.Y / CellSize);
+        if (Grid.IsValid(Row, Col))
+        {
+            const float Reach = FMath::Max(CellSize * 0.5f - WallInset - BodyRadius, 0.0f);
+            FMazeWallAvoidance::ClampToCell(Grid, CellSize, Row, Col, Reach, Position, Velocity);
+        }
+    }
+
+    FRotator Rotation = Owner->GetActorRotation();
+    if (!Heading.IsZero())
+    {
+        const float TargetYaw = FMath::RadiansToDegrees(FMath::Atan2(Heading.Y, Heading.X));
+        Rotation = FRotator(0.0f, FMath::FixedTurn(Rotation.Yaw, TargetYaw, RotationRate * DeltaTime), 0.0f);
+    }
+
+    // One transform update, no sweep
+    Owner->SetActorLocationAndRotation(FVector(Position.X, Position.Y, Location.Z), Rotation);
+    PublishVelocity();
+}
+
+void UMazeGridMovementComponent::PublishVelocity() const
+{
+    // The animation blueprint reads GetVelocity(): a character answers it from its (not ticking)
+    // character movement, other actors from the root component
+    const FVector Velocity3D = GetMoveVelocity();
+    if (const ACharacter* Character = Cast<ACharacter>(GetOwner()))
+    {
+        if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+        {
+            Movement->Velocity = Velocity3D;
+            return;
+        }
+    }
+    if (USceneComponent* Root = GetOwner() ? GetOwner()->GetRootComponent() : nullptr)
+    {
+        Root->ComponentVelocity = Velocity3D;
+    }
+}
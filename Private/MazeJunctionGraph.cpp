@@ -0,0 +1,518 @@
+// MazeJunctionGraph.cpp
+#include "MazeJunctionGraph.h"
+#include "MazeGrid.h"
+#include "Algo/Reverse.h"
+
+FMazeJunctionGraph::FMazeJunctionGraph()
+{
+    NumNodes = 0;
+    CurrentStamp = 0;
+    LastNodesExpanded = 0;
+}
+
+void FMazeJunctionGraph::Build(const FMazeGrid& Grid)
+{
+    const int32 NumCells = Grid.Num();
+
+    Edges.Reset();
+    FreeEdges.Reset();
+    NodeFlags.Init(0, NumCells);
+    NodeEdges.Init(INDEX_NONE, NumCells * FMazeGrid::NumDirections);
+    CellEdge.Init(INDEX_NONE, NumCells);
+    CellOffset.Init(0, NumCells);
+    NumNodes = 0;
+
+    SearchStamp.Init(0, NumCells);
+    SearchCost.SetNumUninitialized(NumCells);
+    ParentNode.SetNumUninitialized(NumCells);
+    ParentEdge.SetNumUninitialized(NumCells);
+    CurrentStamp = 0;
+
+    // Junctions (3-4 openings), dead ends (1) and sealed cells (0) become nodes
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        if (Grid.CountOpenings(Index) != 2)
+        {
+            SetNode(Index, true);
+        }
+    }
+
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        if (IsNode(Index))
+        {
+            TraceAllFrom(Grid, Index);
+        }
+    }
+
+    // Pure corridor rings have no junction at all - anchor them on one of their cells
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        if (!IsNode(Index) && CellEdge[Index] == INDEX_NONE)
+        {
+            SetNode(Index, true);
+            TraceAllFrom(Grid, Index);
+        }
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("[JunctionGraph] Built %d nodes / %d corridors from %d cells"),
+           NumNodes, GetNumEdges(), NumCells);
+}
+
+void FMazeJunctionGraph::UpdateCells(const FMazeGrid& Grid, TArrayView<const int32> ChangedCells)
+{
+    if (!IsBuilt() || NodeFlags.Num() != Grid.Num())
+    {
+        Build(Grid);
+        return;
+    }
+
+    // A wall change alters the opening count of the cell and of the neighbor across that wall
+    TArray<int32, TInlineAllocator<32>> DirtyCells;
+    for (int32 Changed : ChangedCells)
+    {
+        if (!Grid.WallMasks.IsValidIndex(Changed))
+        {
+            continue;
+        }
+
+        DirtyCells.AddUnique(Changed);
+
+        const int32 Row = Grid.GetRow(Changed);
+        const int32 Col = Grid.GetCol(Changed);
+        for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+        {
+            const int32 NeighborRow = Row + FMazeGrid::RowDelta[Dir];
+            const int32 NeighborCol = Col + FMazeGrid::ColDelta[Dir];
+            if (Grid.IsValid(NeighborRow, NeighborCol))
+            {
+                DirtyCells.AddUnique(Grid.ToIndex(NeighborRow, NeighborCol));
+            }
+        }
+    }
+
+    // Drop every corridor that touches a dirty cell
+    TArray<int32, TInlineAllocator<16>> KilledEdges;
+    for (int32 Cell : DirtyCells)
+    {
+        if (IsNode(Cell))
+        {
+            for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+            {
+                const int32 EdgeId = NodeEdges[Cell * FMazeGrid::NumDirections + Dir];
+                if (EdgeId != INDEX_NONE)
+                {
+                    KilledEdges.AddUnique(EdgeId);
+                }
+            }
+        }
+        else if (CellEdge[Cell] != INDEX_NONE)
+        {
+            KilledEdges.AddUnique(CellEdge[Cell]);
+        }
+    }
+
+    TArray<int32, TInlineAllocator<32>> SeedNodes;
+    TArray<int32, TInlineAllocator<64>> LooseCells;
+    for (int32 EdgeId : KilledEdges)
+    {
+        SeedNodes.AddUnique(Edges[EdgeId].NodeA);
+        SeedNodes.AddUnique(Edges[EdgeId].NodeB);
+        LooseCells.Append(Edges[EdgeId].Cells);
+        KillEdge(EdgeId);
+    }
+
+    // Re-classify the dirty cells, then re-trace corridors from everything on the border
+    for (int32 Cell : DirtyCells)
+    {
+        SetNode(Cell, Grid.CountOpenings(Cell) != 2);
+        LooseCells.Add(Cell);
+    }
+
+    for (int32 Seed : SeedNodes)
+    {
+        if (IsNode(Seed))
+        {
+            TraceAllFrom(Grid, Seed);
+        }
+    }
+
+    for (int32 Cell : DirtyCells)
+    {
+        if (IsNode(Cell))
+        {
+            TraceAllFrom(Grid, Cell);
+        }
+    }
+
+    // Anything still unassigned is part of a ring that lost its junctions
+    for (int32 Cell : LooseCells)
+    {
+        if (!IsNode(Cell) && CellEdge[Cell] == INDEX_NONE)
+        {
+            SetNode(Cell, true);
+            TraceAllFrom(Grid, Cell);
+        }
+    }
+}
+
+bool FMazeJunctionGraph::FindPath(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath)
+{
+    OutPath.Reset();
+    LastNodesExpanded = 0;
+
+    if (!IsBuilt() || NodeFlags.Num() != Grid.Num() ||
+        !NodeFlags.IsValidIndex(StartIndex) || !NodeFlags.IsValidIndex(GoalIndex))
+    {
+        return false;
+    }
+
+    if (StartIndex == GoalIndex)
+    {
+        OutPath.Add(StartIndex);
+        return true;
+    }
+
+    const bool bStartIsNode = IsNode(StartIndex);
+    const bool bGoalIsNode = IsNode(GoalIndex);
+    const int32 StartEdge = bStartIsNode ? INDEX_NONE : CellEdge[StartIndex];
+    const int32 GoalEdge = bGoalIsNode ? INDEX_NONE : CellEdge[GoalIndex];
+
+    if ((!bStartIsNode && StartEdge == INDEX_NONE) || (!bGoalIsNode && GoalEdge == INDEX_NONE))
+    {
+        return false;
+    }
+
+    CurrentStamp++;
+    if (CurrentStamp == 0)
+    {
+        FMemory::Memzero(SearchStamp.GetData(), SearchStamp.Num() * sizeof(uint32));
+        CurrentStamp = 1;
+    }
+    OpenHeap.Reset();
+
+    int32 BestCost = MAX_int32;
+    int32 BestGoalNode = INDEX_NONE;
+    bool bDirectCorridor = false;
+
+    auto PushNode = [this, &Grid, GoalIndex](int32 Node, int32 Cost, int32 FromNode, int32 ViaEdge)
+    {
+        if (SearchStamp[Node] == CurrentStamp && SearchCost[Node] <= Cost)
+        {
+            return;
+        }
+
+        SearchStamp[Node] = CurrentStamp;
+        SearchCost[Node] = Cost;
+        ParentNode[Node] = FromNode;
+        ParentEdge[Node] = ViaEdge;
+        OpenHeap.HeapPush(FOpenEntry{ Cost + Grid.GetManhattanDistance(Node, GoalIndex), Cost, Node });
+    };
+
+    if (bStartIsNode)
+    {
+        PushNode(StartIndex, 0, INDEX_NONE, INDEX_NONE);
+    }
+    else
+    {
+        // Start inside a corridor: both of its ends are entry points
+        const FCorridorEdge& Edge = Edges[StartEdge];
+        const int32 Offset = CellOffset[StartIndex];
+        PushNode(Edge.NodeA, Offset, INDEX_NONE, StartEdge);
+        PushNode(Edge.NodeB, Edge.Length() - Offset, INDEX_NONE, StartEdge);
+
+        if (StartEdge == GoalEdge)
+        {
+            BestCost = FMath::Abs(Offset - CellOffset[GoalIndex]);
+            bDirectCorridor = true;
+        }
+    }
+
+    while (OpenHeap.Num() > 0)
+    {
+        FOpenEntry Entry;
+        OpenHeap.HeapPop(Entry);
+
+        if (Entry.F >= BestCost)
+        {
+            break;
+        }
+
+        if (Entry.G != SearchCost[Entry.Node])
+        {
+            continue;  // Stale entry
+        }
+
+        LastNodesExpanded++;
+        const int32 Node = Entry.Node;
+
+        if (bGoalIsNode)
+        {
+            if (Node == GoalIndex)
+            {
+                BestCost = Entry.G;
+                BestGoalNode = Node;
+                bDirectCorridor = false;
+                break;
+            }
+        }
+        else
+        {
+            // Goal inside a corridor: it can be entered from either end
+            const FCorridorEdge& Edge = Edges[GoalEdge];
+            const int32 Offset = CellOffset[GoalIndex];
+            if (Edge.NodeA == Node && Entry.G + Offset < BestCost)
+            {
+                BestCost = Entry.G + Offset;
+                BestGoalNode = Node;
+                bDirectCorridor = false;
+            }
+            if (Edge.NodeB == Node && Entry.G + Edge.Length() - Offset < BestCost)
+            {
+                BestCost = Entry.G + Edge.Length() - Offset;
+                BestGoalNode = Node;
+                bDirectCorridor = false;
+            }
+        }
+
+        uint32 OpenDirs = Grid.GetOpenMask(Node);
+        while (OpenDirs)
+        {
+            const int32 Dir = FMath::CountTrailingZeros(OpenDirs);
+            OpenDirs &= OpenDirs - 1;
+
+            const int32 EdgeId = NodeEdges[Node * FMazeGrid::NumDirections + Dir];
+            if (EdgeId == INDEX_NONE)
+            {
+                continue;
+            }
+
+            const FCorridorEdge& Edge = Edges[EdgeId];
+            const int32 Other = (Edge.NodeA == Node && Edge.DirA == Dir) ? Edge.NodeB : Edge.NodeA;
+            PushNode(Other, Entry.G + Edge.Length(), Node, EdgeId);
+        }
+    }
+
+    if (BestCost == MAX_int32)
+    {
+        return false;
+    }
+
+    // ==================== CORRIDOR REFINEMENT ====================
+
+    if (bDirectCorridor)
+    {
+        const FCorridorEdge& Edge = Edges[StartEdge];
+        const int32 From = CellOffset[StartIndex];
+        const int32 To = CellOffset[GoalIndex];
+        const int32 Step = To > From ? 1 : -1;
+        for (int32 Offset = From; ; Offset += Step)
+        {
+            OutPath.Add(Edge.Cells[Offset - 1]);
+            if (Offset == To)
+            {
+                break;
+            }
+        }
+        return true;
+    }
+
+    TArray<int32>& NodeChain = NodeChainScratch;
+    NodeChain.Reset();
+    for (int32 Node = BestGoalNode; Node != INDEX_NONE; Node = ParentNode[Node])
+    {
+        NodeChain.Add(Node);
+    }
+    Algo::Reverse(NodeChain);
+
+    const int32 RootNode = NodeChain[0];
+
+    // Start corridor up to the first junction
+    if (!bStartIsNode)
+    {
+        const FCorridorEdge& Edge = Edges[StartEdge];
+        const int32 Offset = CellOffset[StartIndex];
+
+        bool bTowardA = (RootNode == Edge.NodeA);
+        if (Edge.NodeA == Edge.NodeB)
+        {
+            bTowardA = Offset <= Edge.Length() - Offset;
+        }
+
+        OutPath.Add(StartIndex);
+        if (bTowardA)
+        {
+            for (int32 i = Offset - 2; i >= 0; i--)
+            {
+                OutPath.Add(Edge.Cells[i]);
+            }
+        }
+        else
+        {
+            for (int32 i = Offset; i < Edge.Cells.Num(); i++)
+            {
+                OutPath.Add(Edge.Cells[i]);
+            }
+        }
+    }
+    OutPath.Add(RootNode);
+
+    // Junction-to-junction corridors
+    for (int32 i = 1; i < NodeChain.Num(); i++)
+    {
+        AppendCorridor(Edges[ParentEdge[NodeChain[i]]], NodeChain[i - 1], OutPath);
+        OutPath.Add(NodeChain[i]);
+    }
+
+    // Last junction into the goal corridor
+    if (!bGoalIsNode)
+    {
+        const FCorridorEdge& Edge = Edges[GoalEdge];
+        const int32 Offset = CellOffset[GoalIndex];
+
+        bool bFromA = (BestGoalNode == Edge.NodeA);
+        if (Edge.NodeA == Edge.NodeB)
+        {
+            bFromA = Offset <= Edge.Length() - Offset;
+        }
+
+        if (bFromA)
+        {
+            for (int32 i = 0; i < Offset; i++)
+            {
+                OutPath.Add(Edge.Cells[i]);
+            }
+        }
+        else
+        {
+            for (int32 i = Edge.Cells.Num() - 1; i >= Offset - 1; i--)
+            {
+                OutPath.Add(Edge.Cells[i]);
+            }
+        }
+    }
+
+    return true;
+}
+
+void FMazeJunctionGraph::SetNode(int32 Index, bool bNode)
+{
+    const uint8 NewFlag = bNode ? 1 : 0;
+    if (NodeFlags[Index] != NewFlag)
+    {
+        NodeFlags[Index] = NewFlag;
+        NumNodes += bNode ? 1 : -1;
+    }
+}
+
+int32 FMazeJunctionGraph::AllocateEdge()
+{
+    const int32 EdgeId = FreeEdges.Num() > 0 ? FreeEdges.Pop() : Edges.AddDefaulted();
+
+    FCorridorEdge& Edge = Edges[EdgeId];
+    Edge.NodeA = INDEX_NONE;
+    Edge.NodeB = INDEX_NONE;
+    Edge.Cells.Reset();
+    Edge.bAlive = true;
+    return EdgeId;
+}
+
+void FMazeJunctionGraph::KillEdge(int32 EdgeId)
+{
+    FCorridorEdge& Edge = Edges[EdgeId];
+    if (!Edge.bAlive)
+    {
+        return;
+    }
+
+    for (int32 Cell : Edge.Cells)
+    {
+        if (CellEdge[Cell] == EdgeId)
+        {
+            CellEdge[Cell] = INDEX_NONE;
+        }
+    }
+
+    int32& SlotA = NodeEdges[Edge.NodeA * FMazeGrid::NumDirections + Edge.DirA];
+    if (SlotA == EdgeId)
+    {
+        SlotA = INDEX_NONE;
+    }
+
+    int32& SlotB = NodeEdges[Edge.NodeB * FMazeGrid::NumDirections + Edge.DirB];
+    if (SlotB == EdgeId)
+    {
+        SlotB = INDEX_NONE;
+    }
+
+    Edge.Cells.Reset();
+    Edge.bAlive = false;
+    FreeEdges.Add(EdgeId);
+}
+
+void FMazeJunctionGraph::TraceEdge(const FMazeGrid& Grid, int32 Node, int32 Dir)
+{
+    const int32 EdgeId = AllocateEdge();
+    FCorridorEdge& Edge = Edges[EdgeId];
+    Edge.NodeA = Node;
+    Edge.DirA = Dir;
+
+    int32 Current = Grid.GetNeighborIndex(Node, Dir);
+    int32 CameFrom = FMazeGrid::Opposite(Dir);
+
+    // Walk the corridor until the next junction / dead end
+    while (!IsNode(Current))
+    {
+        if (Grid.CountOpenings(Current) != 2)
+        {
+            // Classification is stale - promote and stop here
+            SetNode(Current, true);
+            break;
+        }
+
+        CellEdge[Current] = EdgeId;
+        CellOffset[Current] = Edge.Cells.Num() + 1;
+        Edge.Cells.Add(Current);
+
+        const uint32 Onward = Grid.GetOpenMask(Current) & ~(1u << CameFrom);
+        const int32 NextDir = FMath::CountTrailingZeros(Onward);
+        Current = Grid.GetNeighborIndex(Current, NextDir);
+        CameFrom = FMazeGrid::Opposite(NextDir);
+    }
+
+    Edge.NodeB = Current;
+    Edge.DirB = CameFrom;
+
+    NodeEdges[Node * FMazeGrid::NumDirections + Dir] = EdgeId;
+    NodeEdges[Current * FMazeGrid::NumDirections + CameFrom] = EdgeId;
+}
+
+void FMazeJunctionGraph::TraceAllFrom(const FMazeGrid& Grid, int32 Node)
+{
+    uint32 OpenDirs = Grid.GetOpenMask(Node);
+    while (OpenDirs)
+    {
+        const int32 Dir = FMath::CountTrailingZeros(OpenDirs);
+        OpenDirs &= OpenDirs - 1;
+
+        if (NodeEdges[Node * FMazeGrid::NumDirections + Dir] == INDEX_NONE)
+        {
+            TraceEdge(Grid, Node, Dir);
+        }
+    }
+}
+
+void FMazeJunctionGraph::AppendCorridor(const FCorridorEdge& Edge, int32 FromNode, TArray<int32>& OutPath) const
+{
+    if (Edge.NodeA == FromNode)
+    {
+        OutPath.Append(Edge.Cells);
+    }
+    else
+    {
+        for (int32 i = Edge.Cells.Num() - 1; i >= 0; i--)
+        {
+            OutPath.Add(Edge.Cells[i]);
+        }
+    }
+}
@@ -0,0 +1,555 @@
+// MazeLevelSimulation.cpp
+#include "MazeLevelSimulation.h"
+#include "MazePathBenchmark.h"
+#include "MazePerception.h"
+#include "LevelProgressionManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    // Nearest-rank percentile of sorted samples
+    float Percentile(const TArray<float>& Sorted, float Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0f;
+        }
+        const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+}
+
+FMazeLevelSimulation::FMazeLevelSimulation()
+    : ExitIndex(INDEX_NONE)
+    , StarIndex(INDEX_NONE)
+    , bExitKnown(false)
+    , bStarSeen(false)
+{
+}
+
+int32 FMazeLevelSimulation::CalculateStars(const FLevelConfig& Config, float CompletionTime)
+{
+    if (CompletionTime <= Config.ThreeStarTime)
+    {
+        return 3;
+    }
+    else if (CompletionTime <= Config.TwoStarTime)
+    {
+        return 2;
+    }
+    else if (CompletionTime <= Config.OneStarTime)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+void FMazeLevelSimulation::ComputeDistances(int32 SourceIndex, TArray<int32>& OutDistances)
+{
+    OutDistances.Init(-1, Grid.Num());
+    if (SourceIndex < 0 || SourceIndex >= Grid.Num())
+    {
+        return;
+    }
+
+    // Every cell is queued once, so a flat array with a read cursor is the whole queue
+    Queue.Reset();
+    Queue.Add(SourceIndex);
+    OutDistances[SourceIndex] = 0;
+
+    for (int32 Head = 0; Head < Queue.Num(); Head++)
+    {
+        const int32 Current = Queue[Head];
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+        {
+            if (OutDistances[Neighbor.Index] < 0)
+            {
+                OutDistances[Neighbor.Index] = OutDistances[Current] + 1;
+                Queue.Add(Neighbor.Index);
+            }
+        }
+    }
+}
+
+int32 FMazeLevelSimulation::GetDownhillNeighbor(int32 CellIndex, const TArray<int32>& Distances) const
+{
+    if (Distances[CellIndex] <= 0)
+    {
+        return INDEX_NONE;
+    }
+
+    for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(CellIndex))
+    {
+        if (Distances[Neighbor.Index] == Distances[CellIndex] - 1)
+        {
+            return Neighbor.Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FMazeLevelSimulation::PickSpawnCell(FRandomStream& Random, const TArray<int32>& Distances, int32 MinCells, int32 ExcludeIndex) const
+{
+    int32 Cell = INDEX_NONE;
+    for (int32 Attempt = 0; Attempt < 100; Attempt++)
+    {
+        Cell = Random.RandRange(0, Grid.Num() - 1);
+        if (Cell != ExcludeIndex && Distances[Cell] >= MinCells)
+        {
+            break;
+        }
+    }
+    return Cell;
+}
+
+FVector2D FMazeLevelSimulation::GetPosition(const FAgent& Agent, float CellSize) const
+{
+    const FVector2D From(Grid.GetCol(Agent.Cell), Grid.GetRow(Agent.Cell));
+    if (Agent.Next == INDEX_NONE)
+    {
+        return From * CellSize;
+    }
+
+    const FVector2D To(Grid.GetCol(Agent.Next), Grid.GetRow(Agent.Next));
+    return FMath::Lerp(From, To, Agent.Progress) * CellSize;
+}
+
+int32 FMazeLevelSimulation::ChoosePlayerStep(FRandomStream& Random, const FMazeSimSettings& Settings, int32 Cell)
+{
+    if (!bExitKnown)
+    {
+        FMazePerception::GatherVisibleCells(Grid, Cell, Settings.PlayerSightRange, VisibleCells);
+        for (const int32 Visible : VisibleCells)
+        {
+            bExitKnown |= Visible == ExitIndex;
+            bStarSeen |= Visible == StarIndex;
+        }
+    }
+
+    if (bExitKnown)
+    {
+        return GetDownhillNeighbor(Cell, ExitDistances);
+    }
+    if (bStarSeen)
+    {
+        return GetDownhillNeighbor(Cell, StarDistances);
+    }
+
+    // Depth-first exploration: a random passage not walked yet, otherwise back the way we came.
+    // The bot only explores while it knows nothing, so Cell is always the top of its stack.
+    int32 Options[FMazeGrid::NumDirections];
+    int32 NumOptions = 0;
+    for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+    {
+        if (!Visited[Neighbor.Index])
+        {
+            Options[NumOptions++] = Neighbor.Index;
+        }
+    }
+
+    if (NumOptions > 0)
+    {
+        const int32 Next = Options[Random.RandRange(0, NumOptions - 1)];
+        Visited[Next] = 1;
+        ExploreStack.Add(Next);
+        return Next;
+    }
+
+    if (ExploreStack.Num() > 1)
+    {
+        ExploreStack.Pop();
+        return ExploreStack.Last();
+    }
+
+    // Walked everything without seeing the exit (only with a tiny sight range)
+    bExitKnown = true;
+    return GetDownhillNeighbor(Cell, ExitDistances);
+}
+
+FMazeSimResult FMazeLevelSimulation::Run(const FLevelConfig& Config, const FMazeSimSettings& Settings, int32 Seed)
+{
+    FMazeSimResult Result;
+    FRandomStream Random(Seed);
+
+    FMazePathBenchmark::GenerateGrid(Grid, FMath::Max(Config.MazeRows, 2), FMath::Max(Config.MazeCols, 2), Config.LoopProbability,
+                                     Random.RandHelper(MAX_int32));
+    const int32 NumCells = Grid.Num();
+
+    // Exit on the outer edge, player far enough from it by walking distance (AMazeManager, SpawnPlayer)
+    do
+    {
+        ExitIndex = Random.RandRange(0, NumCells - 1);
+    } while (Grid.GetRow(ExitIndex) != 0 && Grid.GetRow(ExitIndex) != Grid.Rows - 1 &&
+             Grid.GetCol(ExitIndex) != 0 && Grid.GetCol(ExitIndex) != Grid.Cols - 1);
+
+    ComputeDistances(ExitIndex, ExitDistances);
+    const int32 StartIndex = PickSpawnCell(Random, ExitDistances, Settings.MinPlayerExitCells, ExitIndex);
+
+    // The star and both monster spawns keep their distance from where the player started
+    ComputeDistances(StartIndex, PlayerDistances);
+    StarIndex = Config.bEnableGoldenStar ? PickSpawnCell(Random, PlayerDistances, Settings.MinStarPlayerCells, ExitIndex) : INDEX_NONE;
+    const int32 MonsterSpawns[2] =
+    {
+        PickSpawnCell(Random, PlayerDistances, Settings.MinMonsterPlayerCells, ExitIndex),
+        PickSpawnCell(Random, PlayerDistances, Settings.MinMonsterPlayerCells, ExitIndex)
+    };
+    if (StarIndex != INDEX_NONE)
+    {
+        ComputeDistances(StarIndex, StarDistances);
+    }
+
+    // Mud patches land on random non-exit cells, trap cells only come with them (StartLevel).
+    // bEnableMazeTraps is the retired trap system and spawns nothing in the game either.
+    MudCells.Init(0, NumCells);
+    TrapCells.Init(0, NumCells);
+    for (int32 Patch = 0; Patch < Config.NumMuddyPatches; Patch++)
+    {
+        const int32 Cell = Random.RandRange(0, NumCells - 1);
+        if (Cell != ExitIndex)
+        {
+            MudCells[Cell] = 1;
+        }
+    }
+    if (Config.NumMuddyPatches > 0)
+    {
+        for (int32 Trap = 0; Trap < FMath::Min(Config.NumTrapCells, NumCells - 2); Trap++)
+        {
+            int32 Cell;
+            do
+            {
+                Cell = Random.RandRange(0, NumCells - 1);
+            } while (Cell == ExitIndex || Cell == StartIndex || TrapCells[Cell]);
+            TrapCells[Cell] = 1;
+        }
+    }
+
+    Visited.Init(0, NumCells);
+    Visited[StartIndex] = 1;
+    ExploreStack.Reset();
+    ExploreStack.Add(StartIndex);
+    bExitKnown = Settings.bPlayerKnowsExit;
+    bStarSeen = false;
+
+    FAgent Player;
+    Player.Cell = StartIndex;
+    Player.Speed = Settings.PlayerSpeed;
+
+    TArray<FAgent, TInlineAllocator<2>> Monsters;
+    const bool bMonsters = Config.bEnableMonster && Config.MonsterSpawnDelay >= 0.0f;
+    bool bFirstSpawned = false;
+    bool bSecondSpawned = false;
+    bool bFinalBoost = false;
+    bool bAggressive = false;
+
+    float MudTimer = 0.0f;
+    float TrapTimer = 0.0f;
+    float Time = 0.0f;
+
+    while (true)
+    {
+        const float RemainingTime = Config.TimeLimit - Time;
+
+        // ==================== SPAWNS AND SPEED-UPS ====================
+        if (bMonsters && !bFirstSpawned && Time >= Config.MonsterSpawnDelay)
+        {
+            FAgent Monster;
+            Monster.Cell = MonsterSpawns[0];
+            Monster.Speed = Config.MonsterSpeed;
+            Monsters.Add(Monster);
+            bFirstSpawned = true;
+        }
+        if (bMonsters && !bSecondSpawned && Config.SecondMonsterSpawnTime > 0.0f && RemainingTime <= Config.SecondMonsterSpawnTime)
+        {
+            FAgent Monster;
+            Monster.Cell = MonsterSpawns[1];
+            Monster.Speed = Config.MonsterSpeed;
+            Monsters.Add(Monster);
+            bSecondSpawned = true;
+        }
+        if (!bAggressive && Config.AggressiveModeTime > 0.0f && RemainingTime <= Config.AggressiveModeTime)
+        {
+            // Only the monsters already out, like ActivateAggressiveMode
+            for (FAgent& Monster : Monsters)
+            {
+                Monster.Speed *= Settings.BoostSpeedScale;
+            }
+            bAggressive = true;
+        }
+        if (!bFinalBoost && RemainingTime <= Settings.FinalBoostTime && Monsters.Num() > 0)
+        {
+            Monsters[0].Speed *= Settings.BoostSpeedScale;
+            bFinalBoost = true;
+        }
+
+        // ==================== PLAYER ====================
+        if (TrapTimer > 0.0f)
+        {
+            TrapTimer -= Settings.TimeStep;
+        }
+        else
+        {
+            float Step = Settings.TimeStep * Player.Speed * (MudTimer > 0.0f ? Settings.MudSpeedScale : 1.0f) / Settings.CellSize;
+            while (Step > 0.0f)
+            {
+                if (Player.Next == INDEX_NONE)
+                {
+                    Player.Next = ChoosePlayerStep(Random, Settings, Player.Cell);
+                    if (Player.Next == INDEX_NONE)
+                    {
+                        break;
+                    }
+                }
+
+                const float Left = 1.0f - Player.Progress;
+                if (Step < Left)
+                {
+                    Player.Progress += Step;
+                    break;
+                }
+                Step -= Left;
+
+                Player.Cell = Player.Next;
+                Player.Next = INDEX_NONE;
+                Player.Progress = 0.0f;
+                Result.CellsWalked++;
+                ComputeDistances(Player.Cell, PlayerDistances);
+
+                if (Player.Cell == ExitIndex)
+                {
+                    Result.bEscaped = true;
+                    Result.Time = Time + Settings.TimeStep;
+                    Result.Stars = CalculateStars(Config, Result.Time);
+                    return Result;
+                }
+                if (Player.Cell == StarIndex)
+                {
+                    // The golden star reveals the path to the exit
+                    bExitKnown = true;
+                }
+                if (MudCells[Player.Cell])
+                {
+                    MudTimer = Settings.MudDuration;
+                }
+                if (TrapCells[Player.Cell])
+                {
+                    // Walled in at the center until the trap releases, each trap springs once
+                    TrapCells[Player.Cell] = 0;
+                    TrapTimer = Settings.TrapDuration;
+                    break;
+                }
+            }
+        }
+        MudTimer -= Settings.TimeStep;
+
+        // ==================== MONSTERS ====================
+        // They always know the player's cell and walk down its distance field: the pessimistic end
+        // of AMonsterAI, whose perception loses the player now and then
+        for (FAgent& Monster : Monsters)
+        {
+            float Step = Settings.TimeStep * Monster.Speed / Settings.CellSize;
+            while (Step > 0.0f)
+            {
+                if (Monster.Next == INDEX_NONE)
+                {
+                    Monster.Next = Monster.Cell == Player.Cell ? Player.Next : GetDownhillNeighbor(Monster.Cell, PlayerDistances);
+
+                    // A sprung trap's walls keep everyone out
+                    if (Monster.Next == INDEX_NONE || (TrapTimer > 0.0f && Monster.Next == Player.Cell))
+                    {
+                        Monster.Next = INDEX_NONE;
+                        break;
+                    }
+                }
+
+                const float Left = 1.0f - Monster.Progress;
+                if (Step < Left)
+                {
+                    Monster.Progress += Step;
+                    break;
+                }
+                Step -= Left;
+
+                Monster.Cell = Monster.Next;
+                Monster.Next = INDEX_NONE;
+                Monster.Progress = 0.0f;
+            }
+
+            if (FVector2D::Distance(GetPosition(Monster, Settings.CellSize), GetPosition(Player, Settings.CellSize)) < Settings.CatchDistance)
+            {
+                Result.bCaught = true;
+                Result.Time = Time + Settings.TimeStep;
+                return Result;
+            }
+        }
+
+        Time += Settings.TimeStep;
+        if (Time >= Config.TimeLimit)
+        {
+            Result.Time = Config.TimeLimit;
+            return Result;
+        }
+    }
+}
+
+// ==================== MONTE CARLO SWEEP ====================
+
+double FMazeLevelSimulationSweep::Run(const TArray<FLevelConfig>& LevelConfigs, const FMazeSimSweepSettings& Settings, TArray<FMazeSimSweepRow>& OutRows)
+{
+    OutRows.Reset();
+
+    const TArray<float> Unscaled = { 1.0f };
+    TArray<FLevelConfig> Points;
+    for (const FLevelConfig& Level : LevelConfigs)
+    {
+        if (Settings.Levels.Num() > 0 && !Settings.Levels.Contains(Level.LevelNumber))
+        {
+            continue;
+        }
+
+        // Monster parameters only matter when the level has one, and scaling an instant spawn changes nothing
+        const bool bMonsters = Level.bEnableMonster && Level.MonsterSpawnDelay >= 0.0f;
+        for (const float SpeedScale : bMonsters ? Settings.MonsterSpeedScales : Unscaled)
+        {
+            for (const float DelayScale : bMonsters && Level.MonsterSpawnDelay > 0.0f ? Settings.SpawnDelayScales : Unscaled)
+            {
+                for (const float TimeScale : Settings.TimeLimitScales)
+                {
+                    FLevelConfig& Point = Points.Add_GetRef(Level);
+                    Point.MonsterSpeed *= SpeedScale;
+                    Point.MonsterSpawnDelay *= DelayScale;
+                    Point.TimeLimit *= TimeScale;
+                }
+            }
+        }
+    }
+
+    // Every point plays the same seeds, so the differences between points are the parameters and
+    // not the mazes. Batches of runs share one simulation's scratch.
+    const int32 Runs = FMath::Max(1, Settings.RunsPerPoint);
+    const int32 RunsPerBatch = 16;
+    const int32 BatchesPerPoint = FMath::DivideAndRoundUp(Runs, RunsPerBatch);
+
+    TArray<FMazeSimResult> Results;
+    Results.SetNum(Points.Num() * Runs);
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    ParallelFor(TEXT("MazeLevelSimulation.Sweep"), Points.Num() * BatchesPerPoint, 1, [&](int32 Batch)
+    {
+        const int32 PointIndex = Batch / BatchesPerPoint;
+        const int32 FirstRun = (Batch % BatchesPerPoint) * RunsPerBatch;
+        const int32 LastRun = FMath::Min(FirstRun + RunsPerBatch, Runs);
+
+        FMazeLevelSimulation Simulation;
+        for (int32 Run = FirstRun; Run < LastRun; Run++)
+        {
+            Results[PointIndex * Runs + Run] = Simulation.Run(Points[PointIndex], Settings.Sim, Settings.Seed + Run * 7919);
+        }
+    });
+    const double WallSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+    double SimulatedSeconds = 0.0;
+    TArray<float> CatchTimes;
+    for (int32 PointIndex = 0; PointIndex < Points.Num(); PointIndex++)
+    {
+        const FLevelConfig& Point = Points[PointIndex];
+        FMazeSimSweepRow Row;
+        Row.Level = Point.LevelNumber;
+        Row.MonsterSpeed = Point.MonsterSpeed;
+        Row.MonsterSpawnDelay = Point.MonsterSpawnDelay;
+        Row.TimeLimit = Point.TimeLimit;
+        Row.Runs = Runs;
+
+        int32 Wins = 0;
+        int32 Catches = 0;
+        double EscapeTime = 0.0;
+        CatchTimes.Reset();
+
+        for (int32 Run = 0; Run < Runs; Run++)
+        {
+            const FMazeSimResult& Result = Results[PointIndex * Runs + Run];
+            SimulatedSeconds += Result.Time;
+
+            if (Result.bEscaped)
+            {
+                Wins++;
+                EscapeTime += Result.Time;
+            }
+            else if (Result.bCaught)
+            {
+                Catches++;
+                CatchTimes.Add(Result.Time);
+            }
+        }
+
+        CatchTimes.Sort();
+        Row.WinRate = static_cast<float>(Wins) / Runs;
+        Row.CatchRate = static_cast<float>(Catches) / Runs;
+        Row.TimeoutRate = 1.0f - Row.WinRate - Row.CatchRate;
+        Row.MeanEscapeTime = Wins > 0 ? static_cast<float>(EscapeTime / Wins) : 0.0f;
+        Row.CatchP10 = Percentile(CatchTimes, 0.10f);
+        Row.CatchP50 = Percentile(CatchTimes, 0.50f);
+        Row.CatchP90 = Percentile(CatchTimes, 0.90f);
+
+        // One row per star threshold scale, all graded from the same escape times
+        for (const float StarScale : Settings.StarTimeScales)
+        {
+            FLevelConfig Graded = Point;
+            Graded.ThreeStarTime *= StarScale;
+            Graded.TwoStarTime *= StarScale;
+            Graded.OneStarTime *= StarScale;
+
+            FMazeSimSweepRow& GradedRow = OutRows.Add_GetRef(Row);
+            GradedRow.ThreeStarTime = Graded.ThreeStarTime;
+            GradedRow.TwoStarTime = Graded.TwoStarTime;
+            GradedRow.OneStarTime = Graded.OneStarTime;
+
+            for (int32 Run = 0; Run < Runs; Run++)
+            {
+                const FMazeSimResult& Result = Results[PointIndex * Runs + Run];
+                GradedRow.StarCounts[Result.bEscaped ? FMazeLevelSimulation::CalculateStars(Graded, Result.Time) : 0]++;
+            }
+
+            UE_LOG(LogTemp, Log, TEXT("[LevelSimulation] Level %d speed %5.0f delay %5.0f limit %5.0f stars %4.0f/%4.0f/%4.0f  win %5.1f%%  caught %5.1f%% (p50 %5.1f s)  stars %d/%d/%d/%d"),
+                   GradedRow.Level, GradedRow.MonsterSpeed, GradedRow.MonsterSpawnDelay, GradedRow.TimeLimit,
+                   GradedRow.ThreeStarTime, GradedRow.TwoStarTime, GradedRow.OneStarTime,
+                   GradedRow.WinRate * 100.0f, GradedRow.CatchRate * 100.0f, GradedRow.CatchP50,
+                   GradedRow.StarCounts[0], GradedRow.StarCounts[1], GradedRow.StarCounts[2], GradedRow.StarCounts[3]);
+        }
+    }
+
+    return WallSeconds > 0.0 ? SimulatedSeconds / WallSeconds : 0.0;
+}
+
+FString FMazeLevelSimulationSweep::ToCsv(const TArray<FMazeSimSweepRow>& Rows)
+{
+    FString Csv = TEXT("level,monster_speed,monster_spawn_delay,time_limit,three_star_s,two_star_s,one_star_s,runs,win_rate,catch_rate,timeout_rate,mean_escape_s,catch_p10_s,catch_p50_s,catch_p90_s,stars_0,stars_1,stars_2,stars_3\n");
+    for (const FMazeSimSweepRow& Row : Rows)
+    {
+        Csv += FString::Printf(TEXT("%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%d,%.4f,%.4f,%.4f,%.2f,%.2f,%.2f,%.2f,%d,%d,%d,%d\n"),
+                               Row.Level, Row.MonsterSpeed, Row.MonsterSpawnDelay, Row.TimeLimit,
+                               Row.ThreeStarTime, Row.TwoStarTime, Row.OneStarTime, Row.Runs,
+                               Row.WinRate, Row.CatchRate, Row.TimeoutRate, Row.MeanEscapeTime, Row.CatchP10, Row.CatchP50, Row.CatchP90,
+                               Row.StarCounts[0], Row.StarCounts[1], Row.StarCounts[2], Row.StarCounts[3]);
+    }
+    return Csv;
+}
+
+FString FMazeLevelSimulationSweep::GetDefaultCsvPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Balance") / FString::Printf(TEXT("LevelSweep-%s.csv"), *FDateTime::Now().ToString());
+}
+
+bool FMazeLevelSimulationSweep::WriteCsv(const TArray<FMazeSimSweepRow>& Rows, const FString& Path)
+{
+    if (!FFileHelper::SaveStringToFile(ToCsv(Rows), *Path))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[LevelSimulation] Could not write %s"), *Path);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[LevelSimulation] Wrote %d rows to %s"), Rows.Num(), *Path);
+    return true;
+}
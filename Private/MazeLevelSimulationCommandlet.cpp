@@ -0,0 +1,43 @@
+// MazeLevelSimulationCommandlet.cpp
+#include "MazeLevelSimulationCommandlet.h"
+#include "MazeLevelSimulation.h"
+#include "LevelProgressionManager.h"
+#include "Misc/Parse.h"
+
+UMazeLevelSimulationCommandlet::UMazeLevelSimulationCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMazeLevelSimulationCommandlet::Main(const FString& Params)
+{
+    FMazeSimSweepSettings Settings;
+    FParse::Value(*Params, TEXT("runs="), Settings.RunsPerPoint);
+    FParse::Value(*Params, TEXT("seed="), Settings.Seed);
+    Settings.Sim.bPlayerKnowsExit = FParse::Param(*Params, TEXT("knowsexit"));
+
+    int32 Level = 0;
+    if (FParse::Value(*Params, TEXT("level="), Level))
+    {
+        Settings.Levels.Add(Level);
+    }
+
+    FString CsvPath;
+    if (!FParse::Value(*Params, TEXT("csv="), CsvPath))
+    {
+        CsvPath = FMazeLevelSimulationSweep::GetDefaultCsvPath();
+    }
+
+    TArray<FLevelConfig> LevelConfigs;
+    ALevelProgressionManager::BuildDefaultLevelConfigs(LevelConfigs);
+
+    TArray<FMazeSimSweepRow> Rows;
+    const double SpeedUp = FMazeLevelSimulationSweep::Run(LevelConfigs, Settings, Rows);
+    const bool bWritten = FMazeLevelSimulationSweep::WriteCsv(Rows, CsvPath);
+
+    UE_LOG(LogTemp, Display, TEXT("[LevelSimulation] %d points x %d runs, %.0fx real time"), Rows.Num(), Settings.RunsPerPoint, SpeedUp);
+    return Rows.Num() > 0 && bWritten ? 0 : 1;
+}
@@ -2,33 +2,17 @@
 #include "MazeManager.h"
 #include "MazeCell.h"
 #include "MuddyPatch.h"
+#include "MazeNavigationData.h"
+#include "NavigationSystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "CustomQueue.h"
-
-// Direction constants
-const AMazeManager::FDirectionInfo* AMazeManager::GetAllDirections()
-{
-    static const FDirectionInfo Directions[] = {
-        {EMazeDirection::North, -1, 0},
-        {EMazeDirection::South, 1, 0},
-        {EMazeDirection::East, 0, 1},
-        {EMazeDirection::West, 0, -1}
-    };
-    return Directions;
-}
+#include "MazeSimulationClock.h"
 
 EMazeDirection AMazeManager::GetOppositeDirection(EMazeDirection Dir)
 {
-    switch (Dir)
-    {
-        case EMazeDirection::North: return EMazeDirection::South;
-        case EMazeDirection::South: return EMazeDirection::North;
-        case EMazeDirection::East: return EMazeDirection::West;
-        case EMazeDirection::West: return EMazeDirection::East;
-        default: return EMazeDirection::North;
-    }
+    return static_cast<EMazeDirection>(FMazeGrid::Opposite(static_cast<int32>(Dir)));
 }
 
 bool AMazeManager::IsValidCell(int32 Row, int32 Col) const
@@ -38,13 +22,15 @@ bool AMazeManager::IsValidCell(int32 Row, int32 Col) const
 
 AMazeManager::AMazeManager()
 {
-    PrimaryActorTick.bCanEverTick = false;
+    PrimaryActorTick.bCanEverTick = true;  // Drains the path request queue
     EscapeCell = nullptr;
+    NavigationData = nullptr;
     CellSize = 500.0f;
     Rows = 15;
     Cols = 15;
     LoopProbability = 0.15f;
     bIsMazeGenerated = false;
+    SimulationClock = nullptr;
 }
 
 void AMazeManager::BeginPlay()
@@ -52,6 +38,34 @@ void AMazeManager::BeginPlay()
     Super::BeginPlay();
 }
 
+void AMazeManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    
+    // NavGrid is only rebuilt at the end of generation, requests wait until then
+    if (SimulationClock)
+    {
+        // The steps simulated since the last tick, the clock restarts at 0 with every level
+        const int64 Step = SimulationClock->GetStep();
+        const int64 NewSteps = Step - FMath::Min(PathQueueStep, Step);
+        PathQueueStep = Step;
+        if (bIsMazeGenerated && PathRequests.GetNumPending() > 0 && NewSteps > 0)
+        {
+            const int32 MaxExpansions = static_cast<int32>(FMath::Min<int64>(NewSteps * PathExpansionsPerStep, MAX_int32));
+            PathRequests.Process(NavGrid, PathBudgetMicroseconds, MaxExpansions);
+        }
+    }
+    else if (bIsMazeGenerated && PathRequests.GetNumPending() > 0)
+    {
+        PathRequests.Process(NavGrid, PathBudgetMicroseconds);
+    }
+    
+    if (bIsMazeGenerated && PlayerBelief.IsInitialized())
+    {
+        UpdatePlayerBelief(DeltaTime);
+    }
+}
+
 void AMazeManager::GenerateMazeImmediate()
 {
     // Always regenerate (allows settings to apply immediately)
@@ -64,6 +78,9 @@ void AMazeManager::GenerateMaze(AMazeCell* PreservedCell)
 {
     UE_LOG(LogTemp, Warning, TEXT("[MazeManager] Generating %dx%d maze..."), Rows, Cols);
     
+    // Wall changes during generation are picked up by the rebuild at the end
+    bIsMazeGenerated = false;
+    
     if (PreservedCell)
     {
         UE_LOG(LogTemp, Warning, TEXT("[MazeManager] Preserving cell (%d, %d) during regeneration"), 
@@ -94,11 +111,40 @@ void AMazeManager::GenerateMaze(AMazeCell* PreservedCell)
     CreateExit(PreservedCell, 4);  // Ensure exit is at least 4 cells away from preserved cell
     VerifyMazeGeneration();
     SpawnMuddyPatches();  // Spawn muddy patches after maze is complete
+    RebuildNavigationGrid();
     
     bIsMazeGenerated = true;
     UE_LOG(LogTemp, Warning, TEXT("[MazeManager] Generation complete!"));
 }
 
+void AMazeManager::BuildFromGrid(const FMazeGrid& Source)
+{
+    bIsMazeGenerated = false;
+    
+    if (!MazeCellClass)
+    {
+        MazeCellClass = AMazeCell::StaticClass();
+    }
+    
+    Rows = Source.Rows;
+    Cols = Source.Cols;
+    InitializeMaze();
+    
+    for (int32 Index = 0; Index < Source.Num(); Index++)
+    {
+        AMazeCell* Cell = GetCell(Source.GetRow(Index), Source.GetCol(Index));
+        if (!Cell) continue;
+        
+        for (const FMazeGrid::FNeighbor Neighbor : Source.OpenNeighbors(Index))
+        {
+            Cell->RemoveWall(static_cast<EMazeDirection>(Neighbor.Dir));
+        }
+    }
+    
+    RebuildNavigationGrid();
+    bIsMazeGenerated = true;
+}
+
 void AMazeManager::InitializeMaze(AMazeCell* PreservedCell)
 {
     // Destroy existing cells (except preserved cell)
@@ -136,6 +182,7 @@ void AMazeManager::InitializeMaze(AMazeCell* PreservedCell)
             
             FActorSpawnParameters SpawnParams;
             SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            SpawnParams.Owner = this;  // Cells report wall changes back to us
             
             AMazeCell* NewCell = GetWorld()->SpawnActor<AMazeCell>(
                 MazeCellClass, 
@@ -174,29 +221,25 @@ void AMazeManager::GenerateWithDFS()
     DFSRecursive(StartCell);
 }
 
-TArray<AMazeCell*> AMazeManager::GetUnvisitedNeighbors(AMazeCell* Cell) const
+void AMazeManager::GatherUnvisitedNeighbors(AMazeCell* Cell, FMazeCellNeighbors& OutNeighbors) const
 {
-    TArray<AMazeCell*> Neighbors;
-    if (!Cell) return Neighbors;
-    
-    const FDirectionInfo* Dirs = GetAllDirections();
+    OutNeighbors.Reset();
+    if (!Cell) return;
     
-    for (int32 i = 0; i < 4; i++)
+    for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
     {
-        int32 NewRow = Cell->Row + Dirs[i].RowDelta;
-        int32 NewCol = Cell->Col + Dirs[i].ColDelta;
+        int32 NewRow = FMazeGrid::GetNeighborRow(Cell->Row, Dir);
+        int32 NewCol = FMazeGrid::GetNeighborCol(Cell->Row, Cell->Col, Dir);
         
         if (IsValidCell(NewRow, NewCol))
         {
             AMazeCell* Neighbor = GetCell(NewRow, NewCol);
             if (Neighbor && !Neighbor->bVisited)
             {
-                Neighbors.Add(Neighbor);
+                OutNeighbors.Add(Neighbor);
             }
         }
     }
-    
-    return Neighbors;
 }
 
 void AMazeManager::DFSRecursive(AMazeCell* Current)
@@ -207,7 +250,8 @@ void AMazeManager::DFSRecursive(AMazeCell* Current)
     Current->bInMaze = true;
     
     // Get unvisited neighbors and shuffle
-    TArray<AMazeCell*> UnvisitedNeighbors = GetUnvisitedNeighbors(Current);
+    FMazeCellNeighbors UnvisitedNeighbors;
+    GatherUnvisitedNeighbors(Current, UnvisitedNeighbors);
     
     for (int32 i = UnvisitedNeighbors.Num() - 1; i > 0; i--)
     {
@@ -230,20 +274,12 @@ void AMazeManager::RemoveWallBetween(AMazeCell* CellA, AMazeCell* CellB)
 {
     if (!CellA || !CellB) return;
     
-    int32 dRow = CellB->Row - CellA->Row;
-    int32 dCol = CellB->Col - CellA->Col;
-    
-    const FDirectionInfo* Dirs = GetAllDirections();
+    // Compile-time (dRow, dCol) -> direction table, no search over the directions
+    const int32 Dir = FMazeGrid::GetDirectionBetween(CellA->Row, CellA->Col, CellB->Row, CellB->Col);
+    if (Dir == INDEX_NONE) return;
     
-    for (int32 i = 0; i < 4; i++)
-    {
-        if (Dirs[i].RowDelta == dRow && Dirs[i].ColDelta == dCol)
-        {
-            CellA->RemoveWall(Dirs[i].Dir);
-            CellB->RemoveWall(GetOppositeDirection(Dirs[i].Dir));
-            return;
-        }
-    }
+    CellA->RemoveWall(static_cast<EMazeDirection>(Dir));
+    CellB->RemoveWall(static_cast<EMazeDirection>(FMazeGrid::Opposite(Dir)));
 }
 
 void AMazeManager::CreateMazeLoops()
@@ -251,20 +287,18 @@ void AMazeManager::CreateMazeLoops()
     int32 TargetLoops = FMath::FloorToInt((Rows * Cols) * LoopProbability);
     int32 LoopsCreated = 0;
     
-    const FDirectionInfo* Dirs = GetAllDirections();
-    
     for (int32 Attempt = 0; Attempt < TargetLoops * 5 && LoopsCreated < TargetLoops; Attempt++)
     {
         AMazeCell* Cell = GetRandomCell();
         if (!Cell) continue;
         
         // Try random direction
-        int32 DirIndex = FMath::RandRange(0, 3);
+        int32 DirIndex = FMath::RandRange(0, FMazeGrid::NumDirections - 1);
         
-        for (int32 i = 0; i < 4; i++)
+        for (int32 i = 0; i < FMazeGrid::NumDirections; i++)
         {
-            int32 CheckIndex = (DirIndex + i) % 4;
-            EMazeDirection Dir = Dirs[CheckIndex].Dir;
+            int32 CheckIndex = (DirIndex + i) % FMazeGrid::NumDirections;
+            EMazeDirection Dir = static_cast<EMazeDirection>(CheckIndex);
             
             if (Cell->HasWall(Dir))
             {
@@ -395,12 +429,15 @@ TArray<AMazeCell*> AMazeManager::FindPathBFS(AMazeCell* Start, AMazeCell* Goal)
         }
     }
     
-    // BFS using custom queue
-    CustomQueue<AMazeCell*> Q;
+    // BFS using custom queue (member, so its nodes are reused between searches)
+    CustomQueue<AMazeCell*>& Q = SearchQueue;
+    Q.Clear();
+    Q.Reserve(Rows * Cols);
     Q.Enqueue(Start);
     Start->bVisited = true;
     
     bool Found = false;
+    FMazeCellNeighbors Neighbors;
     
     while (!Q.IsEmpty() && !Found)
     {
@@ -413,7 +450,8 @@ TArray<AMazeCell*> AMazeManager::FindPathBFS(AMazeCell* Start, AMazeCell* Goal)
             break;
         }
         
-        for (AMazeCell* Neighbor : GetNeighbors(Current, false))
+        GatherNeighbors(Current, Neighbors);
+        for (AMazeCell* Neighbor : Neighbors)
         {
             if (!Neighbor->bVisited)
             {
@@ -427,12 +465,7 @@ TArray<AMazeCell*> AMazeManager::FindPathBFS(AMazeCell* Start, AMazeCell* Goal)
     // Reconstruct path
     if (Found)
     {
-        AMazeCell* Current = Goal;
-        while (Current)
-        {
-            Path.Insert(Current, 0);
-            Current = Current->ParentCell;
-        }
+        BuildPathFromParents(Goal, Path);
     }
     
     return Path;
@@ -465,12 +498,13 @@ TArray<AMazeCell*> AMazeManager::FindPathAStar(AMazeCell* Start, AMazeCell* Goal
     Start->HScore = CalculateHeuristic(Start, Goal);
     Start->FScore = Start->HScore;
     
-    // Open set (cells to evaluate)
-    TArray<AMazeCell*> OpenSet;
+    // Open set (cells to evaluate), reused between searches
+    TArray<AMazeCell*>& OpenSet = OpenSetScratch;
+    OpenSet.Reset();
     OpenSet.Add(Start);
     
-    // Closed set (already evaluated)
-    TSet<AMazeCell*> ClosedSet;
+    // Closed set (already evaluated) is bVisited, cleared above
+    FMazeCellNeighbors Neighbors;
     
     while (OpenSet.Num() > 0)
     {
@@ -491,25 +525,19 @@ TArray<AMazeCell*> AMazeManager::FindPathAStar(AMazeCell* Start, AMazeCell* Goal
         if (Current == Goal)
         {
             // Reconstruct path
-            AMazeCell* PathCell = Goal;
-            while (PathCell)
-            {
-                Path.Insert(PathCell, 0);
-                PathCell = PathCell->ParentCell;
-            }
-            
+            BuildPathFromParents(Goal, Path);
             return Path;
         }
         
         // Move current from open to closed
-        OpenSet.RemoveAt(CurrentIndex);
-        ClosedSet.Add(Current);
+        OpenSet.RemoveAtSwap(CurrentIndex);
+        Current->bVisited = true;
         
         // Check all neighbors
-        TArray<AMazeCell*> Neighbors = GetNeighbors(Current, false);
+        GatherNeighbors(Current, Neighbors);
         for (AMazeCell* Neighbor : Neighbors)
         {
-            if (ClosedSet.Contains(Neighbor))
+            if (Neighbor->bVisited)
                 continue;
             
             // Calculate tentative G score
@@ -518,6 +546,9 @@ TArray<AMazeCell*> AMazeManager::FindPathAStar(AMazeCell* Start, AMazeCell* Goal
             // Check if this path is better
             if (TentativeGScore < Neighbor->GScore)
             {
+                // Never scored = not in the open set yet
+                const bool bInOpenSet = Neighbor->GScore < FLT_MAX;
+                
                 // This path is the best so far
                 Neighbor->ParentCell = Current;
                 Neighbor->GScore = TentativeGScore;
@@ -525,7 +556,7 @@ TArray<AMazeCell*> AMazeManager::FindPathAStar(AMazeCell* Start, AMazeCell* Goal
                 Neighbor->FScore = Neighbor->GScore + Neighbor->HScore;
                 
                 // Add to open set if not already there
-                if (!OpenSet.Contains(Neighbor))
+                if (!bInOpenSet)
                 {
                     OpenSet.Add(Neighbor);
                 }
@@ -537,6 +568,40 @@ TArray<AMazeCell*> AMazeManager::FindPathAStar(AMazeCell* Start, AMazeCell* Goal
     return Path;
 }
 
+// Hierarchical pathfinding - searches junctions only, then refines the corridors it used
+TArray<AMazeCell*> AMazeManager::FindPathHierarchical(AMazeCell* Start, AMazeCell* Goal)
+{
+    TArray<AMazeCell*> Path;
+    if (!Start || !Goal || !bIsMazeGenerated) return Path;
+    
+    if (!JunctionGraph.IsBuilt())
+    {
+        RebuildNavigationGrid();
+    }
+    
+    const int32 StartIndex = GetCellIndex(Start);
+    const int32 GoalIndex = GetCellIndex(Goal);
+    
+    TArray<int32> CellPath;
+    bool bFound = PathCache.FindPath(NavGrid, StartIndex, GoalIndex, CellPath);
+    if (!bFound && JunctionGraph.FindPath(NavGrid, StartIndex, GoalIndex, CellPath))
+    {
+        PathCache.AddPath(NavGrid, CellPath);
+        bFound = true;
+    }
+    
+    if (bFound)
+    {
+        Path.Reserve(CellPath.Num());
+        for (int32 Index : CellPath)
+        {
+            Path.Add(GetCellByIndex(Index));
+        }
+    }
+    
+    return Path;
+}
+
 // Calculate heuristic (Manhattan distance)
 float AMazeManager::CalculateHeuristic(AMazeCell* From, AMazeCell* To) const
 {
@@ -551,49 +616,76 @@ float AMazeManager::CalculateHeuristic(AMazeCell* From, AMazeCell* To) const
 
 TArray<AMazeCell*> AMazeManager::GetNeighbors(AMazeCell* Cell, bool bIgnoreWalls) const
 {
-    TArray<AMazeCell*> Neighbors;
-    if (!Cell) return Neighbors;
+    FMazeCellNeighbors Neighbors;
+    GatherNeighbors(Cell, Neighbors, bIgnoreWalls);
+    return TArray<AMazeCell*>(Neighbors.GetData(), Neighbors.Num());
+}
+
+void AMazeManager::GatherNeighbors(AMazeCell* Cell, FMazeCellNeighbors& OutNeighbors, bool bIgnoreWalls) const
+{
+    OutNeighbors.Reset();
+    if (!Cell) return;
     
-    const FDirectionInfo* Dirs = GetAllDirections();
+    // After generation NavGrid mirrors the walls: walk the open-mask bits straight to the neighbors
+    const int32 Index = GetCellIndex(Cell);
+    if (!bIgnoreWalls && bIsMazeGenerated && Index != INDEX_NONE && NavGrid.Num() == Rows * Cols)
+    {
+        for (const FMazeGrid::FNeighbor Neighbor : NavGrid.OpenNeighbors(Index))
+        {
+            if (AMazeCell* NeighborCell = GetCellByIndex(Neighbor.Index))
+            {
+                OutNeighbors.Add(NeighborCell);
+            }
+        }
+        return;
+    }
     
-    for (int32 i = 0; i < 4; i++)
+    for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
     {
-        int32 NewRow = Cell->Row + Dirs[i].RowDelta;
-        int32 NewCol = Cell->Col + Dirs[i].ColDelta;
+        int32 NewRow = FMazeGrid::GetNeighborRow(Cell->Row, Dir);
+        int32 NewCol = FMazeGrid::GetNeighborCol(Cell->Row, Cell->Col, Dir);
         
         if (IsValidCell(NewRow, NewCol))
         {
-            if (bIgnoreWalls || !Cell->HasWall(Dirs[i].Dir))
+            AMazeCell* Neighbor = GetCell(NewRow, NewCol);
+            if (!Neighbor)
             {
-                AMazeCell* Neighbor = GetCell(NewRow, NewCol);
-                if (Neighbor)
-                {
-                    Neighbors.Add(Neighbor);
-                }
+                continue;
+            }
+            
+            // A trap can raise the walls of a single cell, so check both sides of the passage
+            const EMazeDirection MazeDir = static_cast<EMazeDirection>(Dir);
+            if (bIgnoreWalls || (!Cell->HasWall(MazeDir) && !Neighbor->HasWall(GetOppositeDirection(MazeDir))))
+            {
+                OutNeighbors.Add(Neighbor);
             }
         }
     }
-    
-    return Neighbors;
 }
 
 AMazeCell* AMazeManager::GetNeighborInDirection(AMazeCell* Cell, EMazeDirection Dir) const
 {
     if (!Cell) return nullptr;
     
-    const FDirectionInfo* Dirs = GetAllDirections();
-    
-    for (int32 i = 0; i < 4; i++)
+    // EMazeDirection indexes the constexpr delta tables directly
+    const int32 DirIndex = static_cast<int32>(Dir);
+    return GetCell(FMazeGrid::GetNeighborRow(Cell->Row, DirIndex), FMazeGrid::GetNeighborCol(Cell->Row, Cell->Col, DirIndex));
+}
+
+void AMazeManager::BuildPathFromParents(AMazeCell* Goal, TArray<AMazeCell*>& OutPath) const
+{
+    // Count first so the path is filled back to front in a single allocation
+    int32 Length = 0;
+    for (AMazeCell* Cell = Goal; Cell; Cell = Cell->ParentCell)
     {
-        if (Dirs[i].Dir == Dir)
-        {
-            int32 NewRow = Cell->Row + Dirs[i].RowDelta;
-            int32 NewCol = Cell->Col + Dirs[i].ColDelta;
-            return GetCell(NewRow, NewCol);
-        }
+        Length++;
     }
     
-    return nullptr;
+    OutPath.SetNumUninitialized(Length);
+    for (AMazeCell* Cell = Goal; Cell; Cell = Cell->ParentCell)
+    {
+        OutPath[--Length] = Cell;
+    }
 }
 
 void AMazeManager::HighlightPath(const TArray<AMazeCell*>& Path)
@@ -620,6 +712,587 @@ void AMazeManager::HighlightPath(const TArray<AMazeCell*>& Path)
     }
 }
 
+// ==================== NAVIGATION GRID ====================
+
+void AMazeManager::RebuildNavigationGrid()
+{
+    NavGrid.Init(Rows, Cols);
+    
+    for (auto& Row : MazeGrid)
+    {
+        for (AMazeCell* Cell : Row)
+        {
+            RefreshCellPassages(Cell);
+        }
+    }
+    
+    JunctionGraph.Build(NavGrid);
+    GetChokepoints();
+    
+    EnsureNavigationData();
+    if (NavigationData)
+    {
+        NavigationData->BuildFromGrid(NavGrid, CellSize, 0.0f);
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("[MazeManager] Navigation grid rebuilt (%d junction nodes for %d cells)"),
+           JunctionGraph.GetNumNodes(), NavGrid.Num());
+}
+
+void AMazeManager::EnsureNavigationData()
+{
+    if (!bProvideNavigationData || IsValid(NavigationData) || !GetWorld()) return;
+    
+    // One set up as the NavDataClass of a supported agent may already be registered
+    TArray<AActor*> Found;
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeNavigationData::StaticClass(), Found);
+    NavigationData = Found.Num() > 0 ? Cast<AMazeNavigationData>(Found[0]) : nullptr;
+    
+    if (!NavigationData)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        NavigationData = GetWorld()->SpawnActor<AMazeNavigationData>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    }
+    
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    if (NavigationData && NavSys && !NavigationData->IsRegistered())
+    {
+        // Serve the agent MoveTo resolves to by default; without a config the nav system can keep
+        // handing out the RecastNavMesh instead
+        FNavDataConfig AgentConfig = NavSys->GetDefaultSupportedAgentConfig();
+        AgentConfig.SetNavDataClass(AMazeNavigationData::StaticClass());
+        NavigationData->SetConfig(AgentConfig);
+        
+        const ERegistrationResult Result = NavSys->RegisterNavData(NavigationData);
+        if (Result != RegistrationSuccessful)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[MazeManager] Grid navigation data not registered for agent %s (result %d), MoveTo falls back to the NavMesh"),
+                   *AgentConfig.Name.ToString(), static_cast<int32>(Result));
+        }
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("[MazeManager] Grid navigation data %s"), NavigationData ? TEXT("ready") : TEXT("could not be spawned"));
+}
+
+void AMazeManager::RefreshCellPassages(AMazeCell* Cell)
+{
+    const int32 Index = GetCellIndex(Cell);
+    if (Index == INDEX_NONE) return;
+    
+    for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+    {
+        const EMazeDirection MazeDir = static_cast<EMazeDirection>(Dir);
+        AMazeCell* Neighbor = GetNeighborInDirection(Cell, MazeDir);
+        
+        const bool bOpen = Neighbor && !Cell->HasWall(MazeDir) && !Neighbor->HasWall(GetOppositeDirection(MazeDir));
+        NavGrid.SetPassage(Index, Dir, bOpen);
+    }
+}
+
+void AMazeManager::NotifyCellWallsChanged(AMazeCell* Cell)
+{
+    // During generation everything is rebuilt once at the end
+    if (!bIsMazeGenerated || !Cell) return;
+    
+    const int32 Index = GetCellIndex(Cell);
+    if (Index == INDEX_NONE || GetCellByIndex(Index) != Cell) return;
+    
+    const uint32 PreviousVersion = NavGrid.WallVersion;
+    RefreshCellPassages(Cell);
+    
+    if (NavGrid.WallVersion != PreviousVersion)
+    {
+        JunctionGraph.UpdateCells(NavGrid, MakeArrayView(&Index, 1));
+        if (NavigationData)
+        {
+            NavigationData->UpdateCells(NavGrid, MakeArrayView(&Index, 1));
+        }
+        UE_LOG(LogTemp, Verbose, TEXT("[MazeManager] Walls changed at [%d,%d] - wall version %u"),
+               Cell->Row, Cell->Col, NavGrid.WallVersion);
+    }
+}
+
+int32 AMazeManager::GetCellIndex(const AMazeCell* Cell) const
+{
+    if (!Cell || !NavGrid.IsValid(Cell->Row, Cell->Col)) return INDEX_NONE;
+    return NavGrid.ToIndex(Cell->Row, Cell->Col);
+}
+
+AMazeCell* AMazeManager::GetCellByIndex(int32 Index) const
+{
+    if (!NavGrid.WallMasks.IsValidIndex(Index)) return nullptr;
+    return GetCell(NavGrid.GetRow(Index), NavGrid.GetCol(Index));
+}
+
+AMazeCell* AMazeManager::GetCellAtLocation(const FVector& Location) const
+{
+    return GetCell(FMath::RoundToInt(Location.X / CellSize), FMath::RoundToInt(Location.Y / CellSize));
+}
+
+// ==================== DISTANCE FIELDS ====================
+
+void AMazeManager::EnsureBitboard()
+{
+    if (!Bitboard.IsBuilt() || Bitboard.GetSourceWallVersion() != NavGrid.WallVersion)
+    {
+        Bitboard.Build(NavGrid);
+    }
+}
+
+void AMazeManager::ComputeDistanceField(AMazeCell* Source, TArray<int32>& OutDistances)
+{
+    EnsureBitboard();
+    Bitboard.ComputeDistanceField(GetCellIndex(Source), OutDistances);
+}
+
+void AMazeManager::ComputeDistancePlanes(const TArray<AMazeCell*>& Sources, FMazeDistancePlanes& OutPlanes)
+{
+    TArray<int32> SourceIndices;
+    SourceIndices.Reserve(Sources.Num());
+    for (AMazeCell* Source : Sources)
+    {
+        SourceIndices.Add(GetCellIndex(Source));
+    }
+    
+    EnsureBitboard();
+    Bitboard.ComputeDistancePlanes(SourceIndices, OutPlanes);
+}
+
+const TArray<int32>& AMazeManager::GetExitDistanceField()
+{
+    const int32 ExitIndex = GetCellIndex(EscapeCell);
+    if (ExitIndex == INDEX_NONE)
+    {
+        ExitDistances.Reset();
+        ExitDistancesSource = INDEX_NONE;
+        return ExitDistances;
+    }
+    
+    if (!HasExitDistanceField())
+    {
+        EnsureBitboard();
+        Bitboard.ComputeDistanceField(ExitIndex, ExitDistances);
+        ExitDistancesSource = ExitIndex;
+        ExitDistancesVersion = NavGrid.WallVersion;
+    }
+    
+    return ExitDistances;
+}
+
+bool AMazeManager::HasExitDistanceField() const
+{
+    const int32 ExitIndex = GetCellIndex(EscapeCell);
+    return ExitIndex != INDEX_NONE && ExitDistancesSource == ExitIndex &&
+           ExitDistancesVersion == NavGrid.WallVersion && ExitDistances.Num() == NavGrid.Num();
+}
+
+const TArray<int32>& AMazeManager::GetPlayerDistanceField(AMazeCell* PlayerCell)
+{
+    const int32 PlayerIndex = GetCellIndex(PlayerCell);
+    if (PlayerIndex == INDEX_NONE)
+    {
+        PlayerDistances.Reset();
+        PlayerDistancesSource = INDEX_NONE;
+        return PlayerDistances;
+    }
+    
+    if (PlayerDistancesSource != PlayerIndex || PlayerDistancesVersion != NavGrid.WallVersion ||
+        PlayerDistances.Num() != NavGrid.Num())
+    {
+        EnsureBitboard();
+        Bitboard.ComputeDistanceField(PlayerIndex, PlayerDistances);
+        PlayerDistancesSource = PlayerIndex;
+        PlayerDistancesVersion = NavGrid.WallVersion;
+    }
+    
+    return PlayerDistances;
+}
+
+const FMazePerception& AMazeManager::GetPlayerPerception(AMazeCell* PlayerCell)
+{
+    const int32 PlayerIndex = GetCellIndex(PlayerCell);
+    if (!PlayerPerception.IsUpToDate(NavGrid, PlayerIndex, SightRangeCells, HearingRangeCells))
+    {
+        // Hearing reads the player distance field, which the monster LOD already keeps for this cell
+        PlayerPerception.Update(NavGrid, PlayerIndex, GetPlayerDistanceField(PlayerCell), SightRangeCells, HearingRangeCells);
+    }
+    return PlayerPerception;
+}
+
+const FMazeChokepoints& AMazeManager::GetChokepoints()
+{
+    const int32 ExitIndex = GetCellIndex(EscapeCell);
+    // Without an exit the build only clears the tables (once)
+    if (!Chokepoints.IsUpToDate(NavGrid, ExitIndex) && (ExitIndex != INDEX_NONE || Chokepoints.IsBuilt()))
+    {
+        Chokepoints.Build(NavGrid, ExitIndex);
+        UE_LOG(LogTemp, Verbose, TEXT("[MazeManager] Chokepoints: %d articulation cells, %d bridges"),
+               Chokepoints.GetNumArticulationPoints(), Chokepoints.GetNumBridges());
+    }
+    return Chokepoints;
+}
+
+AMazeCell* AMazeManager::GetAmbushCell(AMazeCell* PlayerCell)
+{
+    const int32 PlayerIndex = GetCellIndex(PlayerCell);
+    if (PlayerIndex == INDEX_NONE) return nullptr;
+    
+    const int32 AmbushIndex = GetChokepoints().GetLastChokepoint(PlayerIndex);
+    return AmbushIndex != INDEX_NONE ? GetCellByIndex(AmbushIndex) : nullptr;
+}
+
+void AMazeManager::RegisterCooperativeAgent(const UObject* Agent)
+{
+    if (Agent)
+    {
+        Reservations.RegisterAgent(static_cast<int32>(Agent->GetUniqueID()));
+    }
+}
+
+void AMazeManager::UnregisterCooperativeAgent(const UObject* Agent)
+{
+    if (Agent)
+    {
+        Reservations.UnregisterAgent(static_cast<int32>(Agent->GetUniqueID()));
+    }
+}
+
+void AMazeManager::ReleaseCooperativePath(const UObject* Agent)
+{
+    if (Agent)
+    {
+        Reservations.Release(static_cast<int32>(Agent->GetUniqueID()));
+    }
+}
+
+int32 AMazeManager::GetReservationStep() const
+{
+    // Simulated time, so plans and replans land on the same steps at any frame rate
+    const float StepSeconds = FMath::Max(ReservationStepSeconds, 0.05f);
+    if (SimulationClock)
+    {
+        return FMath::FloorToInt(SimulationClock->GetTime() / StepSeconds);
+    }
+    const UWorld* World = GetWorld();
+    return World ? FMath::FloorToInt(World->GetTimeSeconds() / StepSeconds) : 0;
+}
+
+bool AMazeManager::FindCooperativePath(const UObject* Agent, AMazeCell* Start, AMazeCell* PlayerCell, TArray<AMazeCell*>& OutPath)
+{
+    OutPath.Reset();
+    const int32 StartIndex = GetCellIndex(Start);
+    const int32 PlayerIndex = GetCellIndex(PlayerCell);
+    if (!Agent || StartIndex == INDEX_NONE || PlayerIndex == INDEX_NONE) return false;
+    
+    // A new maze size or window drops every plan, the monsters replan on their next tick anyway
+    if (!Reservations.Matches(NavGrid.Num(), CooperativeWindowSteps))
+    {
+        Reservations.Init(NavGrid.Num(), CooperativeWindowSteps);
+    }
+    
+    // Heuristic and tail of the path: the player field every monster already shares this frame
+    const TArray<int32>& Distances = GetPlayerDistanceField(PlayerCell);
+    if (!CooperativeSearch.FindPath(NavGrid, Reservations, static_cast<int32>(Agent->GetUniqueID()), StartIndex, PlayerIndex,
+                                    Distances, GetReservationStep(), CooperativeWindowSteps, CooperativeCrowdPenalty, CooperativeCells))
+    {
+        return false;
+    }
+    
+    OutPath.Reserve(CooperativeCells.Num());
+    for (const int32 Index : CooperativeCells)
+    {
+        OutPath.Add(GetCellByIndex(Index));
+    }
+    return true;
+}
+
+void AMazeManager::ReportPlayerSensed(AMazeCell* PlayerCell)
+{
+    const int32 PlayerIndex = GetCellIndex(PlayerCell);
+    if (PlayerIndex == INDEX_NONE) return;
+    
+    PlayerBelief.SyncWalls(NavGrid);
+    PlayerBelief.CollapseTo(PlayerIndex);
+    BeliefStepAccumulator = 0.0f;
+}
+
+void AMazeManager::ReportCellsSeen(TArrayView<const int32> CellIndices)
+{
+    // The first report starts the map from an even spread (nothing known yet)
+    PlayerBelief.SyncWalls(NavGrid);
+    PlayerBelief.ClearCells(CellIndices);
+}
+
+int32 AMazeManager::GetMostLikelyPlayerCellIndex() const
+{
+    return PlayerBelief.FindMostLikelyCell();
+}
+
+void AMazeManager::UpdatePlayerBelief(float DeltaTime)
+{
+    // A maze regenerated under the map keeps the belief if the size held, only the passages change
+    PlayerBelief.SyncWalls(NavGrid);
+    
+    // Whole steps only, a long frame catches up but never more than a second's worth
+    BeliefStepAccumulator += DeltaTime * BeliefStepsPerSecond;
+    const int32 Steps = FMath::Min(FMath::FloorToInt(BeliefStepAccumulator), FMath::CeilToInt(BeliefStepsPerSecond));
+    BeliefStepAccumulator -= FMath::FloorToInt(BeliefStepAccumulator);
+    
+    PlayerBelief.Diffuse(Steps, BeliefDiffusionRate);
+    PlayerBelief.Normalize();
+}
+
+int32 AMazeManager::GetPathDistance(AMazeCell* From, AMazeCell* To)
+{
+    const int32 FromIndex = GetCellIndex(From);
+    const int32 ToIndex = GetCellIndex(To);
+    if (FromIndex == INDEX_NONE || ToIndex == INDEX_NONE) return -1;
+    
+    // Most queries are "how far from the exit", which the cached field answers directly
+    if (To == EscapeCell || From == EscapeCell)
+    {
+        const TArray<int32>& Distances = GetExitDistanceField();
+        return Distances[To == EscapeCell ? FromIndex : ToIndex];
+    }
+    
+    int32 Distance = -1;
+    if (!PathCache.FindDistance(NavGrid, FromIndex, ToIndex, Distance))
+    {
+        EnsureBitboard();
+        Distance = Bitboard.GetPathDistance(FromIndex, ToIndex);
+        PathCache.AddDistance(NavGrid, FromIndex, ToIndex, Distance);
+    }
+    return Distance;
+}
+
+TArray<AMazeCell*> AMazeManager::FindPathToExit(AMazeCell* Start)
+{
+    TArray<AMazeCell*> Path;
+    
+    const int32 StartIndex = GetCellIndex(Start);
+    const TArray<int32>& Distances = GetExitDistanceField();
+    if (StartIndex == INDEX_NONE || !Distances.IsValidIndex(StartIndex) || Distances[StartIndex] < 0)
+    {
+        return Path;
+    }
+    
+    // Walk downhill: every step moves to an open neighbor one cell closer to the exit
+    int32 Current = StartIndex;
+    Path.Reserve(Distances[StartIndex] + 1);
+    Path.Add(GetCellByIndex(Current));
+    
+    while (Distances[Current] > 0)
+    {
+        int32 NextIndex = INDEX_NONE;
+        for (const FMazeGrid::FNeighbor Neighbor : NavGrid.OpenNeighbors(Current))
+        {
+            if (Distances[Neighbor.Index] == Distances[Current] - 1)
+            {
+                NextIndex = Neighbor.Index;
+                break;
+            }
+        }
+        
+        if (NextIndex == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Error, TEXT("[MazeManager] Exit distance field is inconsistent at cell %d"), Current);
+            Path.Reset();
+            return Path;
+        }
+        
+        Current = NextIndex;
+        Path.Add(GetCellByIndex(Current));
+    }
+    
+    return Path;
+}
+
+// ==================== PATH REQUEST QUEUE ====================
+
+void AMazeManager::RequestPath(const UObject* Requester, AMazeCell* Start, AMazeCell* Goal, EMazePathPriority Priority,
+                               TFunction<void(const TArray<AMazeCell*>&)> OnReady)
+{
+    const int32 StartIndex = GetCellIndex(Start);
+    const int32 GoalIndex = GetCellIndex(Goal);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE)
+    {
+        OnReady(TArray<AMazeCell*>());
+        return;
+    }
+    
+    // Answered before (walls unchanged since): no need to queue at all
+    TArray<int32> CachedPath;
+    bool bAnswered = PathCache.FindPath(NavGrid, StartIndex, GoalIndex, CachedPath);
+    
+    // Small junction graph: its search only expands corridor ends, cheaper than a queued cell BFS
+    if (!bAnswered && JunctionGraph.IsBuilt() && JunctionGraph.GetNumNodes() <= MaxImmediateJunctionNodes &&
+        JunctionGraph.FindPath(NavGrid, StartIndex, GoalIndex, CachedPath))
+    {
+        PathCache.AddPath(NavGrid, CachedPath);
+        bAnswered = true;
+    }
+    
+    if (bAnswered)
+    {
+        TArray<AMazeCell*> Path;
+        Path.Reserve(CachedPath.Num());
+        for (int32 Index : CachedPath)
+        {
+            Path.Add(GetCellByIndex(Index));
+        }
+        
+        // Still supersedes whatever this requester had queued
+        if (Requester)
+        {
+            PathRequests.Cancel(Requester);
+        }
+        OnReady(Path);
+        return;
+    }
+    
+    // Callbacks run from our own Tick, so converting back to cells here is safe.
+    // The queue finishes a search against the current walls, so the result can go into the cache.
+    PathRequests.Enqueue(Requester, StartIndex, GoalIndex, Priority,
+        [this, OnReady = MoveTemp(OnReady)](const TArray<int32>& CellPath)
+        {
+            if (CellPath.Num() > 0)
+            {
+                PathCache.AddPath(NavGrid, CellPath);
+            }
+            
+            TArray<AMazeCell*> Path;
+            Path.Reserve(CellPath.Num());
+            for (int32 Index : CellPath)
+            {
+                Path.Add(GetCellByIndex(Index));
+            }
+            OnReady(Path);
+        });
+}
+
+void AMazeManager::CancelPathRequest(const UObject* Requester)
+{
+    PathRequests.Cancel(Requester);
+}
+
+// ==================== TERRAIN COSTS ====================
+
+void AMazeManager::EnsureTerrainPlane()
+{
+    const int32 NumCells = Rows * Cols;
+    if (TerrainFlags.Num() == NumCells) return;
+    
+    // New maze size: the hazards of the old layout are gone with it
+    TerrainFlags.Init(0, NumCells);
+    TerrainCounts.Init(0, NumCells * FMazeCostProfile::NumTerrainTypes);
+    FMemory::Memzero(TerrainTotals, sizeof(TerrainTotals));
+    TerrainVersion++;
+}
+
+int32 AMazeManager::GetTerrainIndex(const FVector& Location) const
+{
+    // Same rounding as GetCellAtLocation, but valid before the nav grid is built
+    const int32 Row = FMath::RoundToInt(Location.X / CellSize);
+    const int32 Col = FMath::RoundToInt(Location.Y / CellSize);
+    return IsValidCell(Row, Col) ? Row * Cols + Col : INDEX_NONE;
+}
+
+void AMazeManager::AddTerrain(const FVector& Location, EMazeTerrain Terrain)
+{
+    const int32 Index = GetTerrainIndex(Location);
+    if (Index == INDEX_NONE || Terrain == EMazeTerrain::None) return;
+    
+    EnsureTerrainPlane();
+    
+    for (int32 Type = 0; Type < FMazeCostProfile::NumTerrainTypes; Type++)
+    {
+        const uint8 Flag = 1 << Type;
+        if (!(static_cast<uint8>(Terrain) & Flag)) continue;
+        
+        uint8& Count = TerrainCounts[Index * FMazeCostProfile::NumTerrainTypes + Type];
+        if (Count == MAX_uint8) continue;
+        
+        Count++;
+        TerrainTotals[Type]++;
+        if (!(TerrainFlags[Index] & Flag))
+        {
+            TerrainFlags[Index] |= Flag;
+            TerrainVersion++;
+        }
+    }
+}
+
+void AMazeManager::RemoveTerrain(const FVector& Location, EMazeTerrain Terrain)
+{
+    // A resize already dropped every flag of the old layout
+    const int32 Index = GetTerrainIndex(Location);
+    if (Index == INDEX_NONE || TerrainFlags.Num() != Rows * Cols) return;
+    
+    for (int32 Type = 0; Type < FMazeCostProfile::NumTerrainTypes; Type++)
+    {
+        const uint8 Flag = 1 << Type;
+        if (!(static_cast<uint8>(Terrain) & Flag)) continue;
+        
+        uint8& Count = TerrainCounts[Index * FMazeCostProfile::NumTerrainTypes + Type];
+        if (Count == 0) continue;
+        
+        Count--;
+        TerrainTotals[Type]--;
+        if (Count == 0)
+        {
+            TerrainFlags[Index] &= ~Flag;
+            TerrainVersion++;
+        }
+    }
+}
+
+EMazeTerrain AMazeManager::GetCellTerrain(const AMazeCell* Cell) const
+{
+    const int32 Index = GetCellIndex(Cell);
+    return TerrainFlags.IsValidIndex(Index) ? static_cast<EMazeTerrain>(TerrainFlags[Index]) : EMazeTerrain::None;
+}
+
+bool AMazeManager::HasTerrain(EMazeTerrain Terrain) const
+{
+    for (int32 Type = 0; Type < FMazeCostProfile::NumTerrainTypes; Type++)
+    {
+        if ((static_cast<uint8>(Terrain) & (1 << Type)) && TerrainTotals[Type] > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TArray<AMazeCell*> AMazeManager::FindPathWeighted(AMazeCell* Start, AMazeCell* Goal, const FMazeCostProfile& Profile)
+{
+    TArray<AMazeCell*> Path;
+    
+    const int32 StartIndex = GetCellIndex(Start);
+    const int32 GoalIndex = GetCellIndex(Goal);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE) return Path;
+    
+    if (NavGrid.Num() != Rows * Cols)
+    {
+        return FindPathBFS(Start, Goal);
+    }
+    
+    // No terrain registered yet = open terrain everywhere
+    const TArrayView<const uint8> Terrain = TerrainFlags.Num() == NavGrid.Num() ? TArrayView<const uint8>(TerrainFlags) : TArrayView<const uint8>();
+    
+    TArray<int32> CellPath;
+    if (WeightedSearch.FindPath(NavGrid, Terrain, Profile, StartIndex, GoalIndex, CellPath))
+    {
+        Path.Reserve(CellPath.Num());
+        for (int32 Index : CellPath)
+        {
+            Path.Add(GetCellByIndex(Index));
+        }
+    }
+    return Path;
+}
+
 AMazeCell* AMazeManager::GetCell(int32 Row, int32 Col) const
 {
     if (IsValidCell(Row, Col))
@@ -653,11 +1326,11 @@ AMazeCell* AMazeManager::GetEscapeCell() const
     return EscapeCell;
 }
 
-void AMazeManager::SetMazeSize(int32 NewRows, int32 NewCols)
+void AMazeManager::SetMazeSize(int32 NewRows, int32 NewCols, int32 MaxSize)
 {
-    // Validate and clamp values between 1 and 30
-    Rows = FMath::Clamp(NewRows, 1, 30);
-    Cols = FMath::Clamp(NewCols, 1, 30);
+    // Validate and clamp values between 1 and MaxSize
+    Rows = FMath::Clamp(NewRows, 1, MaxSize);
+    Cols = FMath::Clamp(NewCols, 1, MaxSize);
     
     UE_LOG(LogTemp, Warning, TEXT("[MazeManager] Maze size set to %dx%d"), Rows, Cols);
 }
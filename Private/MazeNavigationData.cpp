@@ -0,0 +1,488 @@
+// MazeNavigationData.cpp
+#include "MazeNavigationData.h"
+#include "NavigationSystem.h"
+
+AMazeNavigationData::AMazeNavigationData(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    CellSize = 0.0f;
+    FloorZ = 0.0f;
+
+    // Walls come from the manager, the navigation system never has anything to generate
+    RuntimeGeneration = ERuntimeGenerationType::Static;
+
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        FindPathImplementation = FindPath;
+        FindHierarchicalPathImplementation = FindPath;
+        TestPathImplementation = TestPath;
+        TestHierarchicalPathImplementation = TestPath;
+        RaycastImplementation = Raycast;
+    }
+}
+
+// ==================== SYNC ====================
+
+void AMazeNavigationData::BuildFromGrid(const FMazeGrid& Source, float InCellSize, float InFloorZ)
+{
+    FScopeLock Lock(&SearchLock);
+
+    Grid.Init(Source.Rows, Source.Cols);
+    FMemory::Memcpy(Grid.WallMasks.GetData(), Source.WallMasks.GetData(), Source.WallMasks.Num());
+    Grid.WallVersion = Source.WallVersion;
+    CellSize = InCellSize;
+    FloorZ = InFloorZ;
+
+    UE_LOG(LogTemp, Log, TEXT("[MazeNavigationData] Built %dx%d grid (%d cells, no NavMesh generated)"),
+           Grid.Rows, Grid.Cols, Grid.Num());
+}
+
+void AMazeNavigationData::UpdateCells(const FMazeGrid& Source, TArrayView<const int32> ChangedCells)
+{
+    if (Source.Rows != Grid.Rows || Source.Cols != Grid.Cols)
+    {
+        BuildFromGrid(Source, CellSize, FloorZ);
+        return;
+    }
+
+    {
+        FScopeLock Lock(&SearchLock);
+
+        // A passage lives in both cells' masks, so the neighbors are copied along
+        for (const int32 Index : ChangedCells)
+        {
+            if (!Grid.WallMasks.IsValidIndex(Index))
+            {
+                continue;
+            }
+
+            Grid.WallMasks[Index] = Source.WallMasks[Index];
+            const int32 Row = Grid.GetRow(Index);
+            const int32 Col = Grid.GetCol(Index);
+            for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+            {
+                const int32 NeighborRow = FMazeGrid::GetNeighborRow(Row, Dir);
+                const int32 NeighborCol = FMazeGrid::GetNeighborCol(Row, Col, Dir);
+                if (Grid.IsValid(NeighborRow, NeighborCol))
+                {
+                    const int32 NeighborIndex = Grid.ToIndex(NeighborRow, NeighborCol);
+                    Grid.WallMasks[NeighborIndex] = Source.WallMasks[NeighborIndex];
+                }
+            }
+        }
+        Grid.WallVersion = Source.WallVersion;
+    }
+
+    InvalidatePathsThrough(ChangedCells);
+}
+
+void AMazeNavigationData::InvalidatePathsThrough(TArrayView<const int32> Cells)
+{
+    if (!IsBuilt() || Cells.Num() == 0)
+    {
+        return;
+    }
+
+    FScopeLock PathLock(&ActivePathsLock);
+
+    for (const FNavPathWeakPtr& WeakPath : ActivePaths)
+    {
+        const FNavPathSharedPtr Path = WeakPath.Pin();
+        if (!Path.IsValid() || !Path->IsValid())
+        {
+            continue;
+        }
+
+        // Segments are straight, a changed cell inside a segment's cell bounds may cut it
+        const TArray<FNavPathPoint>& Points = Path->GetPathPoints();
+        bool bAffected = false;
+        for (int32 Point = 1; Point < Points.Num() && !bAffected; Point++)
+        {
+            const FVector2D A = ToGridSpace(Points[Point - 1].Location);
+            const FVector2D B = ToGridSpace(Points[Point].Location);
+            const int32 MinRow = FMath::RoundToInt(FMath::Min(A.X, B.X));
+            const int32 MaxRow = FMath::RoundToInt(FMath::Max(A.X, B.X));
+            const int32 MinCol = FMath::RoundToInt(FMath::Min(A.Y, B.Y));
+            const int32 MaxCol = FMath::RoundToInt(FMath::Max(A.Y, B.Y));
+
+            for (const int32 Index : Cells)
+            {
+                const int32 Row = Grid.GetRow(Index);
+                const int32 Col = Grid.GetCol(Index);
+                if (Row >= MinRow - 1 && Row <= MaxRow + 1 && Col >= MinCol - 1 && Col <= MaxCol + 1)
+                {
+                    bAffected = true;
+                    break;
+                }
+            }
+        }
+
+        if (bAffected)
+        {
+            Path->Invalidate();
+        }
+    }
+}
+
+// ==================== CELLS ====================
+
+int32 AMazeNavigationData::GetCellIndexAt(const FVector& Location) const
+{
+    if (!IsBuilt())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Row = FMath::RoundToInt(Location.X / CellSize);
+    const int32 Col = FMath::RoundToInt(Location.Y / CellSize);
+    return Grid.IsValid(Row, Col) ? Grid.ToIndex(Row, Col) : INDEX_NONE;
+}
+
+FVector AMazeNavigationData::GetCellCenter(int32 Index) const
+{
+    return FVector(Grid.GetRow(Index) * CellSize, Grid.GetCol(Index) * CellSize, FloorZ);
+}
+
+FBox AMazeNavigationData::GetBounds() const
+{
+    if (!IsBuilt())
+    {
+        return FBox(ForceInit);
+    }
+
+    const float HalfCell = CellSize * 0.5f;
+    return FBox(FVector(-HalfCell, -HalfCell, FloorZ - HalfCell),
+                FVector((Grid.Rows - 1) * CellSize + HalfCell, (Grid.Cols - 1) * CellSize + HalfCell, FloorZ + HalfCell));
+}
+
+bool AMazeNavigationData::DoesNodeContainLocation(NavNodeRef NodeRef, const FVector& WorldSpaceLocation) const
+{
+    const int32 Index = GetCellIndexAt(WorldSpaceLocation);
+    return Index != INDEX_NONE && static_cast<NavNodeRef>(Index) == NodeRef;
+}
+
+// ==================== PROJECTION ====================
+
+bool AMazeNavigationData::ProjectPoint(const FVector& Point, FNavLocation& OutLocation, const FVector& Extent,
+                                       FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    const int32 Index = GetCellIndexAt(Point);
+    if (Index == INDEX_NONE || FMath::Abs(Point.Z - FloorZ) > Extent.Z)
+    {
+        return false;
+    }
+
+    // Every cell floor is walkable, the point just drops onto it
+    OutLocation = FNavLocation(FVector(Point.X, Point.Y, FloorZ), static_cast<NavNodeRef>(Index));
+    return true;
+}
+
+void AMazeNavigationData::BatchProjectPoints(TArray<FNavigationProjectionWork>& Workload, const FVector& Extent,
+                                             FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    for (FNavigationProjectionWork& Work : Workload)
+    {
+        Work.bResult = ProjectPoint(Work.Point, Work.OutLocation, Extent, Filter, Querier);
+    }
+}
+
+void AMazeNavigationData::BatchProjectPoints(TArray<FNavigationProjectionWork>& Workload,
+                                             FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    BatchProjectPoints(Workload, GetDefaultQueryExtent(), Filter, Querier);
+}
+
+// ==================== RANDOM POINTS ====================
+
+FNavLocation AMazeNavigationData::GetRandomPoint(FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    if (!IsBuilt())
+    {
+        return FNavLocation();
+    }
+
+    const int32 Index = FMath::RandRange(0, Grid.Num() - 1);
+    return FNavLocation(GetCellCenter(Index), static_cast<NavNodeRef>(Index));
+}
+
+bool AMazeNavigationData::GetRandomReachablePointInRadius(const FVector& Origin, float Radius, FNavLocation& OutResult,
+                                                          FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    const int32 OriginIndex = GetCellIndexAt(Origin);
+    if (OriginIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&SearchLock);
+
+    Search.ComputeCostField(Grid, TArrayView<const uint8>(), FMazeCostProfile::Uniform(), OriginIndex, CostScratch);
+
+    const float RadiusSquared = Radius * Radius;
+    CandidateScratch.Reset();
+    for (int32 Index = 0; Index < Grid.Num(); Index++)
+    {
+        if (CostScratch[Index] >= 0 && FVector::DistSquared2D(GetCellCenter(Index), Origin) <= RadiusSquared)
+        {
+            CandidateScratch.Add(Index);
+        }
+    }
+
+    const int32 Index = CandidateScratch.Num() > 0 ? CandidateScratch[FMath::RandRange(0, CandidateScratch.Num() - 1)] : OriginIndex;
+    OutResult = FNavLocation(GetCellCenter(Index), static_cast<NavNodeRef>(Index));
+    return true;
+}
+
+bool AMazeNavigationData::GetRandomPointInNavigableRadius(const FVector& Origin, float Radius, FNavLocation& OutResult,
+                                                          FSharedConstNavQueryFilter Filter, const UObject* Querier) const
+{
+    if (!IsBuilt())
+    {
+        return false;
+    }
+
+    // Cells whose centers fall in the radius, picked from the bounding square of rows and columns
+    const int32 MinRow = FMath::Max(0, FMath::CeilToInt((Origin.X - Radius) / CellSize));
+    const int32 MaxRow = FMath::Min(Grid.Rows - 1, FMath::FloorToInt((Origin.X + Radius) / CellSize));
+    const int32 MinCol = FMath::Max(0, FMath::CeilToInt((Origin.Y - Radius) / CellSize));
+    const int32 MaxCol = FMath::Min(Grid.Cols - 1, FMath::FloorToInt((Origin.Y + Radius) / CellSize));
+
+    const float RadiusSquared = Radius * Radius;
+    for (int32 Attempt = 0; Attempt < 16 && MinRow <= MaxRow && MinCol <= MaxCol; Attempt++)
+    {
+        const int32 Index = Grid.ToIndex(FMath::RandRange(MinRow, MaxRow), FMath::RandRange(MinCol, MaxCol));
+        if (FVector::DistSquared2D(GetCellCenter(Index), Origin) <= RadiusSquared)
+        {
+            OutResult = FNavLocation(GetCellCenter(Index), static_cast<NavNodeRef>(Index));
+            return true;
+        }
+    }
+
+    const int32 OriginIndex = GetCellIndexAt(Origin);
+    if (OriginIndex == INDEX_NONE)
+    {
+        return false;
+    }
+    OutResult = FNavLocation(GetCellCenter(OriginIndex), static_cast<NavNodeRef>(OriginIndex));
+    return true;
+}
+
+// ==================== PATHS ====================
+
+bool AMazeNavigationData::SearchCells(int32 StartIndex, int32 GoalIndex) const
+{
+    return Search.FindPath(Grid, TArrayView<const uint8>(), FMazeCostProfile::Uniform(), StartIndex, GoalIndex, CellPathScratch);
+}
+
+void AMazeNavigationData::BuildPathPoints(const FVector& Start, const FVector& End, float AgentRadius, TArray<FNavPathPoint>& OutPoints) const
+{
+    const float Clearance = GetClearance(AgentRadius);
+    Smoother.SmoothPath(Grid, CellPathScratch, Clearance, CornerScratch);
+
+    const FVector StartPoint(Start.X, Start.Y, FloorZ);
+    const FVector EndPoint(End.X, End.Y, FloorZ);
+    const int32 StartCell = CellPathScratch[0];
+    const int32 GoalCell = CellPathScratch.Last();
+
+    OutPoints.Reset();
+    OutPoints.Add(FNavPathPoint(StartPoint, static_cast<NavNodeRef>(StartCell)));
+
+    // The corners are clear from cell center to cell center; the real start and end points may
+    // sit off center, so route through the center when that line would clip a wall
+    const int32 FirstTurn = CornerScratch.Num() > 2 ? CellPathScratch[CornerScratch[1]] : GoalCell;
+    if (!Smoother.HasLineOfSight(Grid, ToGridSpace(StartPoint), FVector2D(Grid.GetRow(FirstTurn), Grid.GetCol(FirstTurn)), Clearance))
+    {
+        OutPoints.Add(FNavPathPoint(GetCellCenter(StartCell), static_cast<NavNodeRef>(StartCell)));
+    }
+
+    for (int32 Corner = 1; Corner < CornerScratch.Num() - 1; Corner++)
+    {
+        const int32 Cell = CellPathScratch[CornerScratch[Corner]];
+        OutPoints.Add(FNavPathPoint(GetCellCenter(Cell), static_cast<NavNodeRef>(Cell)));
+    }
+
+    const int32 LastTurn = CornerScratch.Num() > 2 ? CellPathScratch[CornerScratch[CornerScratch.Num() - 2]] : StartCell;
+    if (LastTurn != GoalCell &&
+        !Smoother.HasLineOfSight(Grid, FVector2D(Grid.GetRow(LastTurn), Grid.GetCol(LastTurn)), ToGridSpace(EndPoint), Clearance))
+    {
+        OutPoints.Add(FNavPathPoint(GetCellCenter(GoalCell), static_cast<NavNodeRef>(GoalCell)));
+    }
+
+    OutPoints.Add(FNavPathPoint(EndPoint, static_cast<NavNodeRef>(GoalCell)));
+}
+
+FPathFindingResult AMazeNavigationData::FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query)
+{
+    const AMazeNavigationData* Self = Cast<const AMazeNavigationData>(Query.NavData.Get());
+    if (!Self || !Self->IsBuilt())
+    {
+        return FPathFindingResult(ENavigationQueryResult::Error);
+    }
+
+    FPathFindingResult Result(ENavigationQueryResult::Error);
+    Result.Path = Query.PathInstanceToFill.IsValid() ? Query.PathInstanceToFill : Self->CreatePathInstance<FNavigationPath>(Query);
+
+    FNavigationPath* NavPath = Result.Path.Get();
+    if (!NavPath)
+    {
+        return Result;
+    }
+    if (Query.PathInstanceToFill.IsValid())
+    {
+        NavPath->ResetForRepath();
+    }
+
+    // The cell lookup reads the grid too, which the game thread may be resizing
+    FScopeLock Lock(&Self->SearchLock);
+    const int32 StartIndex = Self->GetCellIndexAt(Query.StartLocation);
+    const int32 GoalIndex = Self->GetCellIndexAt(Query.EndLocation);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE)
+    {
+        Result.Result = ENavigationQueryResult::Fail;
+        return Result;
+    }
+
+    if (!Self->SearchCells(StartIndex, GoalIndex))
+    {
+        Result.Result = ENavigationQueryResult::Fail;
+        return Result;
+    }
+
+    Self->BuildPathPoints(Query.StartLocation, Query.EndLocation, AgentProperties.AgentRadius, NavPath->GetPathPoints());
+    NavPath->MarkReady();
+    Result.Result = ENavigationQueryResult::Success;
+    return Result;
+}
+
+bool AMazeNavigationData::TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes)
+{
+    const AMazeNavigationData* Self = Cast<const AMazeNavigationData>(Query.NavData.Get());
+    if (!Self)
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&Self->SearchLock);
+    const int32 StartIndex = Self->GetCellIndexAt(Query.StartLocation);
+    const int32 GoalIndex = Self->GetCellIndexAt(Query.EndLocation);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const bool bFound = Self->SearchCells(StartIndex, GoalIndex);
+    if (NumVisitedNodes)
+    {
+        *NumVisitedNodes = Self->Search.GetLastExpansions();
+    }
+    return bFound;
+}
+
+ENavigationQueryResult::Type AMazeNavigationData::MeasurePath(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength) const
+{
+    FScopeLock Lock(&SearchLock);
+    const int32 StartIndex = GetCellIndexAt(PathStart);
+    const int32 GoalIndex = GetCellIndexAt(PathEnd);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE)
+    {
+        return ENavigationQueryResult::Error;
+    }
+
+    if (!SearchCells(StartIndex, GoalIndex))
+    {
+        return ENavigationQueryResult::Fail;
+    }
+
+    TArray<FNavPathPoint> PathPoints;
+    BuildPathPoints(PathStart, PathEnd, GetConfig().AgentRadius, PathPoints);
+
+    OutPathLength = 0.0;
+    for (int32 Point = 1; Point < PathPoints.Num(); Point++)
+    {
+        OutPathLength += FVector::Dist(PathPoints[Point - 1].Location, PathPoints[Point].Location);
+    }
+    return ENavigationQueryResult::Success;
+}
+
+ENavigationQueryResult::Type AMazeNavigationData::CalcPathCost(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathCost,
+                                                               FSharedConstNavQueryFilter QueryFilter, const UObject* Querier) const
+{
+    // Every floor costs the same, cost is length
+    return MeasurePath(PathStart, PathEnd, OutPathCost);
+}
+
+ENavigationQueryResult::Type AMazeNavigationData::CalcPathLength(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength,
+                                                                 FSharedConstNavQueryFilter QueryFilter, const UObject* Querier) const
+{
+    return MeasurePath(PathStart, PathEnd, OutPathLength);
+}
+
+ENavigationQueryResult::Type AMazeNavigationData::CalcPathLengthAndCost(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength,
+                                                                        FVector::FReal& OutPathCost, FSharedConstNavQueryFilter QueryFilter,
+                                                                        const UObject* Querier) const
+{
+    const ENavigationQueryResult::Type Result = MeasurePath(PathStart, PathEnd, OutPathLength);
+    OutPathCost = OutPathLength;
+    return Result;
+}
+
+// ==================== RAYCASTS ====================
+
+bool AMazeNavigationData::TraceWalls(const FVector& RayStart, const FVector& RayEnd, FVector& OutHitLocation) const
+{
+    if (!IsBuilt())
+    {
+        OutHitLocation = RayStart;
+        return true;
+    }
+
+    FScopeLock Lock(&SearchLock);
+
+    const FVector2D From = ToGridSpace(RayStart);
+    if (Smoother.HasLineOfSight(Grid, From, ToGridSpace(RayEnd), 0.0f))
+    {
+        OutHitLocation = RayEnd;
+        return false;
+    }
+
+    // Clear prefixes only get shorter past the first wall, bisect for it
+    float Clear = 0.0f;
+    float Blocked = 1.0f;
+    for (int32 Step = 0; Step < 12; Step++)
+    {
+        const float Mid = (Clear + Blocked) * 0.5f;
+        if (Smoother.HasLineOfSight(Grid, From, ToGridSpace(FMath::Lerp(RayStart, RayEnd, Mid)), 0.0f))
+        {
+            Clear = Mid;
+        }
+        else
+        {
+            Blocked = Mid;
+        }
+    }
+
+    OutHitLocation = FMath::Lerp(RayStart, RayEnd, Clear);
+    return true;
+}
+
+bool AMazeNavigationData::Raycast(const ANavigationData* NavDataInstance, const FVector& RayStart, const FVector& RayEnd, FVector& HitLocation,
+                                  FSharedConstNavQueryFilter QueryFilter, const UObject* Querier)
+{
+    const AMazeNavigationData* Self = Cast<const AMazeNavigationData>(NavDataInstance);
+    if (!Self)
+    {
+        HitLocation = RayStart;
+        return true;
+    }
+    return Self->TraceWalls(RayStart, RayEnd, HitLocation);
+}
+
+void AMazeNavigationData::BatchRaycast(TArray<FNavigationRaycastWork>& Workload, FSharedConstNavQueryFilter QueryFilter, const UObject* Querier) const
+{
+    for (FNavigationRaycastWork& Work : Workload)
+    {
+        FVector HitLocation;
+        Work.bDidHit = TraceWalls(Work.RayStart, Work.RayEnd, HitLocation);
+        Work.HitLocation = FNavLocation(HitLocation, static_cast<NavNodeRef>(FMath::Max(GetCellIndexAt(HitLocation), 0)));
+    }
+}
@@ -0,0 +1,850 @@
+// MazePathBenchmark.cpp
+#include "MazePathBenchmark.h"
+#include "MazeGrid.h"
+#include "MazeBitboard.h"
+#include "MazeJunctionGraph.h"
+#include "MazeDStarLite.h"
+#include "MazeDialSearch.h"
+#include "MazePathSmoother.h"
+#include "MazePerception.h"
+#include "MazeBeliefMap.h"
+#include "MazeCooperativePathfinder.h"
+#include "MazePathRequestQueue.h"
+#include "CustomQueue.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/MemoryBase.h"
+
+// ==================== ALLOCATION COUNTING ====================
+
+namespace
+{
+    // Forwards everything to the real allocator, counting the calls made from one thread
+    class FMazeCountingMalloc final : public FMalloc
+    {
+    public:
+        FMalloc* Inner = nullptr;
+        uint32 OwnerThreadId = 0;
+        int32 Count = 0;
+
+        virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+        {
+            Tally();
+            return Inner->Malloc(Size, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+        {
+            if (Size > 0)
+            {
+                Tally();
+            }
+            return Inner->Realloc(Original, Size, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return Inner->QuantizeSize(Size, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("MazeCountingMalloc"); }
+
+    private:
+        void Tally()
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == OwnerThreadId)
+            {
+                Count++;
+            }
+        }
+    };
+
+    // Never destroyed: another thread can still be inside it right after a scope closes
+    FMazeCountingMalloc& GetCountingMalloc()
+    {
+        static FMazeCountingMalloc* Instance = new FMazeCountingMalloc();
+        return *Instance;
+    }
+}
+
+FMazeAllocationScope::FMazeAllocationScope()
+{
+    FMazeCountingMalloc& Counter = GetCountingMalloc();
+    PreviousMalloc = GMalloc;
+
+    // Nested scopes share the proxy that is already installed
+    if (GMalloc != &Counter)
+    {
+        Counter.Inner = GMalloc;
+        Counter.OwnerThreadId = FPlatformTLS::GetCurrentThreadId();
+        GMalloc = &Counter;
+    }
+
+    StartCount = Counter.Count;
+}
+
+FMazeAllocationScope::~FMazeAllocationScope()
+{
+    GMalloc = PreviousMalloc;
+}
+
+int32 FMazeAllocationScope::GetCount() const
+{
+    return GetCountingMalloc().Count - StartCount;
+}
+
+// ==================== BENCHMARKS ====================
+
+template <typename TGrid>
+void FMazePathBenchmark::GenerateGrid(TGrid& OutGrid, int32 Rows, int32 Cols, float LoopProbability, int32 Seed)
+{
+    FRandomStream Random(Seed);
+    OutGrid.Init(Rows, Cols);
+
+    const int32 NumCells = OutGrid.Num();
+    if (NumCells == 0)
+    {
+        return;
+    }
+
+    // Iterative DFS so 1024x1024 grids do not blow the stack
+    TArray<uint8> Visited;
+    Visited.SetNumZeroed(NumCells);
+    TArray<int32> Stack;
+    Stack.Reserve(NumCells);
+
+    const int32 StartIndex = Random.RandRange(0, NumCells - 1);
+    Stack.Add(StartIndex);
+    Visited[StartIndex] = 1;
+
+    while (Stack.Num() > 0)
+    {
+        const int32 Current = Stack.Last();
+        const int32 Row = OutGrid.GetRow(Current);
+        const int32 Col = OutGrid.GetCol(Current);
+
+        int32 Options[TGrid::NumDirections];
+        int32 NumOptions = 0;
+        for (int32 Dir = 0; Dir < TGrid::NumDirections; Dir++)
+        {
+            const int32 NeighborRow = TGrid::GetNeighborRow(Row, Dir);
+            const int32 NeighborCol = TGrid::GetNeighborCol(Row, Col, Dir);
+            if (OutGrid.IsValid(NeighborRow, NeighborCol) && !Visited[OutGrid.ToIndex(NeighborRow, NeighborCol)])
+            {
+                Options[NumOptions++] = Dir;
+            }
+        }
+
+        if (NumOptions == 0)
+        {
+            Stack.Pop();
+            continue;
+        }
+
+        const int32 Dir = Options[Random.RandRange(0, NumOptions - 1)];
+        const int32 Neighbor = OutGrid.GetNeighborIndex(Current, Dir);
+        OutGrid.SetPassage(Current, Dir, true);
+        Visited[Neighbor] = 1;
+        Stack.Add(Neighbor);
+    }
+
+    // Extra openings, same budget as CreateMazeLoops
+    const int32 TargetLoops = FMath::FloorToInt(NumCells * LoopProbability);
+    for (int32 Loop = 0; Loop < TargetLoops; Loop++)
+    {
+        OutGrid.SetPassage(Random.RandRange(0, NumCells - 1), Random.RandRange(0, TGrid::NumDirections - 1), true);
+    }
+}
+
+template <typename TGrid>
+void FMazePathBenchmark::QueueBFS(const TGrid& Grid, int32 SourceIndex, TArray<int32>& OutDistances)
+{
+    OutDistances.Init(-1, Grid.Num());
+    if (SourceIndex < 0 || SourceIndex >= Grid.Num())
+    {
+        return;
+    }
+
+    CustomQueue<int32> Queue;
+    Queue.Enqueue(SourceIndex);
+    OutDistances[SourceIndex] = 0;
+
+    while (!Queue.IsEmpty())
+    {
+        const int32 Current = Queue.Front();
+        Queue.Dequeue();
+
+        for (const typename TGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+        {
+            if (OutDistances[Neighbor.Index] < 0)
+            {
+                OutDistances[Neighbor.Index] = OutDistances[Current] + 1;
+                Queue.Enqueue(Neighbor.Index);
+            }
+        }
+    }
+}
+
+template void FMazePathBenchmark::GenerateGrid<FMazeGrid>(FMazeGrid&, int32, int32, float, int32);
+template void FMazePathBenchmark::GenerateGrid<FMazeOctileGrid>(FMazeOctileGrid&, int32, int32, float, int32);
+template void FMazePathBenchmark::GenerateGrid<FMazeHexGrid>(FMazeHexGrid&, int32, int32, float, int32);
+template void FMazePathBenchmark::QueueBFS<FMazeGrid>(const FMazeGrid&, int32, TArray<int32>&);
+template void FMazePathBenchmark::QueueBFS<FMazeOctileGrid>(const FMazeOctileGrid&, int32, TArray<int32>&);
+template void FMazePathBenchmark::QueueBFS<FMazeHexGrid>(const FMazeHexGrid&, int32, TArray<int32>&);
+
+FString FMazePathBenchmark::RunDistanceFieldBenchmark(int32 Size, int32 Iterations, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    Iterations = FMath::Max(1, Iterations);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    FMazeBitboard Bitboard;
+    Bitboard.Build(Grid);
+
+    FRandomStream Random(Seed);
+    TArray<int32> Sources;
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        Sources.Add(Random.RandRange(0, Grid.Num() - 1));
+    }
+
+    TArray<int32> BitboardDistances;
+    TArray<int32> QueueDistances;
+    double BitboardSeconds = 0.0;
+    double QueueSeconds = 0.0;
+    int32 DenseLayers = 0;
+    int32 TotalLayers = 0;
+    int32 Mismatches = 0;
+
+    for (int32 Source : Sources)
+    {
+        double Start = FPlatformTime::Seconds();
+        Bitboard.ComputeDistanceField(Source, BitboardDistances);
+        BitboardSeconds += FPlatformTime::Seconds() - Start;
+        DenseLayers += Bitboard.GetLastDenseLayers();
+        TotalLayers += Bitboard.GetLastLayers();
+
+        Start = FPlatformTime::Seconds();
+        QueueBFS(Grid, Source, QueueDistances);
+        QueueSeconds += FPlatformTime::Seconds() - Start;
+
+        if (BitboardDistances != QueueDistances)
+        {
+            Mismatches++;
+        }
+    }
+
+    const double BitboardMicros = BitboardSeconds * 1000000.0 / Iterations;
+    const double QueueMicros = QueueSeconds * 1000000.0 / Iterations;
+
+    const FString Result = FString::Printf(
+        TEXT("[Benchmark] %dx%d distance field: bitboard %.1f us, queue BFS %.1f us (x%.1f), %d/%d dense layers, %d mismatches"),
+        Size, Size, BitboardMicros, QueueMicros, BitboardMicros > 0.0 ? QueueMicros / BitboardMicros : 0.0,
+        DenseLayers, TotalLayers, Mismatches);
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+FString FMazePathBenchmark::RunMultiSourceBenchmark(int32 Size, int32 NumSources, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    NumSources = FMath::Clamp(NumSources, 1, 256);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    FMazeBitboard Bitboard;
+    Bitboard.Build(Grid);
+
+    // Landmarks and sound sources spread over the maze, spawn candidates and all-pairs blocks are
+    // the cells around one spot (the NumSources nearest to a random cell)
+    FRandomStream Random(Seed);
+    TArray<int32> Scattered;
+    for (int32 i = 0; i < NumSources; i++)
+    {
+        Scattered.Add(Random.RandRange(0, Grid.Num() - 1));
+    }
+
+    TArray<int32> Distances;
+    QueueBFS(Grid, Random.RandRange(0, Grid.Num() - 1), Distances);
+    TArray<int32> Clustered;
+    for (int32 Distance = 0; Clustered.Num() < NumSources && Clustered.Num() < Grid.Num(); Distance++)
+    {
+        bool bAny = false;
+        for (int32 Cell = 0; Cell < Distances.Num() && Clustered.Num() < NumSources; Cell++)
+        {
+            if (Distances[Cell] == Distance)
+            {
+                Clustered.Add(Cell);
+                bAny = true;
+            }
+        }
+        if (!bAny)
+        {
+            break;
+        }
+    }
+
+    const FString Result = FString::Printf(TEXT("[Benchmark] %dx%d, %d sources: scattered %s; clustered %s"),
+        Size, Size, NumSources, *RunMultiSourceSet(Grid, Bitboard, Scattered), *RunMultiSourceSet(Grid, Bitboard, Clustered));
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+FString FMazePathBenchmark::RunMultiSourceSet(const FMazeGrid& Grid, FMazeBitboard& Bitboard, const TArray<int32>& Sources)
+{
+    FMazeDistancePlanes Planes;
+    double Start = FPlatformTime::Seconds();
+    Bitboard.ComputeDistancePlanes(Sources, Planes);
+    const double BatchMillis = (FPlatformTime::Seconds() - Start) * 1000.0;
+    const int32 SharedBatches = Bitboard.GetLastSharedBatches();
+
+    TArray<int32> Distances;
+    Start = FPlatformTime::Seconds();
+    for (int32 Source : Sources)
+    {
+        Bitboard.ComputeDistanceField(Source, Distances);
+    }
+    const double FieldMillis = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+    double QueueSeconds = 0.0;
+    int32 Mismatches = 0;
+    for (int32 Plane = 0; Plane < Sources.Num(); Plane++)
+    {
+        Start = FPlatformTime::Seconds();
+        QueueBFS(Grid, Sources[Plane], Distances);
+        QueueSeconds += FPlatformTime::Seconds() - Start;
+
+        const TArrayView<const uint16> PlaneView = Planes.GetPlane(Plane);
+        for (int32 Cell = 0; Cell < Distances.Num(); Cell++)
+        {
+            const uint16 Expected = Distances[Cell] < 0 ? FMazeDistancePlanes::Unreachable
+                : static_cast<uint16>(FMath::Min(Distances[Cell], static_cast<int32>(FMazeDistancePlanes::MaxDistance)));
+            if (PlaneView[Cell] != Expected)
+            {
+                Mismatches++;
+                break;
+            }
+        }
+    }
+    const double QueueMillis = QueueSeconds * 1000.0;
+
+    return FString::Printf(
+        TEXT("batch %.2f ms (%d/%d shared walks), single bitboard fields %.2f ms (x%.1f), queue BFS %.2f ms (x%.1f), %d mismatches"),
+        BatchMillis, SharedBatches, (Sources.Num() + 63) / 64, FieldMillis, BatchMillis > 0.0 ? FieldMillis / BatchMillis : 0.0,
+        QueueMillis, BatchMillis > 0.0 ? QueueMillis / BatchMillis : 0.0, Mismatches);
+}
+
+namespace
+{
+    struct FDijkstraEntry
+    {
+        int32 Cost;
+        int32 Cell;
+
+        bool operator<(const FDijkstraEntry& Other) const { return Cost < Other.Cost; }
+    };
+
+    // Reference Dijkstra with a binary heap and lazy deletion, same entry costs as FMazeDialSearch
+    void HeapDijkstra(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                      int32 SourceIndex, TArray<int32>& OutCosts, TArray<FDijkstraEntry>& Heap)
+    {
+        OutCosts.Init(MAX_int32, Grid.Num());
+        Heap.Reset();
+
+        OutCosts[SourceIndex] = 0;
+        Heap.HeapPush(FDijkstraEntry{ 0, SourceIndex });
+
+        while (Heap.Num() > 0)
+        {
+            FDijkstraEntry Entry;
+            Heap.HeapPop(Entry);
+            if (Entry.Cost != OutCosts[Entry.Cell])
+            {
+                continue;
+            }
+
+            for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Entry.Cell))
+            {
+                const int32 NewCost = Entry.Cost + Profile.GetCost(Terrain[Neighbor.Index]);
+                if (NewCost < OutCosts[Neighbor.Index])
+                {
+                    OutCosts[Neighbor.Index] = NewCost;
+                    Heap.HeapPush(FDijkstraEntry{ NewCost, Neighbor.Index });
+                }
+            }
+        }
+
+        for (int32& Cost : OutCosts)
+        {
+            if (Cost == MAX_int32)
+            {
+                Cost = -1;
+            }
+        }
+    }
+}
+
+FString FMazePathBenchmark::RunWeightedBenchmark(int32 Size, int32 Iterations, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    Iterations = FMath::Max(1, Iterations);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    // Roughly the in-game hazard density: 5% mud, 2% traps, one safe zone per 1000 cells
+    FRandomStream Random(Seed);
+    TArray<uint8> Terrain;
+    Terrain.SetNumZeroed(Grid.Num());
+    for (uint8& Flags : Terrain)
+    {
+        const float Roll = Random.FRand();
+        if (Roll < 0.05f) Flags = static_cast<uint8>(EMazeTerrain::Mud);
+        else if (Roll < 0.07f) Flags = static_cast<uint8>(EMazeTerrain::Trap);
+        else if (Roll < 0.071f) Flags = static_cast<uint8>(EMazeTerrain::SafeZone);
+    }
+
+    TArray<int32> Sources;
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        Sources.Add(Random.RandRange(0, Grid.Num() - 1));
+    }
+
+    const FMazeCostProfile Profile = FMazeCostProfile::Monster();
+    FMazeDialSearch Search;
+    TArray<int32> DialCosts;
+    TArray<int32> HeapCosts;
+    TArray<FDijkstraEntry> Heap;
+
+    // Warm both so neither pays for its first allocations inside the timing
+    Search.ComputeCostField(Grid, Terrain, Profile, Sources[0], DialCosts);
+    HeapDijkstra(Grid, Terrain, Profile, Sources[0], HeapCosts, Heap);
+
+    double DialSeconds = 0.0;
+    double HeapSeconds = 0.0;
+    int32 Mismatches = 0;
+
+    for (int32 Source : Sources)
+    {
+        double Start = FPlatformTime::Seconds();
+        Search.ComputeCostField(Grid, Terrain, Profile, Source, DialCosts);
+        DialSeconds += FPlatformTime::Seconds() - Start;
+
+        Start = FPlatformTime::Seconds();
+        HeapDijkstra(Grid, Terrain, Profile, Source, HeapCosts, Heap);
+        HeapSeconds += FPlatformTime::Seconds() - Start;
+
+        if (DialCosts != HeapCosts)
+        {
+            Mismatches++;
+        }
+    }
+
+    const double DialMicros = DialSeconds * 1000000.0 / Iterations;
+    const double HeapMicros = HeapSeconds * 1000000.0 / Iterations;
+
+    const FString Result = FString::Printf(
+        TEXT("[Benchmark] %dx%d weighted cost field (max cost %d): Dial %.1f us, heap Dijkstra %.1f us (x%.1f), %d mismatches"),
+        Size, Size, Profile.GetMaxCost(), DialMicros, HeapMicros, DialMicros > 0.0 ? HeapMicros / DialMicros : 0.0, Mismatches);
+
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Result);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    }
+    return Result;
+}
+
+FString FMazePathBenchmark::RunSmoothingBenchmark(int32 Size, int32 Iterations, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    Iterations = FMath::Max(1, Iterations);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    // In-game defaults: 200 units of clearance in 500 unit cells
+    const float Clearance = 0.4f;
+
+    FRandomStream Random(Seed);
+    FMazePathSmoother Smoother;
+    TArray<int32> Distances;
+    TArray<int32> Path;
+    TArray<int32> Corners;
+
+    double SmoothSeconds = 0.0;
+    int64 TotalCells = 0;
+    int64 TotalCorners = 0;
+    int64 TotalVisited = 0;
+
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        const int32 Start = Random.RandRange(0, Grid.Num() - 1);
+        const int32 Goal = Random.RandRange(0, Grid.Num() - 1);
+
+        // Shortest path by walking down the goal's distance field
+        QueueBFS(Grid, Goal, Distances);
+        Path.Reset();
+        for (int32 Cell = Start; Cell != INDEX_NONE && Distances[Cell] >= 0; )
+        {
+            Path.Add(Cell);
+            if (Cell == Goal)
+            {
+                break;
+            }
+
+            int32 Next = INDEX_NONE;
+            for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+            {
+                if (Distances[Neighbor.Index] == Distances[Cell] - 1)
+                {
+                    Next = Neighbor.Index;
+                    break;
+                }
+            }
+            Cell = Next;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        Smoother.SmoothPath(Grid, Path, Clearance, Corners);
+        SmoothSeconds += FPlatformTime::Seconds() - StartTime;
+
+        TotalCells += Path.Num();
+        TotalCorners += Corners.Num();
+        TotalVisited += Smoother.GetLastCellsVisited();
+    }
+
+    const FString Result = FString::Printf(
+        TEXT("[Benchmark] %dx%d path smoothing: %.1f cells -> %.1f waypoints, %.1f cells tested, %.2f us per path"),
+        Size, Size, static_cast<double>(TotalCells) / Iterations, static_cast<double>(TotalCorners) / Iterations,
+        static_cast<double>(TotalVisited) / Iterations, SmoothSeconds * 1000000.0 / Iterations);
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+FString FMazePathBenchmark::RunCooperativeBenchmark(int32 Size, int32 MaxAgents, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    MaxAgents = FMath::Clamp(MaxAgents, 2, 1024);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    // In-game defaults, every agent on the same goal like monsters on the player
+    const int32 Window = 8;
+    const int32 CrowdPenalty = 2;
+    const int32 Rounds = 20;
+    const int32 GoalIndex = Grid.ToIndex(Size / 2, Size / 2);
+
+    FMazeBitboard Bitboard;
+    Bitboard.Build(Grid);
+    TArray<int32> GoalDistances;
+    Bitboard.ComputeDistanceField(GoalIndex, GoalDistances);
+
+    FMazeReservationTable Table;
+    FMazeCooperativePathfinder Search;
+    TArray<int32> Positions;
+    TArray<int32> Path;
+
+    FString Result = FString::Printf(TEXT("[Benchmark] %dx%d cooperative window %d:"), Size, Size, Window);
+    for (int32 NumAgents = 2; NumAgents <= MaxAgents; NumAgents *= 2)
+    {
+        FRandomStream Random(Seed + NumAgents);
+        Table.Init(Grid.Num(), Window);
+        Positions.SetNum(NumAgents);
+        for (int32& Position : Positions)
+        {
+            Position = Random.RandRange(0, Grid.Num() - 1);
+        }
+
+        double PlanSeconds = 0.0;
+        int64 Expansions = 0;
+        for (int32 Step = 0; Step < Rounds; Step++)
+        {
+            for (int32 Agent = 0; Agent < NumAgents; Agent++)
+            {
+                const double StartTime = FPlatformTime::Seconds();
+                const bool bFound = Search.FindPath(Grid, Table, Agent, Positions[Agent], GoalIndex, GoalDistances, Step, Window, CrowdPenalty, Path);
+                PlanSeconds += FPlatformTime::Seconds() - StartTime;
+                Expansions += Search.GetLastExpansions();
+
+                // Everyone moves one cell along its plan before the next round replans
+                if (bFound && Path.Num() > 1 && Table.GetOwner(Path[1], Step + 1) == Agent)
+                {
+                    Positions[Agent] = Path[1];
+                }
+            }
+        }
+
+        const int32 Plans = NumAgents * Rounds;
+        Result += FString::Printf(TEXT(" %d agents %.2f us (%.1f expansions) per plan,"),
+                                  NumAgents, PlanSeconds * 1000000.0 / Plans, static_cast<double>(Expansions) / Plans);
+    }
+    Result.RemoveFromEnd(TEXT(","));
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+FString FMazePathBenchmark::RunBeliefMapBenchmark(int32 Size, int32 Iterations, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    Iterations = FMath::Max(1, Iterations);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+
+    // In-game defaults: 4 steps per second at 60 fps is about one step per update, sight range 8
+    const float Rate = 0.2f;
+    const int32 SightRange = 8;
+
+    FRandomStream Random(Seed);
+    FMazeBeliefMap Belief;
+    Belief.SyncWalls(Grid);
+    Belief.CollapseTo(Random.RandRange(0, Grid.Num() - 1));
+
+    // Spread first, a collapsed map is mostly zeros and flatters the timings
+    Belief.Diffuse(Size * 4, Rate);
+
+    double StepStart = FPlatformTime::Seconds();
+    const int32 Steps = Iterations * 100;
+    Belief.Diffuse(Steps, Rate);
+    const double StepMicros = (FPlatformTime::Seconds() - StepStart) * 1000000.0 / Steps;
+
+    TArray<int32> Visible;
+    double UpdateSeconds = 0.0;
+    int32 TotalCleared = 0;
+    for (int32 i = 0; i < Iterations; i++)
+    {
+        FMazePerception::GatherVisibleCells(Grid, Random.RandRange(0, Grid.Num() - 1), SightRange, Visible);
+        TotalCleared += Visible.Num();
+
+        const double StartTime = FPlatformTime::Seconds();
+        Belief.ClearCells(Visible);
+        Belief.Diffuse(1, Rate);
+        Belief.Normalize();
+        Belief.FindMostLikelyCell();
+        UpdateSeconds += FPlatformTime::Seconds() - StartTime;
+    }
+
+    const FString Result = FString::Printf(
+        TEXT("[Benchmark] %dx%d belief map: %.2f us per diffusion step, %.2f us per update (%.1f cells cleared, step, normalize, most likely cell)"),
+        Size, Size, StepMicros, UpdateSeconds * 1000000.0 / Iterations, static_cast<double>(TotalCleared) / Iterations);
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+namespace
+{
+    // Generation time, BFS time per field and the mean distance from a source to every reachable cell
+    template <typename TGrid>
+    FString MeasureTopology(const TCHAR* Name, int32 Size, int32 Iterations, int32 Seed)
+    {
+        TGrid Grid;
+        double Start = FPlatformTime::Seconds();
+        FMazePathBenchmark::GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+        const double GenerateMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+        FRandomStream Random(Seed);
+        TArray<int32> Distances;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; i++)
+        {
+            FMazePathBenchmark::QueueBFS(Grid, Random.RandRange(0, Grid.Num() - 1), Distances);
+        }
+        const double BFSMicros = (FPlatformTime::Seconds() - Start) * 1000000.0 / Iterations;
+
+        // Mean over the last field only, outside the timed loop
+        int64 DistanceSum = 0;
+        int64 Reached = 0;
+        for (int32 Distance : Distances)
+        {
+            if (Distance > 0)
+            {
+                DistanceSum += Distance;
+                Reached++;
+            }
+        }
+
+        return FString::Printf(TEXT("%s gen %.2f ms, BFS %.1f us, mean distance %.1f"),
+            Name, GenerateMs, BFSMicros, Reached > 0 ? static_cast<double>(DistanceSum) / Reached : 0.0);
+    }
+}
+
+FString FMazePathBenchmark::RunTopologyBenchmark(int32 Size, int32 Iterations, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+    Iterations = FMath::Max(1, Iterations);
+
+    const FString Result = FString::Printf(TEXT("[Benchmark] %dx%d topologies: %s | %s | %s"), Size, Size,
+        *MeasureTopology<FMazeGrid>(TEXT("square"), Size, Iterations, Seed),
+        *MeasureTopology<FMazeOctileGrid>(TEXT("8-way"), Size, Iterations, Seed),
+        *MeasureTopology<FMazeHexGrid>(TEXT("hex"), Size, Iterations, Seed));
+
+    UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    return Result;
+}
+
+FString FMazePathBenchmark::RunAllocationCheck(int32 Size, int32 Seed)
+{
+    Size = FMath::Clamp(Size, 2, 1024);
+
+    FMazeGrid Grid;
+    GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+    const int32 NumCells = Grid.Num();
+
+    FRandomStream Random(Seed);
+    TArray<int32> Queries;
+    for (int32 i = 0; i < 64; i++)
+    {
+        Queries.Add(Random.RandRange(0, NumCells - 1));
+    }
+
+    FMazeJunctionGraph Graph;
+    Graph.Build(Grid);
+    FMazeBitboard Bitboard;
+    Bitboard.Build(Grid);
+    FMazeDStarLite Planner;
+
+    // Result buffers are sized once up front, like the callers that keep them around
+    TArray<int32> Distances;
+    TArray<int32> Frontier;
+    TArray<int32> Path;
+    Distances.Reserve(NumCells);
+    Frontier.Reserve(NumCells);
+    Path.Reserve(NumCells);
+
+    // Plain BFS over the open-mask neighbor range
+    auto NeighborWalk = [&]()
+    {
+        for (int32 q = 0; q < Queries.Num(); q += 2)
+        {
+            Distances.Init(-1, NumCells);
+            Frontier.Reset();
+            Frontier.Add(Queries[q]);
+            Distances[Queries[q]] = 0;
+
+            for (int32 Head = 0; Head < Frontier.Num(); Head++)
+            {
+                const int32 Current = Frontier[Head];
+                for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+                {
+                    if (Distances[Neighbor.Index] < 0)
+                    {
+                        Distances[Neighbor.Index] = Distances[Current] + 1;
+                        Frontier.Add(Neighbor.Index);
+                    }
+                }
+            }
+        }
+    };
+
+    auto JunctionSearch = [&]()
+    {
+        for (int32 q = 0; q < Queries.Num(); q += 2)
+        {
+            Graph.FindPath(Grid, Queries[q], Queries[q + 1], Path);
+        }
+    };
+
+    // The monster's pattern: rooted at the monster (goal), which steps towards the player (start)
+    // and replans every step
+    auto IncrementalReplans = [&]()
+    {
+        int32 Goal = Queries[1];
+        Planner.Reset(Grid, Queries[0], Goal);
+        for (int32 Step = 0; Step < 64; Step++)
+        {
+            if (!Planner.FindPath(Grid, Queries[0], Goal, Path) || Path.Num() < 2)
+            {
+                break;
+            }
+            Goal = Path[Path.Num() - 2];
+        }
+    };
+
+    auto BitboardFields = [&]()
+    {
+        for (int32 q = 0; q < Queries.Num(); q += 2)
+        {
+            Bitboard.ComputeDistanceField(Queries[q], Distances);
+        }
+    };
+
+    // First run sizes the scratch, only the second one is counted
+    auto CountWarm = [](auto& Body)
+    {
+        Body();
+        FMazeAllocationScope Scope;
+        Body();
+        return Scope.GetCount();
+    };
+
+    const int32 WalkAllocations = CountWarm(NeighborWalk);
+    const int32 JunctionAllocations = CountWarm(JunctionSearch);
+    const int32 ReplanAllocations = CountWarm(IncrementalReplans);
+    const int32 BitboardAllocations = CountWarm(BitboardFields);
+
+    // Path request queue: 32 requesters towards 4 goals (the monsters chasing a few targets).
+    // Enqueue stores the callbacks and is left out, only the Process calls that answer them count.
+    FMazePathRequestQueue PathQueue;
+    int32 PathsReady = 0;
+    auto QueueRound = [&]()
+    {
+        for (int32 q = 0; q < Queries.Num(); q += 2)
+        {
+            PathQueue.Enqueue(&Queries[q], Queries[q], Queries[1 + (q / 2) % 4 * 2], EMazePathPriority::Normal,
+                              [&PathsReady](const TArray<int32>&) { PathsReady++; });
+        }
+
+        FMazeAllocationScope Scope;
+        while (PathQueue.GetNumPending() > 0)
+        {
+            PathQueue.Process(Grid, 1000000.0);
+        }
+        return Scope.GetCount();
+    };
+    QueueRound();  // Sizes the queue's scratch and spare jobs
+    const int32 QueueAllocations = QueueRound();
+
+    // Generation allocates its wall masks, visited flags and DFS stack before the loop, nothing inside
+    // it: anything above those three is a per-cell allocation in the loop
+    const int32 GenerationBufferAllocations = 3;
+    int32 GenerationAllocations;
+    {
+        FMazeAllocationScope Scope;
+        GenerateGrid(Grid, Size, Size, 0.15f, Seed);
+        GenerationAllocations = Scope.GetCount();
+    }
+
+    const bool bPassed = WalkAllocations == 0 && JunctionAllocations == 0 && ReplanAllocations == 0 && BitboardAllocations == 0 &&
+                         QueueAllocations == 0 && GenerationAllocations <= GenerationBufferAllocations;
+
+    const FString Result = FString::Printf(
+        TEXT("[AllocCheck] %dx%d warmed loops: neighbor walk %d, junction A* %d, D* Lite %d, bitboard %d, path queue %d allocations (%d paths); generation %d (up to %d up-front buffers) - %s"),
+        Size, Size, WalkAllocations, JunctionAllocations, ReplanAllocations, BitboardAllocations, QueueAllocations, PathsReady,
+        GenerationAllocations, GenerationBufferAllocations,
+        bPassed ? TEXT("PASS") : TEXT("FAIL"));
+
+    if (bPassed)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Result);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Result);
+    }
+    return Result;
+}
@@ -0,0 +1,38 @@
+// MazePathBenchmarkCommandlet.cpp
+#include "MazePathBenchmarkCommandlet.h"
+#include "MazePathBenchmarkSuite.h"
+#include "Misc/Parse.h"
+
+UMazePathBenchmarkCommandlet::UMazePathBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMazePathBenchmarkCommandlet::Main(const FString& Params)
+{
+    FMazeBenchmarkSuiteSettings Settings;
+    FParse::Value(*Params, TEXT("queries="), Settings.QueriesPerMaze);
+    FParse::Value(*Params, TEXT("seed="), Settings.Seed);
+
+    int32 MaxSize = 0;
+    if (FParse::Value(*Params, TEXT("maxsize="), MaxSize))
+    {
+        Settings.Sizes.RemoveAll([MaxSize](int32 Size) { return Size > MaxSize; });
+    }
+
+    FString CsvPath;
+    if (!FParse::Value(*Params, TEXT("csv="), CsvPath))
+    {
+        CsvPath = FMazePathBenchmarkSuite::GetDefaultCsvPath();
+    }
+
+    TArray<FMazeBenchmarkRow> Rows;
+    const int32 Mismatches = FMazePathBenchmarkSuite::Run(Settings, Rows);
+    const bool bWritten = FMazePathBenchmarkSuite::WriteCsv(Rows, CsvPath);
+
+    UE_LOG(LogTemp, Display, TEXT("[MazePathBenchmark] %d rows, %d mismatches"), Rows.Num(), Mismatches);
+    return Mismatches == 0 && bWritten ? 0 : 1;
+}
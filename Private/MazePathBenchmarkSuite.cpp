@@ -0,0 +1,492 @@
+// MazePathBenchmarkSuite.cpp
+#include "MazePathBenchmarkSuite.h"
+#include "MazePathBenchmark.h"
+#include "MazeManager.h"
+#include "MazeCell.h"
+#include "MazeGrid.h"
+#include "MazeBitboard.h"
+#include "MazeJunctionGraph.h"
+#include "MazeDStarLite.h"
+#include "MazeDialSearch.h"
+#include "CustomQueue.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Algo/Reverse.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    struct FBenchmarkQuery
+    {
+        int32 Start;
+        int32 Goal;
+        int32 Distance;  // BFS optimum in steps, -1 = not connected
+    };
+
+    // Game world that only lives for the run: holds the AMazeManager whose cell-actor searches are
+    // measured. Created without telling the engine, so nothing renders or ticks it.
+    class FBenchmarkWorld
+    {
+    public:
+        FBenchmarkWorld()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MazeBenchmarkWorld"));
+            if (!World) return;
+
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            Manager = World->SpawnActor<AMazeManager>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+            if (Manager)
+            {
+                Manager->bProvideNavigationData = false;
+            }
+        }
+
+        ~FBenchmarkWorld()
+        {
+            if (World)
+            {
+                World->DestroyWorld(false);
+            }
+        }
+
+        AMazeManager* GetManager() const { return Manager; }
+
+    private:
+        UWorld* World = nullptr;
+        AMazeManager* Manager = nullptr;
+    };
+
+    // Cell-actor path -> NavGrid indices, so it is checked like the packed-grid answers
+    int32 ToIndexPath(const AMazeManager& Manager, const TArray<AMazeCell*>& CellPath, TArray<int32>& OutPath)
+    {
+        OutPath.Reset();
+        for (const AMazeCell* Cell : CellPath)
+        {
+            OutPath.Add(Manager.GetCellIndex(Cell));
+        }
+        return OutPath.Num() - 1;
+    }
+
+    // AMazeManager::FindPathBFS and FindPathAStar on the packed grid: same queue, same linear-scan
+    // open list, same reset of every cell per search. Only used above MaxCellActorSize, where
+    // spawning the cell actors for the originals is too slow.
+    class FLegacyGridSearch
+    {
+    public:
+        bool FindPathBFS(const FMazeGrid& Grid, int32 Start, int32 Goal, TArray<int32>& OutPath)
+        {
+            OutPath.Reset();
+            ResetCells(Grid.Num());
+            LastExpanded = 0;
+
+            Queue.Clear();
+            Queue.Reserve(Grid.Num());
+            Queue.Enqueue(Start);
+            Visited[Start] = true;
+
+            bool bFound = false;
+            while (!Queue.IsEmpty() && !bFound)
+            {
+                const int32 Current = Queue.Front();
+                Queue.Dequeue();
+                LastExpanded++;
+
+                if (Current == Goal)
+                {
+                    bFound = true;
+                    break;
+                }
+
+                for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+                {
+                    if (!Visited[Neighbor.Index])
+                    {
+                        Visited[Neighbor.Index] = true;
+                        Parent[Neighbor.Index] = Current;
+                        Queue.Enqueue(Neighbor.Index);
+                    }
+                }
+            }
+
+            if (bFound)
+            {
+                BuildPathFromParents(Goal, OutPath);
+            }
+            return bFound;
+        }
+
+        bool FindPathAStar(const FMazeGrid& Grid, int32 Start, int32 Goal, TArray<int32>& OutPath)
+        {
+            OutPath.Reset();
+            ResetCells(Grid.Num());
+            LastExpanded = 0;
+
+            GScore[Start] = 0.0f;
+            FScore[Start] = Heuristic(Grid, Start, Goal);
+
+            OpenSet.Reset();
+            OpenSet.Add(Start);
+
+            while (OpenSet.Num() > 0)
+            {
+                int32 Current = OpenSet[0];
+                int32 CurrentIndex = 0;
+                for (int32 i = 1; i < OpenSet.Num(); i++)
+                {
+                    if (FScore[OpenSet[i]] < FScore[Current])
+                    {
+                        Current = OpenSet[i];
+                        CurrentIndex = i;
+                    }
+                }
+
+                if (Current == Goal)
+                {
+                    BuildPathFromParents(Goal, OutPath);
+                    return true;
+                }
+
+                OpenSet.RemoveAtSwap(CurrentIndex);
+                Visited[Current] = true;
+                LastExpanded++;
+
+                for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+                {
+                    if (Visited[Neighbor.Index])
+                    {
+                        continue;
+                    }
+
+                    const float TentativeGScore = GScore[Current] + 1.0f;
+                    if (TentativeGScore < GScore[Neighbor.Index])
+                    {
+                        const bool bInOpenSet = GScore[Neighbor.Index] < FLT_MAX;
+                        Parent[Neighbor.Index] = Current;
+                        GScore[Neighbor.Index] = TentativeGScore;
+                        FScore[Neighbor.Index] = TentativeGScore + Heuristic(Grid, Neighbor.Index, Goal);
+                        if (!bInOpenSet)
+                        {
+                            OpenSet.Add(Neighbor.Index);
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+
+        int32 GetLastExpanded() const { return LastExpanded; }
+
+    private:
+        static float Heuristic(const FMazeGrid& Grid, int32 From, int32 To)
+        {
+            return static_cast<float>(FMath::Abs(Grid.GetRow(To) - Grid.GetRow(From)) + FMath::Abs(Grid.GetCol(To) - Grid.GetCol(From)));
+        }
+
+        void ResetCells(int32 NumCells)
+        {
+            Visited.SetNumUninitialized(NumCells);
+            Parent.SetNumUninitialized(NumCells);
+            GScore.SetNumUninitialized(NumCells);
+            FScore.SetNumUninitialized(NumCells);
+            for (int32 Index = 0; Index < NumCells; Index++)
+            {
+                Visited[Index] = false;
+                Parent[Index] = INDEX_NONE;
+                GScore[Index] = FLT_MAX;
+                FScore[Index] = FLT_MAX;
+            }
+        }
+
+        void BuildPathFromParents(int32 Goal, TArray<int32>& OutPath) const
+        {
+            for (int32 Cell = Goal; Cell != INDEX_NONE; Cell = Parent[Cell])
+            {
+                OutPath.Add(Cell);
+            }
+            Algo::Reverse(OutPath);
+        }
+
+        TArray<bool> Visited;
+        TArray<int32> Parent;
+        TArray<float> GScore;
+        TArray<float> FScore;
+        TArray<int32> OpenSet;
+        CustomQueue<int32> Queue;
+        int32 LastExpanded = 0;
+    };
+
+    // Start..Goal, consecutive cells connected by an open passage
+    bool IsWalkablePath(const FMazeGrid& Grid, const TArray<int32>& Path, int32 Start, int32 Goal)
+    {
+        if (Path.Num() == 0 || Path[0] != Start || Path.Last() != Goal)
+        {
+            return false;
+        }
+
+        for (int32 Step = 1; Step < Path.Num(); Step++)
+        {
+            bool bConnected = false;
+            for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Path[Step - 1]))
+            {
+                if (Neighbor.Index == Path[Step])
+                {
+                    bConnected = true;
+                    break;
+                }
+            }
+            if (!bConnected)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Nearest-rank percentile of sorted samples
+    double Percentile(const TArray<double>& Sorted, double Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0;
+        }
+        const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+
+    // Runs Search over every query, one call each, timed and under the allocation counter.
+    // Search(Start, Goal, OutPath, OutExpanded) returns the distance in steps (-1 = no path); it
+    // may leave OutPath empty when it only answers distances.
+    template <typename TSearch>
+    FMazeBenchmarkRow MeasureSearch(const FMazeGrid& Grid, const TArray<FBenchmarkQuery>& Queries, const TCHAR* Algorithm, TSearch&& Search)
+    {
+        FMazeBenchmarkRow Row;
+        Row.Algorithm = Algorithm;
+        Row.Queries = Queries.Num();
+
+        TArray<int32> Path;
+        Path.Reserve(Grid.Num());
+        TArray<double> Micros;
+        Micros.Reserve(Queries.Num());
+        int64 TotalExpanded = 0;
+        int64 TotalAllocations = 0;
+
+        // Warm-up: grows the scratch buffers. Reversed so D* Lite still restarts on the first query.
+        if (Queries.Num() > 0)
+        {
+            int32 Expanded = 0;
+            Search(Queries[0].Goal, Queries[0].Start, Path, Expanded);
+        }
+
+        for (const FBenchmarkQuery& Query : Queries)
+        {
+            int32 Expanded = 0;
+            int32 Distance;
+            double Seconds;
+            {
+                FMazeAllocationScope Allocations;
+                const double StartTime = FPlatformTime::Seconds();
+                Distance = Search(Query.Start, Query.Goal, Path, Expanded);
+                Seconds = FPlatformTime::Seconds() - StartTime;
+                TotalAllocations += Allocations.GetCount();
+            }
+
+            Micros.Add(Seconds * 1000000.0);
+            TotalExpanded += Expanded;
+
+            const bool bPathValid = Distance < 0 || Path.Num() == 0 ||
+                                    (IsWalkablePath(Grid, Path, Query.Start, Query.Goal) && Path.Num() - 1 == Distance);
+            if (Distance != Query.Distance || !bPathValid)
+            {
+                Row.Mismatches++;
+            }
+        }
+
+        Micros.Sort();
+        Row.P50 = Percentile(Micros, 0.50);
+        Row.P90 = Percentile(Micros, 0.90);
+        Row.P99 = Percentile(Micros, 0.99);
+        Row.Max = Micros.Num() > 0 ? Micros.Last() : 0.0;
+
+        const double NumQueries = FMath::Max(1, Queries.Num());
+        Row.MeanExpanded = TotalExpanded / NumQueries;
+        Row.AllocationsPerQuery = TotalAllocations / NumQueries;
+        return Row;
+    }
+}
+
+int32 FMazePathBenchmarkSuite::Run(const FMazeBenchmarkSuiteSettings& Settings, TArray<FMazeBenchmarkRow>& OutRows)
+{
+    OutRows.Reset();
+    int32 TotalMismatches = 0;
+
+    FMazeGrid Grid;
+    FBenchmarkWorld BenchmarkWorld;
+    AMazeManager* Manager = BenchmarkWorld.GetManager();
+    FLegacyGridSearch Legacy;
+    FMazeJunctionGraph JunctionGraph;
+    FMazeDStarLite DStarLite;
+    FMazeDialSearch Dial;
+    FMazeBitboard Bitboard;
+    const FMazeCostProfile Uniform = FMazeCostProfile::Uniform();
+
+    TArray<FBenchmarkQuery> Queries;
+    TArray<int32> Distances;
+    TArray<int32> DistanceScratch;
+
+    for (const int32 RequestedSize : Settings.Sizes)
+    {
+        const int32 Size = FMath::Clamp(RequestedSize, 2, 1024);
+
+        for (const float LoopProbability : Settings.LoopProbabilities)
+        {
+            // Fixed corpus: the maze and its queries depend only on the seed, size and loop probability
+            const int32 MazeSeed = Settings.Seed + Size;
+            FMazePathBenchmark::GenerateGrid(Grid, Size, Size, LoopProbability, MazeSeed);
+            JunctionGraph.Build(Grid);
+            Bitboard.Build(Grid);
+
+            FRandomStream Random(MazeSeed);
+            Queries.Reset();
+            for (int32 i = 0; i < FMath::Max(1, Settings.QueriesPerMaze); i++)
+            {
+                FBenchmarkQuery& Query = Queries.AddDefaulted_GetRef();
+                Query.Start = Random.RandRange(0, Grid.Num() - 1);
+                Query.Goal = Random.RandRange(0, Grid.Num() - 1);
+                FMazePathBenchmark::QueueBFS(Grid, Query.Start, Distances);
+                Query.Distance = Distances[Query.Goal];
+            }
+
+            const int32 FirstRow = OutRows.Num();
+
+            if (Manager && Size <= Settings.MaxCellActorSize)
+            {
+                // The shipped searches, on cell actors carrying this maze's walls
+                Manager->BuildFromGrid(Grid);
+
+                OutRows.Add(MeasureSearch(Grid, Queries, TEXT("BFS"),
+                    [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                    {
+                        const TArray<AMazeCell*> CellPath = Manager->FindPathBFS(Manager->GetCellByIndex(Start), Manager->GetCellByIndex(Goal));
+                        OutExpanded = 0;
+                        return ToIndexPath(*Manager, CellPath, OutPath);
+                    }));
+
+                OutRows.Add(MeasureSearch(Grid, Queries, TEXT("AStar"),
+                    [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                    {
+                        const TArray<AMazeCell*> CellPath = Manager->FindPathAStar(Manager->GetCellByIndex(Start), Manager->GetCellByIndex(Goal));
+                        OutExpanded = 0;
+                        return ToIndexPath(*Manager, CellPath, OutPath);
+                    }));
+            }
+            else
+            {
+                FMazeBenchmarkRow& BFSMirror = OutRows.Add_GetRef(MeasureSearch(Grid, Queries, TEXT("BFSMirror"),
+                    [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                    {
+                        const bool bFound = Legacy.FindPathBFS(Grid, Start, Goal, OutPath);
+                        OutExpanded = Legacy.GetLastExpanded();
+                        return bFound ? OutPath.Num() - 1 : -1;
+                    }));
+                BFSMirror.bMirror = true;
+
+                if (Size <= Settings.MaxLegacyAStarSize)
+                {
+                    FMazeBenchmarkRow& AStarMirror = OutRows.Add_GetRef(MeasureSearch(Grid, Queries, TEXT("AStarMirror"),
+                        [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                        {
+                            const bool bFound = Legacy.FindPathAStar(Grid, Start, Goal, OutPath);
+                            OutExpanded = Legacy.GetLastExpanded();
+                            return bFound ? OutPath.Num() - 1 : -1;
+                        }));
+                    AStarMirror.bMirror = true;
+                }
+            }
+
+            OutRows.Add(MeasureSearch(Grid, Queries, TEXT("Junction"),
+                [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                {
+                    const bool bFound = JunctionGraph.FindPath(Grid, Start, Goal, OutPath);
+                    OutExpanded = JunctionGraph.GetLastNodesExpanded();
+                    return bFound ? OutPath.Num() - 1 : -1;
+                }));
+
+            OutRows.Add(MeasureSearch(Grid, Queries, TEXT("DStarLite"),
+                [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                {
+                    const bool bFound = DStarLite.FindPath(Grid, Start, Goal, OutPath);
+                    OutExpanded = DStarLite.GetLastExpansions();
+                    return bFound ? OutPath.Num() - 1 : -1;
+                }));
+
+            OutRows.Add(MeasureSearch(Grid, Queries, TEXT("Dial"),
+                [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                {
+                    const bool bFound = Dial.FindPath(Grid, TArrayView<const uint8>(), Uniform, Start, Goal, OutPath);
+                    OutExpanded = Dial.GetLastExpansions();
+                    return bFound ? OutPath.Num() - 1 : -1;
+                }));
+
+            // Distance only, expanded = cells reached before the early stop
+            OutRows.Add(MeasureSearch(Grid, Queries, TEXT("Bitboard"),
+                [&](int32 Start, int32 Goal, TArray<int32>& OutPath, int32& OutExpanded)
+                {
+                    OutPath.Reset();
+                    OutExpanded = Bitboard.ComputeDistanceField(Start, DistanceScratch, Goal);
+                    return DistanceScratch[Goal];
+                }));
+
+            for (int32 Index = FirstRow; Index < OutRows.Num(); Index++)
+            {
+                FMazeBenchmarkRow& Row = OutRows[Index];
+                Row.Size = Size;
+                Row.LoopProbability = LoopProbability;
+                Row.Seed = MazeSeed;
+                if (!Row.bMirror)
+                {
+                    TotalMismatches += Row.Mismatches;
+                }
+
+                UE_LOG(LogTemp, Log, TEXT("[BenchmarkSuite] %dx%d loops %.2f %-9s p50 %8.1f us  p99 %8.1f us  %9.1f expanded  %.2f allocs  %d mismatches"),
+                       Size, Size, LoopProbability, *Row.Algorithm, Row.P50, Row.P99, Row.MeanExpanded, Row.AllocationsPerQuery, Row.Mismatches);
+            }
+        }
+    }
+
+    if (TotalMismatches > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[BenchmarkSuite] %d answers differ from the BFS optimum"), TotalMismatches);
+    }
+    return TotalMismatches;
+}
+
+FString FMazePathBenchmarkSuite::ToCsv(const TArray<FMazeBenchmarkRow>& Rows)
+{
+    FString Csv = TEXT("size,loop_probability,seed,algorithm,mirror,queries,p50_us,p90_us,p99_us,max_us,mean_expanded,allocs_per_query,mismatches\n");
+    for (const FMazeBenchmarkRow& Row : Rows)
+    {
+        Csv += FString::Printf(TEXT("%d,%.2f,%d,%s,%d,%d,%.2f,%.2f,%.2f,%.2f,%.1f,%.2f,%d\n"),
+                               Row.Size, Row.LoopProbability, Row.Seed, *Row.Algorithm, Row.bMirror ? 1 : 0, Row.Queries,
+                               Row.P50, Row.P90, Row.P99, Row.Max, Row.MeanExpanded, Row.AllocationsPerQuery, Row.Mismatches);
+    }
+    return Csv;
+}
+
+FString FMazePathBenchmarkSuite::GetDefaultCsvPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("PathBenchmark-%s.csv"), *FDateTime::Now().ToString());
+}
+
+bool FMazePathBenchmarkSuite::WriteCsv(const TArray<FMazeBenchmarkRow>& Rows, const FString& Path)
+{
+    if (!FFileHelper::SaveStringToFile(ToCsv(Rows), *Path))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[BenchmarkSuite] Could not write %s"), *Path);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[BenchmarkSuite] Wrote %d rows to %s"), Rows.Num(), *Path);
+    return true;
+}
@@ -0,0 +1,166 @@
+// MazePathCache.cpp
+#include "MazePathCache.h"
+#include "MazeGrid.h"
+#include "Algo/Reverse.h"
+
+FString FMazePathCacheStats::ToString() const
+{
+    const int32 Lookups = Hits + Misses;
+    return FString::Printf(TEXT("%d hits / %d misses (%.0f%% hit rate), %d entries, %d direction bytes, %d invalidations, %d evictions"),
+        Hits, Misses, Lookups > 0 ? 100.0 * Hits / Lookups : 0.0, Entries, DirectionBytes, Invalidations, Evictions);
+}
+
+FMazePathCache::FMazePathCache()
+{
+    CacheWallVersion = 0;
+    CacheNumCells = 0;
+}
+
+void FMazePathCache::Reset()
+{
+    Entries.Reset();
+    DirectionPool.Reset();
+    Stats.Entries = 0;
+    Stats.DirectionBytes = 0;
+}
+
+void FMazePathCache::Validate(const FMazeGrid& Grid)
+{
+    if (CacheWallVersion == Grid.WallVersion && CacheNumCells == Grid.Num())
+    {
+        return;
+    }
+
+    if (Entries.Num() > 0)
+    {
+        Stats.Invalidations++;
+    }
+
+    Reset();
+    CacheWallVersion = Grid.WallVersion;
+    CacheNumCells = Grid.Num();
+}
+
+void FMazePathCache::MakeRoom(int32 Bytes)
+{
+    if (Entries.Num() < MaxEntries && DirectionPool.Num() + Bytes <= MaxDirectionBytes)
+    {
+        return;
+    }
+
+    Stats.Evictions++;
+    Reset();
+}
+
+bool FMazePathCache::FindPath(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath)
+{
+    Validate(Grid);
+    OutPath.Reset();
+
+    const FEntry* Entry = Entries.Find(MakeKey(StartIndex, GoalIndex));
+    if (Entry && Entry->PoolOffset != INDEX_NONE)
+    {
+        DecodePath(Grid, StartIndex, *Entry, OutPath);
+        Stats.Hits++;
+        return true;
+    }
+
+    // Paths are undirected, the reverse query is just as good
+    Entry = Entries.Find(MakeKey(GoalIndex, StartIndex));
+    if (Entry && Entry->PoolOffset != INDEX_NONE)
+    {
+        DecodePath(Grid, GoalIndex, *Entry, OutPath);
+        Algo::Reverse(OutPath);
+        Stats.Hits++;
+        return true;
+    }
+
+    Stats.Misses++;
+    return false;
+}
+
+bool FMazePathCache::FindDistance(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, int32& OutDistance)
+{
+    Validate(Grid);
+
+    const FEntry* Entry = Entries.Find(MakeKey(StartIndex, GoalIndex));
+    if (!Entry)
+    {
+        Entry = Entries.Find(MakeKey(GoalIndex, StartIndex));
+    }
+
+    if (Entry)
+    {
+        OutDistance = Entry->Distance;
+        Stats.Hits++;
+        return true;
+    }
+
+    Stats.Misses++;
+    return false;
+}
+
+void FMazePathCache::AddPath(const FMazeGrid& Grid, TArrayView<const int32> Path)
+{
+    Validate(Grid);
+    if (Path.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 Steps = Path.Num() - 1;
+    const int32 Bytes = (Steps + 3) / 4;
+    MakeRoom(Bytes);
+
+    const int32 Offset = DirectionPool.AddZeroed(Bytes);
+    for (int32 Step = 0; Step < Steps; Step++)
+    {
+        // Neighbor offsets are unique per direction (N/S checked first so Cols == 1 stays unambiguous)
+        const int32 Delta = Path[Step + 1] - Path[Step];
+        int32 Dir;
+        if (Delta == -Grid.Cols) Dir = 0;
+        else if (Delta == Grid.Cols) Dir = 2;
+        else if (Delta == 1) Dir = 1;
+        else if (Delta == -1) Dir = 3;
+        else
+        {
+            DirectionPool.SetNum(Offset);
+            UE_LOG(LogTemp, Warning, TEXT("[PathCache] Refusing a broken path (step %d: %d -> %d)"), Step, Path[Step], Path[Step + 1]);
+            return;
+        }
+
+        DirectionPool[Offset + Step / 4] |= Dir << ((Step % 4) * 2);
+    }
+
+    FEntry& Entry = Entries.FindOrAdd(MakeKey(Path[0], Path[Steps]));
+    Entry.Distance = Steps;
+    Entry.PoolOffset = Offset;
+
+    Stats.Entries = Entries.Num();
+    Stats.DirectionBytes = DirectionPool.Num();
+}
+
+void FMazePathCache::AddDistance(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, int32 Distance)
+{
+    Validate(Grid);
+    MakeRoom(0);
+
+    FEntry& Entry = Entries.FindOrAdd(MakeKey(StartIndex, GoalIndex));
+    Entry.Distance = Distance;
+
+    Stats.Entries = Entries.Num();
+}
+
+void FMazePathCache::DecodePath(const FMazeGrid& Grid, int32 StartIndex, const FEntry& Entry, TArray<int32>& OutPath) const
+{
+    OutPath.Reserve(Entry.Distance + 1);
+    OutPath.Add(StartIndex);
+
+    int32 Cell = StartIndex;
+    for (int32 Step = 0; Step < Entry.Distance; Step++)
+    {
+        const int32 Dir = (DirectionPool[Entry.PoolOffset + Step / 4] >> ((Step % 4) * 2)) & 3;
+        Cell = Grid.GetNeighborIndex(Cell, Dir);
+        OutPath.Add(Cell);
+    }
+}
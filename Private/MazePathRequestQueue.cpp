@@ -0,0 +1,263 @@
+// MazePathRequestQueue.cpp
+#include "MazePathRequestQueue.h"
+#include "MazeGrid.h"
+#include "HAL/PlatformTime.h"
+
+FString FMazePathQueueStats::ToString() const
+{
+    return FString::Printf(
+        TEXT("depth %d (peak %d), %d searches, %d requests, %d completed, %d coalesced, %d superseded, latency avg %.2f ms / max %.2f ms (%d frames), last frame %.1f us / %d expansions"),
+        QueueDepth, PeakQueueDepth, ActiveSearches, TotalRequests, TotalCompleted, TotalCoalesced, TotalSuperseded,
+        AverageLatencyMs, MaxLatencyMs, MaxFramesWaited, LastFrameMicros, LastFrameExpansions);
+}
+
+FMazePathRequestQueue::FMazePathRequestQueue()
+{
+    FrameCounter = 0;
+}
+
+void FMazePathRequestQueue::Enqueue(const void* Requester, int32 StartIndex, int32 GoalIndex, EMazePathPriority Priority, FOnPathReady OnReady)
+{
+    if (Requester)
+    {
+        Cancel(Requester);
+    }
+
+    FRequest Request;
+    Request.Requester = Requester;
+    Request.StartIndex = StartIndex;
+    Request.Priority = Priority;
+    Request.EnqueueTime = FPlatformTime::Seconds();
+    Request.EnqueueFrame = FrameCounter;
+    Request.OnReady = MoveTemp(OnReady);
+
+    Stats.TotalRequests++;
+    Stats.QueueDepth++;
+    Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, Stats.QueueDepth);
+
+    // Same goal = same search, the request just waits for its start to be reached
+    for (FSearchJob& Job : Jobs)
+    {
+        if (Job.GoalIndex == GoalIndex)
+        {
+            Job.Priority = FMath::Max(Job.Priority, Priority);
+            Job.Requests.Add(MoveTemp(Request));
+            Stats.TotalCoalesced++;
+            return;
+        }
+    }
+
+    FSearchJob& Job = SpareJobs.Num() > 0 ? Jobs.Add_GetRef(SpareJobs.Pop(false)) : Jobs.AddDefaulted_GetRef();
+    Job.bStarted = false;
+    Job.GoalIndex = GoalIndex;
+    Job.Priority = Priority;
+    Job.OldestEnqueueTime = Request.EnqueueTime;
+    Job.Requests.Add(MoveTemp(Request));
+    Stats.ActiveSearches = Jobs.Num();
+}
+
+void FMazePathRequestQueue::Cancel(const void* Requester)
+{
+    for (int32 JobIndex = Jobs.Num() - 1; JobIndex >= 0; JobIndex--)
+    {
+        TArray<FRequest>& Requests = Jobs[JobIndex].Requests;
+        for (int32 i = Requests.Num() - 1; i >= 0; i--)
+        {
+            if (Requests[i].Requester == Requester)
+            {
+                Requests.RemoveAtSwap(i, 1, false);
+                Stats.QueueDepth--;
+                Stats.TotalSuperseded++;
+            }
+        }
+
+        if (Requests.Num() == 0)
+        {
+            RetireJob(JobIndex);
+        }
+    }
+
+    Stats.ActiveSearches = Jobs.Num();
+}
+
+void FMazePathRequestQueue::Reset()
+{
+    Jobs.Reset();
+    Stats.QueueDepth = 0;
+    Stats.ActiveSearches = 0;
+}
+
+void FMazePathRequestQueue::Process(const FMazeGrid& Grid, double BudgetMicroseconds, int32 MaxExpansions)
+{
+    FrameCounter++;
+    Stats.LastFrameExpansions = 0;
+    Finished.Reset();
+    FinishedPaths.Reset();
+
+    const double StartTime = FPlatformTime::Seconds();
+    if (Jobs.Num() == 0)
+    {
+        Stats.LastFrameMicros = 0.0;
+        return;
+    }
+
+    const double Deadline = StartTime + BudgetMicroseconds / 1000000.0;
+
+    while (Jobs.Num() > 0)
+    {
+        const int32 JobIndex = PickNextJob();
+        FSearchJob& Job = Jobs[JobIndex];
+
+        // Walls changed under a half-done search: its distances are stale, start it over
+        if (!Job.bStarted || Job.WallVersion != Grid.WallVersion)
+        {
+            RestartJob(Grid, Job);
+        }
+
+        const int32 Slice = MaxExpansions > 0 ? FMath::Min(SliceExpansions, MaxExpansions - Stats.LastFrameExpansions) : SliceExpansions;
+        Stats.LastFrameExpansions += StepJob(Grid, Job, Slice);
+        ResolveRequests(Job);
+
+        if (Job.Requests.Num() == 0)
+        {
+            RetireJob(JobIndex);
+        }
+
+        const bool bBudgetSpent = MaxExpansions > 0 ? Stats.LastFrameExpansions >= MaxExpansions : FPlatformTime::Seconds() >= Deadline;
+        if (bBudgetSpent)
+        {
+            break;
+        }
+    }
+
+    Stats.ActiveSearches = Jobs.Num();
+
+    // Callbacks last: they are free to queue new requests
+    const double Now = FPlatformTime::Seconds();
+    for (FFinishedRequest& Done : Finished)
+    {
+        RecordLatency(Done.Request, Now);
+        if (Done.Request.OnReady)
+        {
+            PathScratch.Reset();
+            PathScratch.Append(FinishedPaths.GetData() + Done.PathStart, Done.PathLength);
+            Done.Request.OnReady(PathScratch);
+        }
+    }
+
+    Stats.LastFrameMicros = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+}
+
+void FMazePathRequestQueue::RestartJob(const FMazeGrid& Grid, FSearchJob& Job) const
+{
+    Job.bStarted = true;
+    Job.bExhausted = false;
+    Job.WallVersion = Grid.WallVersion;
+    Job.NextStep.Init(INDEX_NONE, Grid.Num());
+    Job.Frontier.Reset(Grid.Num());  // Every cell enters once, never grows mid-search
+    Job.FrontierHead = 0;
+
+    if (Job.GoalIndex < 0 || Job.GoalIndex >= Grid.Num())
+    {
+        Job.bExhausted = true;
+        return;
+    }
+
+    Job.NextStep[Job.GoalIndex] = Job.GoalIndex;
+    Job.Frontier.Add(Job.GoalIndex);
+}
+
+int32 FMazePathRequestQueue::StepJob(const FMazeGrid& Grid, FSearchJob& Job, int32 MaxExpansions) const
+{
+    int32 Expanded = 0;
+    while (Expanded < MaxExpansions && Job.FrontierHead < Job.Frontier.Num())
+    {
+        const int32 Current = Job.Frontier[Job.FrontierHead++];
+        Expanded++;
+
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Current))
+        {
+            if (Job.NextStep[Neighbor.Index] == INDEX_NONE)
+            {
+                Job.NextStep[Neighbor.Index] = Current;
+                Job.Frontier.Add(Neighbor.Index);
+            }
+        }
+    }
+
+    if (Job.FrontierHead >= Job.Frontier.Num())
+    {
+        Job.bExhausted = true;
+    }
+
+    return Expanded;
+}
+
+void FMazePathRequestQueue::ResolveRequests(FSearchJob& Job)
+{
+    for (int32 i = Job.Requests.Num() - 1; i >= 0; i--)
+    {
+        const int32 Start = Job.Requests[i].StartIndex;
+        const bool bValidStart = Job.NextStep.IsValidIndex(Start);
+        const bool bReached = bValidStart && Job.NextStep[Start] != INDEX_NONE;
+
+        // BFS order: a cell is reached by a shortest path the moment it is discovered
+        if (!bReached && !Job.bExhausted && bValidStart)
+        {
+            continue;
+        }
+
+        FFinishedRequest& Done = Finished.AddDefaulted_GetRef();
+        Done.PathStart = FinishedPaths.Num();
+        if (bReached)
+        {
+            for (int32 Cell = Start; ; Cell = Job.NextStep[Cell])
+            {
+                FinishedPaths.Add(Cell);
+                if (Cell == Job.GoalIndex)
+                {
+                    break;
+                }
+            }
+        }
+        Done.PathLength = FinishedPaths.Num() - Done.PathStart;
+
+        Done.Request = MoveTemp(Job.Requests[i]);
+        Job.Requests.RemoveAtSwap(i, 1, false);
+    }
+}
+
+void FMazePathRequestQueue::RetireJob(int32 JobIndex)
+{
+    if (SpareJobs.Num() < MaxSpareJobs)
+    {
+        SpareJobs.Add(MoveTemp(Jobs[JobIndex]));
+    }
+    Jobs.RemoveAtSwap(JobIndex, 1, false);
+}
+
+int32 FMazePathRequestQueue::PickNextJob() const
+{
+    // Highest priority first, oldest first within a priority
+    int32 Best = 0;
+    for (int32 i = 1; i < Jobs.Num(); i++)
+    {
+        if (Jobs[i].Priority > Jobs[Best].Priority ||
+            (Jobs[i].Priority == Jobs[Best].Priority && Jobs[i].OldestEnqueueTime < Jobs[Best].OldestEnqueueTime))
+        {
+            Best = i;
+        }
+    }
+    return Best;
+}
+
+void FMazePathRequestQueue::RecordLatency(const FRequest& Request, double Now)
+{
+    const double LatencyMs = (Now - Request.EnqueueTime) * 1000.0;
+
+    Stats.QueueDepth--;
+    Stats.TotalCompleted++;
+    Stats.AverageLatencyMs += (LatencyMs - Stats.AverageLatencyMs) / Stats.TotalCompleted;
+    Stats.MaxLatencyMs = FMath::Max(Stats.MaxLatencyMs, LatencyMs);
+    Stats.MaxFramesWaited = FMath::Max(Stats.MaxFramesWaited, static_cast<int32>(FrameCounter - Request.EnqueueFrame));
+}
@@ -0,0 +1,282 @@
+// MazePathSmoother.cpp
+#include "MazePathSmoother.h"
+#include "MazeGrid.h"
+
+namespace
+{
+    double PointSegmentDistanceSquared(const FVector2D& Point, const FVector2D& A, const FVector2D& B)
+    {
+        const FVector2D AB = B - A;
+        const double LengthSquared = AB.SizeSquared();
+        const double T = LengthSquared > 0.0 ? FMath::Clamp(FVector2D::DotProduct(Point - A, AB) / LengthSquared, 0.0, 1.0) : 0.0;
+        return (A + AB * T - Point).SizeSquared();
+    }
+
+    // Proper or touching intersection (collinear overlap counts as touching)
+    bool SegmentsIntersect(const FVector2D& P0, const FVector2D& P1, const FVector2D& Q0, const FVector2D& Q1)
+    {
+        const FVector2D P = P1 - P0;
+        const FVector2D Q = Q1 - Q0;
+        const double D0 = FVector2D::CrossProduct(P, Q0 - P0);
+        const double D1 = FVector2D::CrossProduct(P, Q1 - P0);
+        const double D2 = FVector2D::CrossProduct(Q, P0 - Q0);
+        const double D3 = FVector2D::CrossProduct(Q, P1 - Q0);
+        return ((D0 <= 0.0 && D1 >= 0.0) || (D0 >= 0.0 && D1 <= 0.0)) &&
+               ((D2 <= 0.0 && D3 >= 0.0) || (D2 >= 0.0 && D3 <= 0.0));
+    }
+
+    double SegmentDistanceSquared(const FVector2D& P0, const FVector2D& P1, const FVector2D& Q0, const FVector2D& Q1)
+    {
+        if (SegmentsIntersect(P0, P1, Q0, Q1))
+        {
+            return 0.0;
+        }
+        return FMath::Min(
+            FMath::Min(PointSegmentDistanceSquared(P0, Q0, Q1), PointSegmentDistanceSquared(P1, Q0, Q1)),
+            FMath::Min(PointSegmentDistanceSquared(Q0, P0, P1), PointSegmentDistanceSquared(Q1, P0, P1)));
+    }
+
+    // Edge Dir (North, East, South, West) of cell (Row, Col) in cell units
+    void GetWallSegment(int32 Row, int32 Col, int32 Dir, FVector2D& OutA, FVector2D& OutB)
+    {
+        const double Top = Row - 0.5;
+        const double Bottom = Row + 0.5;
+        const double Left = Col - 0.5;
+        const double Right = Col + 0.5;
+
+        switch (Dir)
+        {
+        case 0:  OutA = FVector2D(Top, Left);    OutB = FVector2D(Top, Right);    break;
+        case 1:  OutA = FVector2D(Top, Right);   OutB = FVector2D(Bottom, Right); break;
+        case 2:  OutA = FVector2D(Bottom, Left); OutB = FVector2D(Bottom, Right); break;
+        default: OutA = FVector2D(Top, Left);    OutB = FVector2D(Bottom, Left);  break;
+        }
+    }
+
+    // The agent's segment with the clearance around it
+    struct FSweptSegment
+    {
+        FVector2D From;
+        FVector2D To;
+        FVector2D Normal;        // Unit normal of the line through From and To
+        double LineOffset;       // Normal . From
+        double Clearance;
+        double ClearanceSquared;
+
+        FSweptSegment(const FVector2D& InFrom, const FVector2D& InTo, double InClearance)
+            : From(InFrom), To(InTo), Clearance(InClearance), ClearanceSquared(InClearance * InClearance)
+        {
+            const FVector2D Dir = To - From;
+            const double Length = FMath::Sqrt(Dir.SizeSquared());
+            Normal = Length > 0.0 ? FVector2D(-Dir.Y / Length, Dir.X / Length) : FVector2D(0.0, 0.0);
+            LineOffset = FVector2D::DotProduct(Normal, From);
+        }
+
+        bool IsWallClear(const FVector2D& A, const FVector2D& B) const
+        {
+            // Both ends of the wall beyond the clearance on the same side of the line: the
+            // segment (a piece of that line) cannot be closer. Rejects almost every wall.
+            const double DistanceA = FVector2D::DotProduct(Normal, A) - LineOffset;
+            const double DistanceB = FVector2D::DotProduct(Normal, B) - LineOffset;
+            if ((DistanceA > Clearance && DistanceB > Clearance) || (DistanceA < -Clearance && DistanceB < -Clearance))
+            {
+                return true;
+            }
+            return SegmentDistanceSquared(From, To, A, B) > ClearanceSquared;
+        }
+    };
+
+    // Walls within half a cell of the cell: its own four edges plus the edges leaving its corners
+    bool IsCellClear(const FMazeGrid& Grid, int32 Row, int32 Col, const FSweptSegment& Segment)
+    {
+        // Own walls (the outer boundary is always closed in the packed grid)
+        const int32 Index = Grid.ToIndex(Row, Col);
+        const uint8 Walls = Grid.WallMasks[Index];
+        FVector2D A;
+        FVector2D B;
+        for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+        {
+            if (Walls & (1 << Dir))
+            {
+                GetWallSegment(Row, Col, Dir, A, B);
+                if (!Segment.IsWallClear(A, B))
+                {
+                    return false;
+                }
+            }
+        }
+
+        // Edges leaving the corners: the side walls of the four neighbors. A segment that slips past
+        // a corner still has to keep its distance from the wall ending there.
+        for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+        {
+            const int32 NeighborRow = FMazeGrid::GetNeighborRow(Row, Dir);
+            const int32 NeighborCol = FMazeGrid::GetNeighborCol(Row, Col, Dir);
+            if (!Grid.IsValid(NeighborRow, NeighborCol))
+            {
+                continue;
+            }
+
+            const uint8 NeighborWalls = Grid.WallMasks[Grid.ToIndex(NeighborRow, NeighborCol)];
+            const int32 SideA = (Dir + 1) % FMazeGrid::NumDirections;
+            const int32 SideB = (Dir + 3) % FMazeGrid::NumDirections;
+            for (const int32 Side : { SideA, SideB })
+            {
+                if (NeighborWalls & (1 << Side))
+                {
+                    GetWallSegment(NeighborRow, NeighborCol, Side, A, B);
+                    if (!Segment.IsWallClear(A, B))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+FMazePathSmoother::FMazePathSmoother()
+{
+    CorridorStamp = 0;
+    LastCellsVisited = 0;
+}
+
+void FMazePathSmoother::SmoothPath(const FMazeGrid& Grid, TArrayView<const int32> Path, float Clearance, TArray<int32>& OutCorners)
+{
+    OutCorners.Reset();
+    LastCellsVisited = 0;
+
+    const int32 NumCells = Grid.Num();
+    const int32 Length = Path.Num();
+    if (Length == 0)
+    {
+        return;
+    }
+
+    for (const int32 Cell : Path)
+    {
+        if (Cell < 0 || Cell >= NumCells)
+        {
+            // Not a path on this grid, steer through every cell
+            for (int32 Index = 0; Index < Length; Index++)
+            {
+                OutCorners.Add(Index);
+            }
+            return;
+        }
+    }
+
+    // Stamp the corridor, a wrapped counter clears the stamps once every 4 billion calls
+    if (CorridorStamps.Num() != NumCells)
+    {
+        CorridorStamps.Init(0, NumCells);
+        CorridorStamp = 0;
+    }
+    if (++CorridorStamp == 0)
+    {
+        FMemory::Memzero(CorridorStamps.GetData(), CorridorStamps.Num() * sizeof(uint32));
+        CorridorStamp = 1;
+    }
+    for (const int32 Cell : Path)
+    {
+        CorridorStamps[Cell] = CorridorStamp;
+    }
+
+    // Greedy pull: extend the segment from the last corner as far along the path as it stays clear
+    OutCorners.Add(0);
+    int32 Anchor = 0;
+    FVector2D AnchorPoint(Grid.GetRow(Path[0]), Grid.GetCol(Path[0]));
+
+    for (int32 Index = 2; Index < Length; Index++)
+    {
+        const FVector2D Point(Grid.GetRow(Path[Index]), Grid.GetCol(Path[Index]));
+        if (!IsSegmentClear(Grid, AnchorPoint, Point, Clearance, true))
+        {
+            Anchor = Index - 1;
+            AnchorPoint = FVector2D(Grid.GetRow(Path[Anchor]), Grid.GetCol(Path[Anchor]));
+            OutCorners.Add(Anchor);
+        }
+    }
+
+    if (Length > 1)
+    {
+        OutCorners.Add(Length - 1);
+    }
+}
+
+bool FMazePathSmoother::HasLineOfSight(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To, float Clearance) const
+{
+    return IsSegmentClear(Grid, From, To, Clearance, false);
+}
+
+bool FMazePathSmoother::HasLineOfSight(const FMazeGrid& Grid, int32 FromIndex, int32 ToIndex, float Clearance) const
+{
+    if (FromIndex < 0 || FromIndex >= Grid.Num() || ToIndex < 0 || ToIndex >= Grid.Num())
+    {
+        return false;
+    }
+    return IsSegmentClear(Grid, FVector2D(Grid.GetRow(FromIndex), Grid.GetCol(FromIndex)),
+                          FVector2D(Grid.GetRow(ToIndex), Grid.GetCol(ToIndex)), Clearance, false);
+}
+
+bool FMazePathSmoother::IsSegmentClear(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To, float Clearance,
+                                       bool bCorridorOnly) const
+{
+    const FSweptSegment Segment(From, To, FMath::Clamp(Clearance, 0.0f, MaxClearance));
+
+    // Cell (Row, Col) covers [Row - 0.5, Row + 0.5), shifting by half a cell makes that a floor
+    const FVector2D Start = From + FVector2D(0.5, 0.5);
+    const FVector2D End = To + FVector2D(0.5, 0.5);
+
+    int32 Row = FMath::FloorToInt(Start.X);
+    int32 Col = FMath::FloorToInt(Start.Y);
+    const int32 EndRow = FMath::FloorToInt(End.X);
+    const int32 EndCol = FMath::FloorToInt(End.Y);
+    if (!Grid.IsValid(Row, Col) || !Grid.IsValid(EndRow, EndCol))
+    {
+        return false;
+    }
+
+    // Amanatides-Woo traversal: T is the fraction of the segment at which the next row / column line is crossed
+    const FVector2D Delta = End - Start;
+    const int32 StepRow = Delta.X > 0.0 ? 1 : -1;
+    const int32 StepCol = Delta.Y > 0.0 ? 1 : -1;
+    const double TDeltaRow = Delta.X != 0.0 ? 1.0 / FMath::Abs(Delta.X) : MAX_dbl;
+    const double TDeltaCol = Delta.Y != 0.0 ? 1.0 / FMath::Abs(Delta.Y) : MAX_dbl;
+    double TMaxRow = Delta.X != 0.0 ? (StepRow > 0 ? Row + 1 - Start.X : Start.X - Row) * TDeltaRow : MAX_dbl;
+    double TMaxCol = Delta.Y != 0.0 ? (StepCol > 0 ? Col + 1 - Start.Y : Start.Y - Col) * TDeltaCol : MAX_dbl;
+
+    const int32 NumSteps = FMath::Abs(EndRow - Row) + FMath::Abs(EndCol - Col);
+    for (int32 Step = 0; ; Step++)
+    {
+        LastCellsVisited++;
+
+        if (bCorridorOnly && CorridorStamps[Grid.ToIndex(Row, Col)] != CorridorStamp)
+        {
+            return false;
+        }
+        if (!IsCellClear(Grid, Row, Col, Segment))
+        {
+            return false;
+        }
+        if (Step == NumSteps)
+        {
+            return true;
+        }
+
+        // The step count is exact, rounding can only pick the wrong axis once the other one is done
+        const bool bStepRow = Col == EndCol || (Row != EndRow && TMaxRow < TMaxCol);
+        if (bStepRow)
+        {
+            Row += StepRow;
+            TMaxRow += TDeltaRow;
+        }
+        else
+        {
+            Col += StepCol;
+            TMaxCol += TDeltaCol;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+// MazePerception.cpp
+#include "MazePerception.h"
+#include "MazeGrid.h"
+
+namespace
+{
+    // Wall bits of the edges a ray crosses stepping by +-1 row (South / North) or column (East / West)
+    uint8 RowStepWall(int32 StepRow) { return StepRow > 0 ? (1 << 2) : (1 << 0); }
+    uint8 ColStepWall(int32 StepCol) { return StepCol > 0 ? (1 << 1) : (1 << 3); }
+}
+
+FMazePerception::FMazePerception()
+    : PlayerIndex(INDEX_NONE)
+    , WallVersion(0)
+    , LastSightRange(0)
+    , LastHearingRange(0)
+    , LastRaysCast(0)
+{
+}
+
+bool FMazePerception::IsUpToDate(const FMazeGrid& Grid, int32 InPlayerIndex, int32 SightRange, int32 HearingRange) const
+{
+    return PlayerIndex == InPlayerIndex && WallVersion == Grid.WallVersion && Flags.Num() == Grid.Num() &&
+           LastSightRange == SightRange && LastHearingRange == HearingRange;
+}
+
+void FMazePerception::Update(const FMazeGrid& Grid, int32 InPlayerIndex, const TArray<int32>& PlayerDistances,
+                             int32 SightRange, int32 HearingRange)
+{
+    PlayerIndex = InPlayerIndex;
+    WallVersion = Grid.WallVersion;
+    LastSightRange = SightRange;
+    LastHearingRange = HearingRange;
+    LastRaysCast = 0;
+
+    // Hearing fills the whole plane in one pass, sight only touches the cells in range on top of it
+    const int32 NumCells = Grid.Num();
+    Flags.SetNumUninitialized(NumCells);
+    const bool bHasDistances = PlayerDistances.Num() == NumCells;
+    for (int32 Index = 0; Index < NumCells; Index++)
+    {
+        const int32 Distance = bHasDistances ? PlayerDistances[Index] : -1;
+        Flags[Index] = (Distance >= 0 && Distance <= HearingRange) ? static_cast<uint8>(EMazePerception::Heard) : 0;
+    }
+
+    if (PlayerIndex < 0 || PlayerIndex >= NumCells)
+    {
+        return;
+    }
+
+    // Sight is symmetric: the cells the player can see are the cells that can see the player
+    LastRaysCast = GatherVisibleCells(Grid, PlayerIndex, SightRange, VisibleScratch);
+    for (const int32 Index : VisibleScratch)
+    {
+        Flags[Index] |= static_cast<uint8>(EMazePerception::Seen);
+    }
+}
+
+int32 FMazePerception::GatherVisibleCells(const FMazeGrid& Grid, int32 FromIndex, int32 SightRange, TArray<int32>& OutCells)
+{
+    OutCells.Reset();
+    if (FromIndex < 0 || FromIndex >= Grid.Num())
+    {
+        return 0;
+    }
+
+    const int32 FromRow = Grid.GetRow(FromIndex);
+    const int32 FromCol = Grid.GetCol(FromIndex);
+    const FVector2D Eye(FromRow, FromCol);
+    const int32 RangeSquared = SightRange * SightRange;
+    int32 RaysCast = 0;
+
+    for (int32 Row = FMath::Max(FromRow - SightRange, 0); Row <= FMath::Min(FromRow + SightRange, Grid.Rows - 1); Row++)
+    {
+        for (int32 Col = FMath::Max(FromCol - SightRange, 0); Col <= FMath::Min(FromCol + SightRange, Grid.Cols - 1); Col++)
+        {
+            if (FMath::Square(Row - FromRow) + FMath::Square(Col - FromCol) > RangeSquared)
+            {
+                continue;
+            }
+
+            RaysCast++;
+            if (HasLineOfSight(Grid, Eye, FVector2D(Row, Col)))
+            {
+                OutCells.Add(Grid.ToIndex(Row, Col));
+            }
+        }
+    }
+    return RaysCast;
+}
+
+bool FMazePerception::HasLineOfSight(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To)
+{
+    // Cell (Row, Col) covers [Row - 0.5, Row + 0.5), shifting by half a cell makes that a floor
+    const FVector2D Start = From + FVector2D(0.5, 0.5);
+    const FVector2D End = To + FVector2D(0.5, 0.5);
+
+    int32 Row = FMath::FloorToInt(Start.X);
+    int32 Col = FMath::FloorToInt(Start.Y);
+    const int32 EndRow = FMath::FloorToInt(End.X);
+    const int32 EndCol = FMath::FloorToInt(End.Y);
+    if (!Grid.IsValid(Row, Col) || !Grid.IsValid(EndRow, EndCol))
+    {
+        return false;
+    }
+
+    // Amanatides-Woo traversal: T is the fraction of the segment at which the next row / column line
+    // is crossed. Only the edge crossed by each step is tested, one mask lookup per cell.
+    const FVector2D Delta = End - Start;
+    const int32 StepRow = Delta.X > 0.0 ? 1 : -1;
+    const int32 StepCol = Delta.Y > 0.0 ? 1 : -1;
+    const double TDeltaRow = Delta.X != 0.0 ? 1.0 / FMath::Abs(Delta.X) : MAX_dbl;
+    const double TDeltaCol = Delta.Y != 0.0 ? 1.0 / FMath::Abs(Delta.Y) : MAX_dbl;
+    double TMaxRow = Delta.X != 0.0 ? (StepRow > 0 ? Row + 1 - Start.X : Start.X - Row) * TDeltaRow : MAX_dbl;
+    double TMaxCol = Delta.Y != 0.0 ? (StepCol > 0 ? Col + 1 - Start.Y : Start.Y - Col) * TDeltaCol : MAX_dbl;
+
+    const uint8 RowWall = RowStepWall(StepRow);
+    const uint8 ColWall = ColStepWall(StepCol);
+
+    while (Row != EndRow || Col != EndCol)
+    {
+        const uint8 Walls = Grid.WallMasks[Grid.ToIndex(Row, Col)];
+
+        if (Row != EndRow && Col != EndCol && FMath::IsNearlyEqual(TMaxRow, TMaxCol, UE_KINDA_SMALL_NUMBER))
+        {
+            // Through a grid corner: both ways around it must be open
+            const uint8 RowNeighborWalls = Grid.WallMasks[Grid.ToIndex(Row + StepRow, Col)];
+            const uint8 ColNeighborWalls = Grid.WallMasks[Grid.ToIndex(Row, Col + StepCol)];
+            if ((Walls & (RowWall | ColWall)) || (RowNeighborWalls & ColWall) || (ColNeighborWalls & RowWall))
+            {
+                return false;
+            }
+            Row += StepRow;
+            Col += StepCol;
+            TMaxRow += TDeltaRow;
+            TMaxCol += TDeltaCol;
+            continue;
+        }
+
+        // The step count is exact, rounding can only pick the wrong axis once the other one is done
+        const bool bStepRow = Col == EndCol || (Row != EndRow && TMaxRow < TMaxCol);
+        if (bStepRow)
+        {
+            if (Walls & RowWall)
+            {
+                return false;
+            }
+            Row += StepRow;
+            TMaxRow += TDeltaRow;
+        }
+        else
+        {
+            if (Walls & ColWall)
+            {
+                return false;
+            }
+            Col += StepCol;
+            TMaxCol += TDeltaCol;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,45 @@
+// MazeSimulationClock.cpp
+#include "MazeSimulationClock.h"
+
+FMazeSimulationClock::FMazeSimulationClock()
+    : StepSeconds(1.0f / 60.0f)
+    , MaxStepsPerFrame(8)
+    , Accumulator(0.0f)
+    , Step(0)
+    , DroppedSeconds(0.0)
+{
+}
+
+void FMazeSimulationClock::Configure(float StepsPerSecond, int32 InMaxStepsPerFrame)
+{
+    StepSeconds = 1.0f / FMath::Clamp(StepsPerSecond, 10.0f, 240.0f);
+    MaxStepsPerFrame = FMath::Max(InMaxStepsPerFrame, 1);
+    Reset();
+}
+
+void FMazeSimulationClock::Reset()
+{
+    Accumulator = 0.0f;
+    Step = 0;
+    DroppedSeconds = 0.0;
+}
+
+int32 FMazeSimulationClock::Advance(float DeltaTime)
+{
+    Accumulator += FMath::Max(DeltaTime, 0.0f);
+
+    int32 Steps = FMath::FloorToInt(Accumulator / StepSeconds);
+    if (Steps > MaxStepsPerFrame)
+    {
+        // Keep the fraction so the next frame still lines up on the step grid
+        const float Dropped = (Steps - MaxStepsPerFrame) * StepSeconds;
+        DroppedSeconds += Dropped;
+        Accumulator -= Dropped;
+        Steps = MaxStepsPerFrame;
+    }
+
+    Accumulator -= Steps * StepSeconds;
+    Accumulator = FMath::Max(Accumulator, 0.0f);
+    Step += Steps;
+    return Steps;
+}
@@ -0,0 +1,437 @@
+// MazeStressTest.cpp
+#include "MazeStressTest.h"
+#include "MazeGameMode.h"
+#include "MazeManager.h"
+#include "MazeCell.h"
+#include "MonsterAI.h"
+#include "MonsterDirector.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    // Nearest-rank percentile of sorted samples
+    float Percentile(const TArray<float>& Sorted, float Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0f;
+        }
+        const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    }
+
+    // Walking distance monsters spawn from the player, and the player is moved by
+    constexpr int32 MinSpawnCells = 5;
+}
+
+AMazeStressTest::AMazeStressTest()
+    : GameMode(nullptr)
+    , StepIndex(0)
+    , SessionMazeSize(0)
+    , SessionHazards(0)
+    , bRunning(false)
+    , bExitWhenDone(false)
+    , bSampling(false)
+    , StepTimer(0.0f)
+    , RelocateTimer(0.0f)
+    , LastFrameSeconds(0.0)
+    , PathQueueSeconds(0.0)
+    , DirectorStartSeconds(0.0)
+    , CatchCheckStartSeconds(0.0)
+{
+    PrimaryActorTick.bCanEverTick = true;
+}
+
+bool AMazeStressTest::IsRequested()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("stresstest"));
+}
+
+void AMazeStressTest::Configure(AMazeGameMode* InGameMode)
+{
+    int32 MaxMonsters = MaxStressMonsters;
+    int32 MazeSize = 30;
+    int32 NumHazards = 20;
+
+    const TCHAR* CommandLine = FCommandLine::Get();
+    FParse::Value(CommandLine, TEXT("stressmonsters="), MaxMonsters);
+    FParse::Value(CommandLine, TEXT("stressmaze="), MazeSize);
+    FParse::Value(CommandLine, TEXT("stresshazards="), NumHazards);
+
+    bExitWhenDone = true;
+    Begin(InGameMode, MaxMonsters, MazeSize, NumHazards);
+}
+
+void AMazeStressTest::Begin(AMazeGameMode* InGameMode, int32 MaxMonsters, int32 MazeSize, int32 NumHazards)
+{
+    GameMode = InGameMode;
+    if (!GameMode || !GameMode->MazeManager || !GameMode->MonsterClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[StressTest] Cannot start: game mode, maze manager or monster class missing"));
+        return;
+    }
+
+    MaxMonsters = FMath::Clamp(MaxMonsters, 1, MaxStressMonsters);
+    SessionMazeSize = FMath::Clamp(MazeSize, 5, MaxStressMazeSize);
+    SessionHazards = FMath::Clamp(NumHazards, 0, SessionMazeSize * SessionMazeSize / 4);
+
+    // Same flow as a level start, with a maze the menus would not allow and no time limit
+    AMazeManager* MazeManager = GameMode->MazeManager;
+    GameMode->CleanupBeforeLevel();
+    GameMode->CurrentMazeRows = SessionMazeSize;
+    GameMode->CurrentMazeCols = SessionMazeSize;
+    GameMode->TotalGameTime = 24.0f * 60.0f * 60.0f;
+    GameMode->MonsterSpawnTime = -1.0f;
+    MazeManager->SetMazeSize(SessionMazeSize, SessionMazeSize, MaxStressMazeSize);
+    MazeManager->GenerateMazeImmediate();
+    GameMode->bMazeGenerated = true;
+    GameMode->SpawnPlayer();
+
+    // Half mud, half traps
+    if (SessionHazards > 0)
+    {
+        GameMode->SpawnMuddyPatches(SessionHazards - SessionHazards / 2);
+        GameMode->SpawnTrapCells(SessionHazards / 2);
+    }
+
+    GameMode->StartGame();
+
+    // Every mode walks the same counts, so the curves line up column for column
+    TArray<int32> Counts;
+    for (int32 Count : MonsterCounts)
+    {
+        if (Count >= 1 && Count <= MaxMonsters)
+        {
+            Counts.AddUnique(Count);
+        }
+    }
+    Counts.AddUnique(MaxMonsters);
+    Counts.Sort();
+
+    Steps.Reset();
+    for (EMazeStressAIMode Mode : { EMazeStressAIMode::Modern, EMazeStressAIMode::Legacy, EMazeStressAIMode::Director })
+    {
+        for (int32 Count : Counts)
+        {
+            Steps.Add(FStep{ Mode, Count });
+        }
+    }
+
+    Results.Reset();
+    StepIndex = 0;
+    bRunning = true;
+
+    UE_LOG(LogTemp, Warning, TEXT("[StressTest] %dx%d maze, %d hazards, up to %d monsters, %d steps of %.0f s"),
+           SessionMazeSize, SessionMazeSize, SessionHazards, MaxMonsters, Steps.Num(), WarmupSeconds + SampleSeconds);
+
+    StartStep();
+}
+
+void AMazeStressTest::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bRunning || !GameMode || !GameMode->MazeManager)
+    {
+        return;
+    }
+
+    const double NowSeconds = FPlatformTime::Seconds();
+    const float FrameMs = LastFrameSeconds > 0.0 ? static_cast<float>((NowSeconds - LastFrameSeconds) * 1000.0) : 0.0f;
+    LastFrameSeconds = NowSeconds;
+
+    RelocateTimer += DeltaTime;
+    if (RelocateTimer >= RelocateInterval)
+    {
+        RelocateTimer = 0.0f;
+        RelocatePlayer();
+    }
+
+    StepTimer += DeltaTime;
+    if (!bSampling)
+    {
+        if (StepTimer >= WarmupSeconds)
+        {
+            // Everything before here was warm-up
+            bSampling = true;
+            StepTimer = 0.0f;
+            FrameMilliseconds.Reset();
+            PathQueueSeconds = 0.0;
+            DirectorStartSeconds = GameMode->MonsterDirector ? GameMode->MonsterDirector->GetTotalStepSeconds() : 0.0;
+            CatchCheckStartSeconds = GameMode->CatchCheckSeconds;
+            for (AMonsterAI* Monster : GameMode->SpawnedMonsters)
+            {
+                if (Monster)
+                {
+                    Monster->ResetTickBreakdown();
+                }
+            }
+        }
+        return;
+    }
+
+    // The queue only keeps its last frame, so it is summed here every frame
+    FrameMilliseconds.Add(FrameMs);
+    PathQueueSeconds += GameMode->MazeManager->GetPathQueueStats().LastFrameMicros / 1000000.0;
+
+    if (StepTimer >= SampleSeconds)
+    {
+        FinishStep();
+    }
+}
+
+void AMazeStressTest::StartStep()
+{
+    const FStep& Step = Steps[StepIndex];
+
+    ClearMonsters();
+    SpawnMonsters(Step.Monsters, Step.Mode);
+
+    bSampling = false;
+    StepTimer = 0.0f;
+    RelocateTimer = 0.0f;
+
+    UE_LOG(LogTemp, Log, TEXT("[StressTest] Step %d/%d: %d %s monsters"),
+           StepIndex + 1, Steps.Num(), Step.Monsters, GetModeName(Step.Mode));
+}
+
+void AMazeStressTest::FinishStep()
+{
+    const FStep& Step = Steps[StepIndex];
+
+    FMazeStressRow& Row = Results.AddDefaulted_GetRef();
+    Row.Mode = Step.Mode;
+    Row.Monsters = GameMode->SpawnedMonsters.Num();
+    Row.MazeSize = SessionMazeSize;
+    Row.Hazards = SessionHazards;
+    Row.Frames = FrameMilliseconds.Num();
+
+    FMonsterTickBreakdown Total;
+    for (AMonsterAI* Monster : GameMode->SpawnedMonsters)
+    {
+        if (!Monster) continue;
+
+        const FMonsterTickBreakdown& Breakdown = Monster->GetTickBreakdown();
+        Total.Ticks += Breakdown.Ticks;
+        Total.AISeconds += Breakdown.AISeconds;
+        Total.PathfindingSeconds += Breakdown.PathfindingSeconds;
+        Total.MovementSeconds += Breakdown.MovementSeconds;
+        Total.AudioSeconds += Breakdown.AudioSeconds;
+    }
+
+    const double DirectorSeconds = Step.Mode == EMazeStressAIMode::Director && GameMode->MonsterDirector
+        ? GameMode->MonsterDirector->GetTotalStepSeconds() - DirectorStartSeconds : 0.0;
+
+    if (Row.Frames > 0)
+    {
+        double FrameSum = 0.0;
+        for (float Ms : FrameMilliseconds)
+        {
+            FrameSum += Ms;
+        }
+        FrameMilliseconds.Sort();
+
+        // The director steps, steers and moves its monsters in one pass, all of it counts as AI
+        const double PerFrame = 1000.0 / Row.Frames;
+        Row.MeanFrameMs = static_cast<float>(FrameSum / Row.Frames);
+        Row.P95FrameMs = Percentile(FrameMilliseconds, 0.95f);
+        Row.AIMs = static_cast<float>((Total.AISeconds + DirectorSeconds) * PerFrame);
+        Row.PathfindingMs = static_cast<float>((Total.PathfindingSeconds + PathQueueSeconds) * PerFrame);
+        Row.MovementMs = static_cast<float>(Total.MovementSeconds * PerFrame);
+        Row.AudioMs = static_cast<float>(Total.AudioSeconds * PerFrame);
+        Row.OverlapMs = static_cast<float>((GameMode->CatchCheckSeconds - CatchCheckStartSeconds) * PerFrame);
+
+        const float Measured = Row.AIMs + Row.PathfindingMs + Row.MovementMs + Row.AudioMs + Row.OverlapMs;
+        Row.OtherMs = FMath::Max(Row.MeanFrameMs - Measured, 0.0f);
+        Row.MicrosPerMonster = Row.Monsters > 0 ? Measured * 1000.0f / Row.Monsters : 0.0f;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("[StressTest] %-8s %3d monsters  frame %6.2f ms (p95 %6.2f)  ai %5.2f  path %5.2f  move %5.2f  audio %5.2f  overlap %5.2f  other %6.2f  %.1f us/monster"),
+           GetModeName(Row.Mode), Row.Monsters, Row.MeanFrameMs, Row.P95FrameMs, Row.AIMs, Row.PathfindingMs,
+           Row.MovementMs, Row.AudioMs, Row.OverlapMs, Row.OtherMs, Row.MicrosPerMonster);
+
+    StepIndex++;
+    if (StepIndex < Steps.Num())
+    {
+        StartStep();
+    }
+    else
+    {
+        FinishSession();
+    }
+}
+
+void AMazeStressTest::FinishSession()
+{
+    bRunning = false;
+    ClearMonsters();
+    WriteCsv(Results, GetDefaultCsvPath());
+
+    // Where each mode first misses the frame budget
+    for (EMazeStressAIMode Mode : { EMazeStressAIMode::Modern, EMazeStressAIMode::Legacy, EMazeStressAIMode::Director })
+    {
+        const FMazeStressRow* Breaking = Results.FindByPredicate([this, Mode](const FMazeStressRow& Row)
+        {
+            return Row.Mode == Mode && Row.P95FrameMs > FrameBudgetMs;
+        });
+
+        const FString Line = Breaking
+            ? FString::Printf(TEXT("[StressTest] %s: over %.1f ms at %d monsters (p95 %.1f ms)"),
+                              GetModeName(Mode), FrameBudgetMs, Breaking->Monsters, Breaking->P95FrameMs)
+            : FString::Printf(TEXT("[StressTest] %s: within %.1f ms up to the last step"), GetModeName(Mode), FrameBudgetMs);
+        UE_LOG(LogTemp, Warning, TEXT("%s"), *Line);
+        if (GEngine)
+        {
+            GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Line);
+        }
+    }
+
+    if (bExitWhenDone)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[StressTest] Done, quitting"));
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+void AMazeStressTest::SpawnMonsters(int32 Count, EMazeStressAIMode Mode)
+{
+    AMonsterDirector* Director = Mode == EMazeStressAIMode::Director ? GameMode->EnsureMonsterDirector() : nullptr;
+    AMazeManager* MazeManager = GameMode->MazeManager;
+
+    for (int32 i = 0; i < Count; i++)
+    {
+        AMazeCell* Cell = PickCellAwayFromPlayer(MinSpawnCells);
+        if (!Cell) break;
+
+        // Small offset so monsters sharing a cell start apart
+        FVector Location = Cell->GetActorLocation();
+        Location.X += FMath::FRandRange(-50.0f, 50.0f);
+        Location.Y += FMath::FRandRange(-50.0f, 50.0f);
+        Location.Z = 100.0f;
+        const FTransform SpawnTransform(FRotator::ZeroRotator, Location);
+
+        AMonsterAI* Monster = GetWorld()->SpawnActorDeferred<AMonsterAI>(
+            GameMode->MonsterClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+        if (!Monster) continue;
+
+        Monster->SetMazeManager(MazeManager);
+        Monster->bUseModernAI = Mode != EMazeStressAIMode::Legacy;
+        Monster->FinishSpawning(SpawnTransform);
+
+        if (Director)
+        {
+            Director->AddMonster(Monster);
+        }
+        Monster->StartChasing(GameMode->Player);
+        GameMode->TrackMonster(Monster);
+    }
+}
+
+void AMazeStressTest::ClearMonsters()
+{
+    if (GameMode->MonsterDirector)
+    {
+        GameMode->MonsterDirector->RemoveAllMonsters();
+    }
+
+    for (AMonsterAI* Monster : GameMode->SpawnedMonsters)
+    {
+        if (Monster)
+        {
+            Monster->Destroy();
+        }
+    }
+    GameMode->SpawnedMonsters.Empty();
+}
+
+void AMazeStressTest::RelocatePlayer()
+{
+    AActor* Player = GameMode->Player;
+    AMazeCell* Cell = PickCellAwayFromPlayer(MinSpawnCells);
+    if (!Player || !Cell)
+    {
+        return;
+    }
+
+    FVector Location = Cell->GetActorLocation();
+    Location.Z = Player->GetActorLocation().Z;
+    Player->SetActorLocation(Location, false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+AMazeCell* AMazeStressTest::PickCellAwayFromPlayer(int32 MinCells)
+{
+    AMazeManager* MazeManager = GameMode->MazeManager;
+    if (!GameMode->Player || !MazeManager->bIsMazeGenerated)
+    {
+        return nullptr;
+    }
+
+    MazeManager->ComputeDistanceField(MazeManager->GetCellAtLocation(GameMode->Player->GetActorLocation()), Distances);
+
+    // First cell far enough, counting from a random one
+    const int32 NumCells = Distances.Num();
+    if (NumCells == 0)
+    {
+        return nullptr;
+    }
+    const int32 Offset = FMath::RandRange(0, NumCells - 1);
+    for (int32 i = 0; i < NumCells; i++)
+    {
+        const int32 Index = (Offset + i) % NumCells;
+        if (Distances[Index] < MinCells) continue;
+
+        // Never the exit: standing on it would end the level
+        AMazeCell* Cell = MazeManager->GetCellByIndex(Index);
+        if (Cell && !Cell->bIsEscapeCell)
+        {
+            return Cell;
+        }
+    }
+    return nullptr;
+}
+
+const TCHAR* AMazeStressTest::GetModeName(EMazeStressAIMode Mode)
+{
+    switch (Mode)
+    {
+    case EMazeStressAIMode::Modern:   return TEXT("modern");
+    case EMazeStressAIMode::Legacy:   return TEXT("legacy");
+    case EMazeStressAIMode::Director: return TEXT("director");
+    }
+    return TEXT("unknown");
+}
+
+FString AMazeStressTest::ToCsv(const TArray<FMazeStressRow>& Rows)
+{
+    FString Csv = TEXT("mode,monsters,maze_size,hazards,frames,mean_frame_ms,p95_frame_ms,ai_ms,pathfinding_ms,movement_ms,audio_ms,overlap_ms,other_ms,us_per_monster\n");
+    for (const FMazeStressRow& Row : Rows)
+    {
+        Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f\n"),
+                               GetModeName(Row.Mode), Row.Monsters, Row.MazeSize, Row.Hazards, Row.Frames,
+                               Row.MeanFrameMs, Row.P95FrameMs, Row.AIMs, Row.PathfindingMs, Row.MovementMs,
+                               Row.AudioMs, Row.OverlapMs, Row.OtherMs, Row.MicrosPerMonster);
+    }
+    return Csv;
+}
+
+FString AMazeStressTest::GetDefaultCsvPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("StressTest-%s.csv"), *FDateTime::Now().ToString());
+}
+
+bool AMazeStressTest::WriteCsv(const TArray<FMazeStressRow>& Rows, const FString& Path)
+{
+    if (!FFileHelper::SaveStringToFile(ToCsv(Rows), *Path))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[StressTest] Could not write %s"), *Path);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[StressTest] Wrote %d rows to %s"), Rows.Num(), *Path);
+    return true;
+}
@@ -0,0 +1,141 @@
+// MazeWallAvoidance.cpp
+#include "MazeWallAvoidance.h"
+#include "MazeGrid.h"
+
+namespace
+{
+    // Calls Visit(A, B) for every wall within half a cell of cell (Row, Col) in cell units: its own
+    // four edges plus the side edges of the four neighbors, which leave its corners
+    template <typename TVisitor>
+    void ForEachNearbyWall(const FMazeGrid& Grid, int32 Row, int32 Col, TVisitor&& Visit)
+    {
+        // Edge Dir (North, East, South, West) of cell (R, C): fixed coordinate and span on the other axis
+        auto VisitEdge = [&Visit](int32 R, int32 C, int32 Dir)
+        {
+            const double Top = R - 0.5;
+            const double Left = C - 0.5;
+            switch (Dir)
+            {
+            case 0:  Visit(FVector2D(Top, Left), FVector2D(Top, Left + 1.0));             break;
+            case 1:  Visit(FVector2D(Top, Left + 1.0), FVector2D(Top + 1.0, Left + 1.0)); break;
+            case 2:  Visit(FVector2D(Top + 1.0, Left), FVector2D(Top + 1.0, Left + 1.0)); break;
+            default: Visit(FVector2D(Top, Left), FVector2D(Top + 1.0, Left));             break;
+            }
+        };
+
+        const uint8 Walls = Grid.WallMasks[Grid.ToIndex(Row, Col)];
+        for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+        {
+            if (Walls & (1 << Dir))
+            {
+                VisitEdge(Row, Col, Dir);
+            }
+        }
+
+        for (int32 Dir = 0; Dir < FMazeGrid::NumDirections; Dir++)
+        {
+            const int32 NeighborRow = FMazeGrid::GetNeighborRow(Row, Dir);
+            const int32 NeighborCol = FMazeGrid::GetNeighborCol(Row, Col, Dir);
+            if (!Grid.IsValid(NeighborRow, NeighborCol))
+            {
+                continue;
+            }
+
+            const uint8 NeighborWalls = Grid.WallMasks[Grid.ToIndex(NeighborRow, NeighborCol)];
+            const int32 SideA = (Dir + 1) % FMazeGrid::NumDirections;
+            const int32 SideB = (Dir + 3) % FMazeGrid::NumDirections;
+            if (NeighborWalls & (1 << SideA))
+            {
+                VisitEdge(NeighborRow, NeighborCol, SideA);
+            }
+            if (NeighborWalls & (1 << SideB))
+            {
+                VisitEdge(NeighborRow, NeighborCol, SideB);
+            }
+        }
+    }
+
+    // Closest point of the axis-aligned edge A..B to Point
+    FVector2D ClosestPointOnEdge(const FVector2D& Point, const FVector2D& A, const FVector2D& B)
+    {
+        return FVector2D(FMath::Clamp(Point.X, A.X, B.X), FMath::Clamp(Point.Y, A.Y, B.Y));
+    }
+
+    bool GetCell(const FMazeGrid& Grid, const FVector2D& Point, int32& OutRow, int32& OutCol)
+    {
+        OutRow = FMath::RoundToInt(Point.X);
+        OutCol = FMath::RoundToInt(Point.Y);
+        return Grid.IsValid(OutRow, OutCol);
+    }
+}
+
+FVector2D FMazeWallAvoidance::ComputeRepulsion(const FMazeGrid& Grid, float CellSize, const FVector2D& Location,
+                                               float Radius, const FVector2D& Heading)
+{
+    if (CellSize <= 0.0f || Radius <= 0.0f)
+    {
+        return FVector2D::ZeroVector;
+    }
+
+    const FVector2D Point = Location / CellSize;
+    int32 Row;
+    int32 Col;
+    if (!GetCell(Grid, Point, Row, Col))
+    {
+        return FVector2D::ZeroVector;
+    }
+
+    const double Reach = FMath::Min(Radius / CellSize, 0.5f);
+    const double ReachSquared = Reach * Reach;
+    FVector2D Push = FVector2D::ZeroVector;
+
+    ForEachNearbyWall(Grid, Row, Col, [&](const FVector2D& A, const FVector2D& B)
+    {
+        const FVector2D Away = Point - ClosestPointOnEdge(Point, A, B);
+        const double DistanceSquared = Away.SizeSquared();
+        if (DistanceSquared >= ReachSquared || DistanceSquared <= UE_SMALL_NUMBER)
+        {
+            return;
+        }
+
+        // Already moving away from this wall
+        if (FVector2D::DotProduct(Heading, Away) > 0.0)
+        {
+            return;
+        }
+
+        const double Distance = FMath::Sqrt(DistanceSquared);
+        Push += Away * ((1.0 - Distance / Reach) / Distance);
+    });
+
+    return Push.GetSafeNormal();
+}
+
+void FMazeWallAvoidance::ClampToCell(const FMazeGrid& Grid, float CellSize, int32 Row, int32 Col, float Reach,
+                                     FVector2D& InOutLocation, FVector2D& InOutVelocity)
+{
+    const uint8 Walls = Grid.WallMasks[Grid.ToIndex(Row, Col)];
+    const double CenterX = Row * CellSize;
+    const double CenterY = Col * CellSize;
+
+    if ((Walls & (1 << 0)) && InOutLocation.X < CenterX - Reach)
+    {
+        InOutLocation.X = CenterX - Reach;
+        InOutVelocity.X = FMath::Max(InOutVelocity.X, 0.0);
+    }
+    if ((Walls & (1 << 2)) && InOutLocation.X > CenterX + Reach)
+    {
+        InOutLocation.X = CenterX + Reach;
+        InOutVelocity.X = FMath::Min(InOutVelocity.X, 0.0);
+    }
+    if ((Walls & (1 << 3)) && InOutLocation.Y < CenterY - Reach)
+    {
+        InOutLocation.Y = CenterY - Reach;
+        InOutVelocity.Y = FMath::Max(InOutVelocity.Y, 0.0);
+    }
+    if ((Walls & (1 << 1)) && InOutLocation.Y > CenterY + Reach)
+    {
+        InOutLocation.Y = CenterY + Reach;
+        InOutVelocity.Y = FMath::Min(InOutVelocity.Y, 0.0);
+    }
+}
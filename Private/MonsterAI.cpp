@@ -4,30 +4,59 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#if MAZE_WITH_ANIMATION_BUDGET
+#include "SkeletalMeshComponentBudgeted.h"
+#endif
 #include "AIController.h"
-#include "MazeManager.h"
+#include "Navigation/PathFollowingComponent.h"
 #include "MazeCell.h"
+#include "MazeWallAvoidance.h"
+#include "MazeGridMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Components/PointLightComponent.h"
 #include "Sound/SoundWave.h"
 
-AMonsterAI::AMonsterAI()
+AMonsterAI::AMonsterAI(const FObjectInitializer& ObjectInitializer)
+#if MAZE_WITH_ANIMATION_BUDGET
+    // Budgeted mesh: its animation updates are scheduled by the world's animation budget allocator
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
+#else
+    : Super(ObjectInitializer)
+#endif
 {
     PrimaryActorTick.bCanEverTick = true;
     
     TargetPlayer = nullptr;
     CurrentWaypointIndex = 0;
+    KinematicFirstCell = 0;
     PathUpdateTimer = 0.0f;
     MazeManager = nullptr;
     bIsChasing = false;
+    bDirectorControlled = false;
+    LastPlayerCellIndex = INDEX_NONE;
+    LastMonsterCellIndex = INDEX_NONE;
+    LastPathWallVersion = -1;
+    LastPathTerrainVersion = MAX_uint32;
+    CooperativePlanStep = INDEX_NONE;
+    bPlayerSensed = false;
+    LastKnownPlayerCellIndex = INDEX_NONE;
+    SearchCellIndex = INDEX_NONE;
+    TimeSincePlayerSensed = 0.0f;
+    VisibleCellsSource = INDEX_NONE;
+    VisibleCellsWallVersion = 0;
+    CurrentLOD = EMonsterAILOD::Full;
     
     // Modern AI initialization
     SteeringUpdateTimer = 0.0f;
-    LastPlayerPosition = FVector::ZeroVector;
     PlayerVelocity = FVector::ZeroVector;
     
+    bOnSimulationClock = false;
+    SimulationClockTime = 0.0f;
+    SimulationRandom = nullptr;
+    PendingMoveInput = FVector::ZeroVector;
+    
     MoveSpeed = 300.0f;  // Reverted to original speed
     PathUpdateInterval = 1.0f;  // Reduced update frequency for better performance
     
@@ -47,6 +76,18 @@ AMonsterAI::AMonsterAI()
         MonsterMesh->SetRelativeRotation(FRotator(0.0f, -90.0f, 0.0f));  // Face forward
         MonsterMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
         
+        // Small on screen = fewer animation updates, interpolated in between. The budget allocator
+        // drives this when it is enabled, otherwise the engine's screen size rates apply.
+        MonsterMesh->bEnableUpdateRateOptimizations = true;
+#if MAZE_WITH_ANIMATION_BUDGET
+        if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(MonsterMesh))
+        {
+            // Significance from distance to the view, hidden monsters fall to the bottom of the queue
+            BudgetedMesh->SetAutoRegisterWithBudgetAllocator(true);
+            BudgetedMesh->SetAutoCalculateSignificance(true);
+        }
+#endif
+        
         // Load the Mixamo monster mesh
         static ConstructorHelpers::FObjectFinder<USkeletalMesh> MonsterMeshAsset(TEXT("/Game/Characters/Monster/Ch25_nonPBR"));
         if (MonsterMeshAsset.Succeeded())
@@ -79,24 +120,37 @@ AMonsterAI::AMonsterAI()
         GetCharacterMovement()->bOrientRotationToMovement = true; // Face movement direction
         GetCharacterMovement()->RotationRate = FRotator(0.0f, 540.0f, 0.0f); // Fast turning
     }
+    
+    // Lightweight alternative to the character movement, switched on in BeginPlay
+    GridMovement = CreateDefaultSubobject<UMazeGridMovementComponent>(TEXT("GridMovement"));
+    GridMovement->bAutoActivate = false;
 }
 
 void AMonsterAI::BeginPlay()
 {
     Super::BeginPlay();
     
-    // Find the maze manager
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeManager::StaticClass(), FoundActors);
-    
-    if (FoundActors.Num() > 0)
+    // Find the maze manager (unless the spawner handed it over)
+    if (!MazeManager)
     {
-        MazeManager = Cast<AMazeManager>(FoundActors[0]);
-        UE_LOG(LogTemp, Warning, TEXT("Monster found MazeManager"));
+        TArray<AActor*> FoundActors;
+        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeManager::StaticClass(), FoundActors);
+        
+        if (FoundActors.Num() > 0)
+        {
+            MazeManager = Cast<AMazeManager>(FoundActors[0]);
+            UE_LOG(LogTemp, Warning, TEXT("Monster found MazeManager"));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("Monster could not find MazeManager!"));
+        }
     }
-    else
+    
+    GridMovement->SetMazeManager(MazeManager);
+    if (UsesKinematicMovement())
     {
-        UE_LOG(LogTemp, Error, TEXT("Monster could not find MazeManager!"));
+        SetKinematicMovementActive(true);
     }
     
     // Add a bright RED POINT LIGHT to the monster (works with or without Bloom!)
@@ -151,6 +205,18 @@ void AMonsterAI::BeginPlay()
     // Growl sound removed - was causing it to play during maze regeneration
 }
 
+void AMonsterAI::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // The manager may be torn down first when the level goes away
+    if (IsValid(MazeManager))
+    {
+        MazeManager->CancelPathRequest(this);
+        MazeManager->UnregisterCooperativeAgent(this);
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 void AMonsterAI::Initialize()
 {
     // Find the player
@@ -169,13 +235,33 @@ void AMonsterAI::Initialize()
         MazeManager = Cast<AMazeManager>(FoundActors[0]);
         UE_LOG(LogTemp, Warning, TEXT("[MonsterAI] MazeManager found during manual initialization"));
     }
+    GridMovement->SetMazeManager(MazeManager);
     
     // Reset pathfinding state
     CurrentPath.Empty();
+    GridMovement->ClearWaypoints();
+    PathCorners.Reset();
     CurrentWaypointIndex = 0;
     PathUpdateTimer = 0.0f;
+    LastPlayerCellIndex = INDEX_NONE;
+    LastMonsterCellIndex = INDEX_NONE;
+    LastPathWallVersion = -1;
+    LastPathTerrainVersion = MAX_uint32;
+    CooperativePlanStep = INDEX_NONE;
+    ResetPerception();
     bIsChasing = true;  // Enable chasing immediately after respawn
     
+    if (MazeManager && bCooperativePathing)
+    {
+        MazeManager->RegisterCooperativeAgent(this);
+    }
+    
+    // Respawned on screen or not, the next tick picks the tier again
+    if (CurrentLOD != EMonsterAILOD::Full)
+    {
+        SetAILOD(EMonsterAILOD::Full);
+    }
+    
     UE_LOG(LogTemp, Warning, TEXT("[MonsterAI] Manual initialization complete - chasing enabled"));
 }
 
@@ -183,6 +269,134 @@ void AMonsterAI::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
     
+    if (!bOnSimulationClock)
+    {
+        SimulateStep(DeltaTime);
+    }
+    
+    // The character movement integrates every frame, on the steering of the last AI step
+    if (!PendingMoveInput.IsNearlyZero())
+    {
+        AddMovementInput(PendingMoveInput, 1.0f);
+    }
+}
+
+void AMonsterAI::SetSimulationClockOwner(AActor* ClockOwner, const FRandomStream* Random)
+{
+    bOnSimulationClock = ClockOwner != nullptr;
+    SimulationClockTime = 0.0f;
+    SimulationRandom = ClockOwner ? Random : nullptr;
+    
+    // This frame's steps run before the input they leave behind is applied
+    if (ClockOwner)
+    {
+        AddTickPrerequisiteActor(ClockOwner);
+    }
+}
+
+void AMonsterAI::AdvanceSimulationClock(float StepSeconds)
+{
+    // The tier's tick interval in whole steps, the way the actor tick interval spaces free-running monsters
+    SimulationClockTime += StepSeconds;
+    if (SimulationClockTime < GetActorTickInterval())
+    {
+        return;
+    }
+    
+    const float StepTime = SimulationClockTime;
+    SimulationClockTime = 0.0f;
+    SimulateStep(StepTime);
+}
+
+void AMonsterAI::SimulateStep(float DeltaTime)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    PendingMoveInput = FVector::ZeroVector;
+    
+    // Cycles spent in each subsystem this tick, whatever is left over is the AI itself
+    uint64 PathCycles = 0;
+    uint64 MoveCycles = 0;
+    uint64 AudioCycles = 0;
+    uint64 SectionStart = 0;
+    
+    UpdateAILOD();
+    
+    // Dormant monsters are out of earshot, their volume was set once on the way in
+    if (CurrentLOD != EMonsterAILOD::Dormant)
+    {
+        SectionStart = FPlatformTime::Cycles64();
+        UpdateFootstepVolume();
+        AudioCycles += FPlatformTime::Cycles64() - SectionStart;
+    }
+    
+    if (bIsChasing && TargetPlayer && MazeManager && bUseNavigationMoveTo)
+    {
+        // Path following component drives the character, the grid navigation data does the search
+        SectionStart = FPlatformTime::Cycles64();
+        UpdateNavigationMove();
+        PathCycles += FPlatformTime::Cycles64() - SectionStart;
+    }
+    else if (bIsChasing && TargetPlayer && MazeManager)
+    {
+        // Picks the goal the path below is planned to: the player, where it was last sensed, or a search cell
+        UpdatePerception(DeltaTime);
+        
+        if (bEventDrivenReplanning)
+        {
+            // Cheap per-frame check, the search itself only runs when something it depends on changed
+            if (MazeManager->bIsMazeGenerated && NeedsReplan())
+            {
+                SectionStart = FPlatformTime::Cycles64();
+                UpdatePathToPlayer();
+                PathCycles += FPlatformTime::Cycles64() - SectionStart;
+            }
+        }
+        else
+        {
+            // Update path periodically
+            PathUpdateTimer += DeltaTime;
+            if (PathUpdateTimer >= PathUpdateInterval)
+            {
+                PathUpdateTimer = 0.0f;
+                SectionStart = FPlatformTime::Cycles64();
+                UpdatePathToPlayer();
+                PathCycles += FPlatformTime::Cycles64() - SectionStart;
+            }
+        }
+        
+        // Move along the path
+        SectionStart = FPlatformTime::Cycles64();
+        if (UsesKinematicMovement())
+        {
+            // Grid movement walks it in every tier, only the bookkeeping happens here
+            UpdateKinematicProgress();
+        }
+        else if (CurrentLOD == EMonsterAILOD::Full)
+        {
+            MoveAlongPath(DeltaTime);
+        }
+        else
+        {
+            MoveAlongPathCoarse(DeltaTime);
+        }
+        MoveCycles += FPlatformTime::Cycles64() - SectionStart;
+    }
+    
+    const uint64 TickCycles = FPlatformTime::Cycles64() - StartCycles;
+    const int32 Tier = static_cast<int32>(CurrentLOD);
+    LODStats.Ticks[Tier]++;
+    LODStats.TickSeconds[Tier] += FPlatformTime::ToSeconds64(TickCycles);
+    LODStats.TierSeconds[Tier] += DeltaTime;
+    
+    TickBreakdown.Ticks++;
+    TickBreakdown.PathfindingSeconds += FPlatformTime::ToSeconds64(PathCycles);
+    TickBreakdown.MovementSeconds += FPlatformTime::ToSeconds64(MoveCycles);
+    TickBreakdown.AudioSeconds += FPlatformTime::ToSeconds64(AudioCycles);
+    TickBreakdown.AISeconds += FPlatformTime::ToSeconds64(TickCycles - PathCycles - MoveCycles - AudioCycles);
+}
+
+void AMonsterAI::UpdateFootstepVolume()
+{
     // Update footstep volume based on distance to player
     if (FootstepAudioComponent && TargetPlayer)
     {
@@ -203,19 +417,216 @@ void AMonsterAI::Tick(float DeltaTime)
         
         FootstepAudioComponent->SetVolumeMultiplier(VolumeMultiplier);
     }
+}
+
+void AMonsterAI::ResetPerception()
+{
+    // A fresh chase starts with a fix on the player (the next perception update takes it)
+    bPlayerSensed = false;
+    LastKnownPlayerCellIndex = INDEX_NONE;
+    SearchCellIndex = INDEX_NONE;
+    TimeSincePlayerSensed = 0.0f;
+}
+
+void AMonsterAI::UpdatePerception(float DeltaTime)
+{
+    AMazeCell* PlayerCell = GetPlayerCell();
+    AMazeCell* MonsterCell = GetCurrentCell();
+    if (!PlayerCell || !MonsterCell) return;
+    
+    const int32 PlayerIndex = MazeManager->GetCellIndex(PlayerCell);
+    const int32 MonsterIndex = MazeManager->GetCellIndex(MonsterCell);
+    
+    // One flag lookup: the manager rebuilds the shared sight and hearing plane only when the player changes cell
+    bPlayerSensed = !bUsePerception || MazeManager->GetPlayerPerception(PlayerCell).CanSense(MonsterIndex);
+    const bool bShareBelief = bUsePerception && bUseBeliefMap;
+    if (bPlayerSensed || LastKnownPlayerCellIndex == INDEX_NONE)
+    {
+        LastKnownPlayerCellIndex = PlayerIndex;
+        SearchCellIndex = INDEX_NONE;
+        TimeSincePlayerSensed = 0.0f;
+        if (bShareBelief)
+        {
+            MazeManager->ReportPlayerSensed(PlayerCell);
+        }
+        return;
+    }
+    
+    if (bShareBelief)
+    {
+        ReportVisibleCells(MonsterIndex);
+    }
     
-    if (bIsChasing && TargetPlayer && MazeManager)
+    TimeSincePlayerSensed += DeltaTime;
+    if (TimeSincePlayerSensed >= LoseTrackTime)
+    {
+        LastKnownPlayerCellIndex = PlayerIndex;
+        SearchCellIndex = INDEX_NONE;
+        TimeSincePlayerSensed = 0.0f;
+        if (bShareBelief)
+        {
+            MazeManager->ReportPlayerSensed(PlayerCell);
+        }
+        UE_LOG(LogTemp, Log, TEXT("[MonsterAI] Picked up the player's trail again"));
+    }
+    else if (bShareBelief)
     {
-        // Update path periodically
-        PathUpdateTimer += DeltaTime;
-        if (PathUpdateTimer >= PathUpdateInterval)
+        // Head for the most likely cell, pick again once there or once someone looked and it was empty
+        if (SearchCellIndex == INDEX_NONE || MonsterIndex == SearchCellIndex || MazeManager->GetPlayerBelief(SearchCellIndex) <= 0.0f)
         {
-            PathUpdateTimer = 0.0f;
-            UpdatePathToPlayer();
+            const int32 MostLikely = MazeManager->GetMostLikelyPlayerCellIndex();
+            SearchCellIndex = MostLikely != INDEX_NONE && MostLikely != MonsterIndex ? MostLikely : PickSearchCell(MonsterIndex);
         }
+    }
+    else if (MonsterIndex == (SearchCellIndex != INDEX_NONE ? SearchCellIndex : LastKnownPlayerCellIndex))
+    {
+        // Nobody where the player was: look around the corridors it could have taken from there
+        SearchCellIndex = PickSearchCell(LastKnownPlayerCellIndex);
+    }
+}
+
+void AMonsterAI::ReportVisibleCells(int32 MonsterIndex)
+{
+    // The sight cone only changes with the cell or the walls, the rays are not recast every tick
+    const FMazeGrid& Grid = MazeManager->NavGrid;
+    if (MonsterIndex != VisibleCellsSource || Grid.WallVersion != VisibleCellsWallVersion)
+    {
+        FMazePerception::GatherVisibleCells(Grid, MonsterIndex, MazeManager->SightRangeCells, VisibleCells);
+        VisibleCellsSource = MonsterIndex;
+        VisibleCellsWallVersion = Grid.WallVersion;
+    }
+    MazeManager->ReportCellsSeen(VisibleCells);
+}
+
+int32 AMonsterAI::PickSearchCell(int32 AroundIndex) const
+{
+    // Random walk through the open passages without turning back, stops early in a dead end
+    const FMazeGrid& Grid = MazeManager->NavGrid;
+    if (AroundIndex < 0 || AroundIndex >= Grid.Num()) return INDEX_NONE;
+    
+    int32 Cell = AroundIndex;
+    int32 Previous = INDEX_NONE;
+    for (int32 Step = 0; Step < SearchRadiusCells; Step++)
+    {
+        int32 Options[FMazeGrid::NumDirections];
+        int32 NumOptions = 0;
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+        {
+            if (Neighbor.Index != Previous)
+            {
+                Options[NumOptions++] = Neighbor.Index;
+            }
+        }
+        if (NumOptions == 0) break;
         
-        // Move along the path
-        MoveAlongPath(DeltaTime);
+        Previous = Cell;
+        Cell = Options[SimulationRandom ? SimulationRandom->RandRange(0, NumOptions - 1) : FMath::RandRange(0, NumOptions - 1)];
+    }
+    return Cell;
+}
+
+AMazeCell* AMonsterAI::GetChaseGoalCell() const
+{
+    if (bPlayerSensed || !MazeManager)
+    {
+        return GetPlayerCell();
+    }
+    
+    // One table lookup, rebuilt by the manager only when the walls change
+    if (bAmbushPlayer)
+    {
+        if (AMazeCell* AmbushCell = MazeManager->GetAmbushCell(GetPlayerCell()))
+        {
+            return AmbushCell;
+        }
+    }
+    
+    const int32 GoalIndex = SearchCellIndex != INDEX_NONE ? SearchCellIndex : LastKnownPlayerCellIndex;
+    AMazeCell* GoalCell = GoalIndex != INDEX_NONE ? MazeManager->GetCellByIndex(GoalIndex) : nullptr;
+    return GoalCell ? GoalCell : GetPlayerCell();
+}
+
+void AMonsterAI::UpdateAILOD()
+{
+    EMonsterAILOD NewLOD = EMonsterAILOD::Full;
+    
+    if (bUseAILOD && bIsChasing && !bUseNavigationMoveTo && MazeManager && MazeManager->bIsMazeGenerated &&
+        !WasRecentlyRendered(VisibilityGraceTime))
+    {
+        // One shared field per player cell, so this is a lookup for every monster
+        const TArray<int32>& Distances = MazeManager->GetPlayerDistanceField(GetPlayerCell());
+        const int32 MonsterIndex = MazeManager->GetCellIndex(GetCurrentCell());
+        
+        // Either end outside the maze: keep full detail rather than guess
+        if (Distances.IsValidIndex(MonsterIndex))
+        {
+            const int32 Distance = Distances[MonsterIndex];
+            
+            // Dropping to less detail takes LODHysteresisCells more than climbing back
+            const int32 FullLimit = FullDetailDistance + (CurrentLOD == EMonsterAILOD::Full ? LODHysteresisCells : 0);
+            const int32 ReducedLimit = ReducedDetailDistance + (CurrentLOD != EMonsterAILOD::Dormant ? LODHysteresisCells : 0);
+            
+            if (Distance < 0)
+            {
+                // Walled off from the player, nothing to chase until the walls change
+                NewLOD = EMonsterAILOD::Dormant;
+            }
+            else if (Distance > ReducedLimit)
+            {
+                NewLOD = EMonsterAILOD::Dormant;
+            }
+            else if (Distance > FullLimit)
+            {
+                NewLOD = EMonsterAILOD::Reduced;
+            }
+        }
+    }
+    
+    if (NewLOD != CurrentLOD)
+    {
+        SetAILOD(NewLOD);
+    }
+}
+
+void AMonsterAI::SetAILOD(EMonsterAILOD NewLOD)
+{
+    const EMonsterAILOD OldLOD = CurrentLOD;
+    CurrentLOD = NewLOD;
+    
+    float TickInterval = 0.0f;
+    switch (NewLOD)
+    {
+    case EMonsterAILOD::Full:    TickInterval = 0.0f; break;
+    case EMonsterAILOD::Reduced: TickInterval = ReducedTickInterval; break;
+    case EMonsterAILOD::Dormant: TickInterval = DormantTickInterval; break;
+    }
+    SetActorTickInterval(TickInterval);
+    
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (UsesKinematicMovement())
+    {
+        // Same moves in every tier, just fewer and longer steps far away
+        GridMovement->SetComponentTickInterval(TickInterval);
+    }
+    else if (NewLOD == EMonsterAILOD::Full)
+    {
+        // Steering picks up from wherever the coarse moves left the monster, on the same waypoint
+        if (Movement)
+        {
+            Movement->SetComponentTickEnabled(true);
+        }
+        SteeringUpdateTimer = SteeringUpdateInterval;
+    }
+    else if (OldLOD == EMonsterAILOD::Full && Movement)
+    {
+        // Coarse tiers place the actor directly, the movement component would only fight it
+        Movement->StopMovementImmediately();
+        Movement->SetComponentTickEnabled(false);
+    }
+    
+    if (NewLOD == EMonsterAILOD::Dormant && FootstepAudioComponent)
+    {
+        FootstepAudioComponent->SetVolumeMultiplier(FootstepMinVolume);
     }
 }
 
@@ -229,18 +640,99 @@ void AMonsterAI::StartChasing(AActor* Target)
     
     TargetPlayer = Target;
     bIsChasing = true;
+    ResetPerception();
     
-    // Calculate initial path
-    UpdatePathToPlayer();
+    if (bCooperativePathing)
+    {
+        MazeManager->RegisterCooperativeAgent(this);
+    }
+    
+    // Calculate initial path (a director steers on the shared distance field instead)
+    if (!bDirectorControlled)
+    {
+        UpdatePathToPlayer();
+    }
     
     UE_LOG(LogTemp, Warning, TEXT("Monster started chasing player!"));
 }
 
+void AMonsterAI::SetDirectorControlled(bool bControlled)
+{
+    if (bDirectorControlled == bControlled) return;
+    bDirectorControlled = bControlled;
+    
+    SetActorTickEnabled(!bControlled);
+    
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (Movement)
+    {
+        Movement->StopMovementImmediately();
+        Movement->SetComponentTickEnabled(!bControlled && !UsesKinematicMovement());
+    }
+    GridMovement->ClearWaypoints();
+    GridMovement->SetActive(UsesKinematicMovement());
+    
+    if (bControlled)
+    {
+        // The director owns the movement from here, drop everything the own chase had going
+        CurrentPath.Empty();
+        PathCorners.Reset();
+        CurrentWaypointIndex = 0;
+        PendingMoveInput = FVector::ZeroVector;
+        if (MazeManager)
+        {
+            MazeManager->CancelPathRequest(this);
+            MazeManager->UnregisterCooperativeAgent(this);
+        }
+        if (AAIController* AIController = Cast<AAIController>(GetController()))
+        {
+            AIController->StopMovement();
+        }
+        
+        // A hundred looping footsteps would drown each other out
+        if (FootstepAudioComponent)
+        {
+            FootstepAudioComponent->Stop();
+        }
+    }
+    else
+    {
+        if (CurrentLOD != EMonsterAILOD::Full)
+        {
+            SetAILOD(EMonsterAILOD::Full);
+        }
+        LastPlayerCellIndex = INDEX_NONE;
+        if (FootstepAudioComponent)
+        {
+            FootstepAudioComponent->Play();
+        }
+    }
+}
+
 void AMonsterAI::StopChasing()
 {
     bIsChasing = false;
     CurrentPath.Empty();
+    PathCorners.Reset();
     CurrentWaypointIndex = 0;
+    PendingMoveInput = FVector::ZeroVector;
+    GridMovement->ClearWaypoints();
+    
+    if (MazeManager)
+    {
+        MazeManager->CancelPathRequest(this);
+        MazeManager->UnregisterCooperativeAgent(this);
+    }
+    
+    if (AAIController* AIController = Cast<AAIController>(GetController()))
+    {
+        AIController->StopMovement();
+    }
+    
+    if (CurrentLOD != EMonsterAILOD::Full)
+    {
+        SetAILOD(EMonsterAILOD::Full);
+    }
     
     UE_LOG(LogTemp, Warning, TEXT("Monster stopped chasing"));
 }
@@ -249,9 +741,9 @@ void AMonsterAI::UpdatePathToPlayer()
 {
     if (!MazeManager || !TargetPlayer) return;
     
-    // Get current cells
+    // Get current cells (the "player" cell is wherever the monster believes the player to be)
     AMazeCell* MonsterCell = GetCurrentCell();
-    AMazeCell* PlayerCell = GetPlayerCell();
+    AMazeCell* PlayerCell = GetChaseGoalCell();
     
     if (!MonsterCell || !PlayerCell)
     {
@@ -259,9 +751,75 @@ void AMonsterAI::UpdatePathToPlayer()
         return;
     }
     
-    // Find new path using A* (faster and smoother than BFS)
-    TArray<AMazeCell*> NewPath = MazeManager->FindPathAStar(MonsterCell, PlayerCell);
+    const int32 MonsterIndex = MazeManager->GetCellIndex(MonsterCell);
+    const int32 PlayerIndex = MazeManager->GetCellIndex(PlayerCell);
+    LastPlayerCellIndex = PlayerIndex;
+    LastMonsterCellIndex = MonsterIndex;
+    LastPathWallVersion = MazeManager->GetWallVersion();
+    LastPathTerrainVersion = MazeManager->GetTerrainVersion();
+    
+    TArray<AMazeCell*> NewPath;
+    
+    // A plan that is not cooperative leaves the others' way free
+    if (CooperativePlanStep != INDEX_NONE)
+    {
+        MazeManager->ReleaseCooperativePath(this);
+        CooperativePlanStep = INDEX_NONE;
+    }
+    
+    const FMazeGrid& NavGrid = MazeManager->NavGrid;
+    if (bUseTerrainCosts && MazeManager->HasTerrain(EMazeTerrain::Mud | EMazeTerrain::SafeZone))
+    {
+        // Hazards on the map: D* Lite only knows unit costs, the bucket queue search is cheap enough per replan
+        const FMazeCostProfile Profile = FMazeCostProfile::Make(1, MudPathCost, 1, SafeZonePathCost);
+        NewPath = MazeManager->FindPathWeighted(MonsterCell, PlayerCell, Profile);
+    }
+    else if (bCooperativePathing && MazeManager->GetNumCooperativeAgents() > 1 && PlayerCell == GetPlayerCell())
+    {
+        // Several monsters on the player: a few steps around the others' reservations, then the shared
+        // player distance field. The window bounds the search, however many monsters there are.
+        if (MazeManager->FindCooperativePath(this, MonsterCell, PlayerCell, NewPath))
+        {
+            CooperativePlanStep = MazeManager->GetReservationStep();
+        }
+    }
+    else if (bEventDrivenReplanning && NavGrid.Num() == MazeManager->Rows * MazeManager->Cols)
+    {
+        // Incremental search rooted at the monster with the player as the start: player moves only
+        // shift the keys, monster steps and wall changes repair the previous search in place
+        TArray<int32> CellPath;
+        if (PathPlanner.FindPath(NavGrid, PlayerIndex, MonsterIndex, CellPath))
+        {
+            NewPath.Reserve(CellPath.Num());
+            for (int32 i = CellPath.Num() - 1; i >= 0; i--)
+            {
+                NewPath.Add(MazeManager->GetCellByIndex(CellPath[i]));
+            }
+        }
+    }
+    
+    if (NewPath.Num() > 0)
+    {
+        ApplyPath(NewPath);
+        return;
+    }
     
+    // Everything else goes to the manager: the junction graph answers on small mazes, bigger ones use
+    // the budgeted queue, so a burst of monsters does not search in the same frame (monsters chasing
+    // the same player cell share one search)
+    TWeakObjectPtr<AMonsterAI> WeakThis(this);
+    MazeManager->RequestPath(this, MonsterCell, PlayerCell, EMazePathPriority::Normal,
+        [WeakThis](const TArray<AMazeCell*>& Path)
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->ApplyPath(Path);
+            }
+        });
+}
+
+void AMonsterAI::ApplyPath(const TArray<AMazeCell*>& NewPath)
+{
     if (NewPath.Num() > 0)
     {
         // CRITICAL FIX: Only reset waypoint index if path actually changed!
@@ -281,6 +839,7 @@ void AMonsterAI::UpdatePathToPlayer()
         }
         
         CurrentPath = NewPath;
+        RebuildPathCorners();
         
         // Only reset waypoint index if path significantly changed
         if (bPathChanged)
@@ -296,6 +855,11 @@ void AMonsterAI::UpdatePathToPlayer()
             UE_LOG(LogTemp, Log, TEXT("✅ Monster path updated, continuing from waypoint %d"), CurrentWaypointIndex);
         }
         
+        if (UsesKinematicMovement())
+        {
+            SyncKinematicWaypoints();
+        }
+        
         // Debug: Draw the path (DISABLED)
         /*
         #if WITH_EDITOR
@@ -313,6 +877,73 @@ void AMonsterAI::UpdatePathToPlayer()
     }
 }
 
+bool AMonsterAI::NeedsReplan()
+{
+    AMazeCell* MonsterCell = GetCurrentCell();
+    AMazeCell* PlayerCell = GetChaseGoalCell();
+    if (!MonsterCell || !PlayerCell) return false;
+    
+    if (MazeManager->GetCellIndex(PlayerCell) != LastPlayerCellIndex ||
+        MazeManager->GetWallVersion() != LastPathWallVersion ||
+        MazeManager->GetTerrainVersion() != LastPathTerrainVersion)
+    {
+        return true;
+    }
+    
+    // A cooperative plan only looks a window ahead, renew it halfway through
+    if (CooperativePlanStep != INDEX_NONE &&
+        MazeManager->GetReservationStep() >= CooperativePlanStep + FMath::Max(MazeManager->CooperativeWindowSteps / 2, 1))
+    {
+        return true;
+    }
+    
+    // Moving along the path needs no search - only getting pushed off it does
+    const int32 MonsterIndex = MazeManager->GetCellIndex(MonsterCell);
+    if (MonsterIndex == LastMonsterCellIndex) return false;
+    LastMonsterCellIndex = MonsterIndex;
+    
+    // Anywhere on the straight line towards the next waypoint still counts as on the path
+    const int32 LastOnPath = FMath::Max(CurrentWaypointIndex + 1, GetSteeringWaypointIndex());
+    for (int32 i = CurrentWaypointIndex - 1; i <= LastOnPath; i++)
+    {
+        if (CurrentPath.IsValidIndex(i) && CurrentPath[i] == MonsterCell)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AMonsterAI::RebuildPathCorners()
+{
+    PathCorners.Reset();
+    if (!bSmoothPath || !MazeManager || MazeManager->CellSize <= 0.0f)
+    {
+        return;
+    }
+    
+    PathCellScratch.Reset(CurrentPath.Num());
+    for (const AMazeCell* Cell : CurrentPath)
+    {
+        PathCellScratch.Add(MazeManager->GetCellIndex(Cell));
+    }
+    
+    PathSmoother.SmoothPath(MazeManager->NavGrid, PathCellScratch, PathClearance / MazeManager->CellSize, PathCorners);
+}
+
+int32 AMonsterAI::GetSteeringWaypointIndex() const
+{
+    // First corner not yet reached, the cells before it are on a clear straight line
+    for (const int32 Corner : PathCorners)
+    {
+        if (Corner >= CurrentWaypointIndex)
+        {
+            return Corner;
+        }
+    }
+    return CurrentWaypointIndex;
+}
+
 void AMonsterAI::MoveAlongPath(float DeltaTime)
 {
     if (CurrentPath.Num() == 0 || CurrentWaypointIndex >= CurrentPath.Num())
@@ -320,12 +951,26 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
         return;
     }
     
-    // Update player velocity tracking (for prediction)
+    // Player velocity for prediction, from its movement rather than from how long the step was
     if (TargetPlayer)
     {
-        FVector CurrentPlayerPos = TargetPlayer->GetActorLocation();
-        PlayerVelocity = (CurrentPlayerPos - LastPlayerPosition) / DeltaTime;
-        LastPlayerPosition = CurrentPlayerPos;
+        PlayerVelocity = TargetPlayer->GetVelocity();
+    }
+    
+    // On a smoothed path the cells walked through on the way to the next corner count as reached,
+    // the corner itself only once its center is (the next line starts there)
+    const int32 WaypointIndex = GetSteeringWaypointIndex();
+    if (WaypointIndex > CurrentWaypointIndex)
+    {
+        const AMazeCell* MonsterCell = GetCurrentCell();
+        for (int32 i = CurrentWaypointIndex; i < WaypointIndex; i++)
+        {
+            if (CurrentPath[i] == MonsterCell)
+            {
+                CurrentWaypointIndex = i + 1;
+                break;
+            }
+        }
     }
     
     // MODERN AI: Use steering behaviors WITH A* path (not direct pursuit)
@@ -334,10 +979,10 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
         SteeringUpdateTimer += DeltaTime;
         
         // Get current waypoint from A* path
-        AMazeCell* TargetCell = CurrentPath[CurrentWaypointIndex];
+        AMazeCell* TargetCell = CurrentPath[WaypointIndex];
         if (!TargetCell) 
         {
-            CurrentWaypointIndex++;
+            CurrentWaypointIndex = WaypointIndex + 1;
             return;
         }
         
@@ -349,7 +994,7 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
         float DistanceToWaypoint = FVector::Dist2D(CurrentLocation, WaypointLocation);
         if (DistanceToWaypoint < 100.0f)
         {
-            CurrentWaypointIndex++;
+            CurrentWaypointIndex = WaypointIndex + 1;
             UE_LOG(LogTemp, Log, TEXT("Monster reached waypoint %d"), CurrentWaypointIndex);
         }
         
@@ -362,8 +1007,8 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
             // This respects walls while still being smooth
             FVector SteeringForce = CalculateSteeringForce(WaypointLocation);
             
-            // Add obstacle avoidance
-            FVector AvoidanceForce = AvoidObstacles();
+            // Add obstacle avoidance (smoothed lines already keep PathClearance from the walls)
+            FVector AvoidanceForce = PathCorners.Num() > 0 ? FVector::ZeroVector : AvoidObstacles();
             
             // Blend steering forces (avoidance has priority)
             FVector FinalSteering = SteeringForce + (AvoidanceForce * 1.5f);
@@ -372,7 +1017,7 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
             // Apply movement
             if (!FinalSteering.IsNearlyZero())
             {
-                AddMovementInput(FinalSteering, 1.0f);
+                PendingMoveInput = FinalSteering;
                 
                 // Smooth rotation toward movement direction
                 FRotator NewRotation = FinalSteering.Rotation();
@@ -382,17 +1027,16 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
         else
         {
             // Continue with last steering direction (smooth between updates)
-            FVector CurrentForward = GetActorForwardVector();
-            AddMovementInput(CurrentForward, 1.0f);
+            PendingMoveInput = GetActorForwardVector();
         }
     }
     else
     {
         // LEGACY AI: Original waypoint following (fallback for performance)
-        AMazeCell* TargetCell = CurrentPath[CurrentWaypointIndex];
+        AMazeCell* TargetCell = CurrentPath[WaypointIndex];
         if (!TargetCell) 
         {
-            CurrentWaypointIndex++;
+            CurrentWaypointIndex = WaypointIndex + 1;
             return;
         }
         
@@ -408,13 +1052,13 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
         // Waypoint reached threshold
         if (DistanceToWaypoint < 100.0f)
         {
-            CurrentWaypointIndex++;
+            CurrentWaypointIndex = WaypointIndex + 1;
         }
         
         // Move towards waypoint
         if (DistanceToWaypoint > 10.0f)
         {
-            AddMovementInput(Direction, 1.0f);
+            PendingMoveInput = Direction;
         }
         
         // Face movement direction
@@ -426,6 +1070,139 @@ void AMonsterAI::MoveAlongPath(float DeltaTime)
     }
 }
 
+void AMonsterAI::MoveAlongPathCoarse(float DeltaTime)
+{
+    // Straight from cell center to cell center at walking speed. Only used off screen, so there is
+    // no steering, no avoidance and no character movement: the path cells are connected already.
+    if (CurrentPath.Num() == 0 || CurrentWaypointIndex >= CurrentPath.Num())
+    {
+        return;
+    }
+    
+    const UCharacterMovementComponent* Movement = GetCharacterMovement();
+    float Budget = (Movement ? Movement->MaxWalkSpeed : MoveSpeed) * DeltaTime;
+    
+    FVector Location = GetActorLocation();
+    FVector Heading = FVector::ZeroVector;
+    
+    while (Budget > 0.0f && CurrentWaypointIndex < CurrentPath.Num())
+    {
+        const AMazeCell* TargetCell = CurrentPath[CurrentWaypointIndex];
+        if (!TargetCell)
+        {
+            CurrentWaypointIndex++;
+            continue;
+        }
+        
+        FVector TargetLocation = TargetCell->GetActorLocation();
+        TargetLocation.Z = Location.Z;
+        
+        const FVector ToTarget = TargetLocation - Location;
+        const float Distance = ToTarget.Size2D();
+        if (Distance <= Budget)
+        {
+            Location = TargetLocation;
+            Budget -= Distance;
+            CurrentWaypointIndex++;
+        }
+        else
+        {
+            Location += ToTarget * (Budget / Distance);
+            Budget = 0.0f;
+        }
+        
+        if (Distance > UE_KINDA_SMALL_NUMBER)
+        {
+            Heading = ToTarget;
+        }
+    }
+    
+    SetActorLocation(Location);
+    if (!Heading.IsNearlyZero())
+    {
+        SetActorRotation(FRotator(0.0f, Heading.Rotation().Yaw, 0.0f));
+    }
+}
+
+bool AMonsterAI::UsesKinematicMovement() const
+{
+    // MoveTo drives the character movement through the path following component, and a director
+    // moves the actor itself
+    return bUseKinematicMovement && !bUseNavigationMoveTo && !bDirectorControlled;
+}
+
+void AMonsterAI::SetKinematicMovementActive(bool bActive)
+{
+    if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+    {
+        Movement->StopMovementImmediately();
+        Movement->SetComponentTickEnabled(!bActive);
+    }
+    
+    GridMovement->SetActive(bActive);
+    if (bActive)
+    {
+        SyncKinematicWaypoints();
+    }
+    else
+    {
+        GridMovement->ClearWaypoints();
+    }
+}
+
+void AMonsterAI::SyncKinematicWaypoints()
+{
+    // The rest of the path from CurrentWaypointIndex: the string-pulled corners when there are any,
+    // every cell center otherwise. The last cell is always a waypoint.
+    KinematicWaypoints.Reset();
+    KinematicWaypointCells.Reset();
+    KinematicFirstCell = CurrentWaypointIndex;
+    
+    int32 Corner = 0;
+    for (int32 i = CurrentWaypointIndex; i < CurrentPath.Num(); i++)
+    {
+        while (Corner < PathCorners.Num() && PathCorners[Corner] < i)
+        {
+            Corner++;
+        }
+        
+        const bool bWaypoint = PathCorners.Num() == 0 || i == CurrentPath.Num() - 1 ||
+                               (Corner < PathCorners.Num() && PathCorners[Corner] == i);
+        if (bWaypoint && CurrentPath[i])
+        {
+            KinematicWaypoints.Add(CurrentPath[i]->GetActorLocation());
+            KinematicWaypointCells.Add(i);
+        }
+    }
+    
+    GridMovement->SetWaypoints(KinematicWaypoints);
+}
+
+void AMonsterAI::UpdateKinematicProgress()
+{
+    // Every cell up to the last reached waypoint counts as reached, so NeedsReplan sees the whole
+    // line towards the next waypoint as on the path
+    const int32 Reached = FMath::Min(GridMovement->GetWaypointIndex(), KinematicWaypointCells.Num());
+    CurrentWaypointIndex = Reached > 0 ? KinematicWaypointCells[Reached - 1] + 1 : KinematicFirstCell;
+}
+
+void AMonsterAI::UpdateNavigationMove()
+{
+    AAIController* AIController = Cast<AAIController>(GetController());
+    if (!AIController || !MazeManager->bIsMazeGenerated) return;
+    
+    // A goal actor move follows the player by itself, re-issue only once it stopped
+    // (reached, failed, or its path was invalidated by a wall change and could not be repaired)
+    if (AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
+    {
+        const EPathFollowingRequestResult::Type Result = AIController->MoveToActor(TargetPlayer, MoveToAcceptanceRadius);
+        if (Result == EPathFollowingRequestResult::Failed)
+        {
+            UE_LOG(LogTemp, Log, TEXT("[MonsterAI] MoveTo failed, is the grid navigation data registered?"));
+        }
+    }
+}
+
 AMazeCell* AMonsterAI::GetCurrentCell() const
 {
     if (!MazeManager) return nullptr;
@@ -508,56 +1285,21 @@ FVector AMonsterAI::CalculateSteeringForce(const FVector& TargetPosition)
 
 FVector AMonsterAI::AvoidObstacles()
 {
-    FVector AvoidanceForce = FVector::ZeroVector;
-    FVector MonsterPos = GetActorLocation();
-    FVector Forward = GetActorForwardVector();
-    
-    // Cast 3 rays: forward, left-forward, right-forward
-    TArray<FVector> RayDirections;
-    RayDirections.Add(Forward);
-    RayDirections.Add(Forward.RotateAngleAxis(30.0f, FVector::UpVector));
-    RayDirections.Add(Forward.RotateAngleAxis(-30.0f, FVector::UpVector));
+    // Walls come straight from the packed wall grid: the edges of the monster's cell and the ones
+    // leaving its corners, no scene queries (cost stays flat however many monsters there are)
+    if (!MazeManager || MazeManager->NavGrid.Num() == 0) return FVector::ZeroVector;
     
-    int32 HitCount = 0;
+    const FVector MonsterPos = GetActorLocation();
+    const FVector Forward = GetActorForwardVector();
     
-    for (const FVector& RayDir : RayDirections)
-    {
-        FVector RayStart = MonsterPos;
-        FVector RayEnd = RayStart + (RayDir * AvoidanceRadius);
-        
-        FHitResult HitResult;
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(this);
-        if (TargetPlayer)
-        {
-            QueryParams.AddIgnoredActor(TargetPlayer);
-        }
-        
-        // Check for walls
-        bool bHit = GetWorld()->LineTraceSingleByChannel(
-            HitResult,
-            RayStart,
-            RayEnd,
-            ECC_Visibility,
-            QueryParams
-        );
-        
-        if (bHit)
-        {
-            // Steer away from obstacle
-            FVector AwayFromWall = (MonsterPos - HitResult.ImpactPoint).GetSafeNormal();
-            AvoidanceForce += AwayFromWall;
-            HitCount++;
-        }
-    }
-    
-    // Normalize if we hit multiple obstacles
-    if (HitCount > 0)
-    {
-        AvoidanceForce /= HitCount;
-        AvoidanceForce.Normalize();
-    }
+    // Only walls ahead or beside count, like the forward-facing feelers this replaces
+    const FVector2D Push = FMazeWallAvoidance::ComputeRepulsion(
+        MazeManager->NavGrid,
+        MazeManager->CellSize,
+        FVector2D(MonsterPos.X, MonsterPos.Y),
+        AvoidanceRadius,
+        FVector2D(Forward.X, Forward.Y));
     
-    return AvoidanceForce;
+    return FVector(Push.X, Push.Y, 0.0f);
 }
 
@@ -0,0 +1,341 @@
+// MonsterDirector.cpp
+#include "MonsterDirector.h"
+#include "MonsterAI.h"
+#include "MazeManager.h"
+#include "MazeGrid.h"
+#include "MazeWallAvoidance.h"
+#include "MazeSimulationClock.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+
+AMonsterDirector::AMonsterDirector()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
+
+    MazeManager = nullptr;
+    LastStepMilliseconds = 0.0f;
+    TotalStepSeconds = 0.0;
+    SimulationClock = nullptr;
+}
+
+void AMonsterDirector::SetSimulationClock(const FMazeSimulationClock* InClock, AActor* ClockOwner)
+{
+    SimulationClock = InClock;
+
+    // Drawn after this frame's steps
+    if (ClockOwner)
+    {
+        AddTickPrerequisiteActor(ClockOwner);
+    }
+}
+
+void AMonsterDirector::AddMonster(AMonsterAI* Monster)
+{
+    if (!Monster || Monsters.Contains(Monster))
+    {
+        return;
+    }
+
+    Monster->SetDirectorControlled(true);
+
+    const FVector Location = Monster->GetActorLocation();
+    Monsters.Add(Monster);
+    Positions.Add(FVector2D(Location.X, Location.Y));
+    Velocities.Add(FVector2D::ZeroVector);
+    NextPositions.Add(FVector2D(Location.X, Location.Y));
+    NextVelocities.Add(FVector2D::ZeroVector);
+    PreviousPositions.Add(FVector2D(Location.X, Location.Y));
+    DrawnPositions.Add(FVector2D(Location.X, Location.Y));
+    Heights.Add(Location.Z);
+    Yaws.Add(Monster->GetActorRotation().Yaw);
+    Speeds.Add(Monster->MoveSpeed);
+    Chasing.Add(Monster->IsChasing() ? 1 : 0);
+    Cells.Add(INDEX_NONE);
+    NextInCell.Add(INDEX_NONE);
+}
+
+void AMonsterDirector::RemoveMonster(AMonsterAI* Monster)
+{
+    const int32 Index = Monsters.Find(Monster);
+    if (Index != INDEX_NONE)
+    {
+        if (Monster)
+        {
+            Monster->SetDirectorControlled(false);
+        }
+        RemoveMonsterAt(Index);
+    }
+}
+
+void AMonsterDirector::RemoveAllMonsters()
+{
+    for (int32 Index = Monsters.Num() - 1; Index >= 0; Index--)
+    {
+        RemoveMonster(Monsters[Index]);
+    }
+}
+
+void AMonsterDirector::RemoveMonsterAt(int32 Index)
+{
+    // Swap-remove from every array together so the slots stay aligned
+    Monsters.RemoveAtSwap(Index);
+    Positions.RemoveAtSwap(Index);
+    Velocities.RemoveAtSwap(Index);
+    NextPositions.RemoveAtSwap(Index);
+    NextVelocities.RemoveAtSwap(Index);
+    PreviousPositions.RemoveAtSwap(Index);
+    DrawnPositions.RemoveAtSwap(Index);
+    Heights.RemoveAtSwap(Index);
+    Yaws.RemoveAtSwap(Index);
+    Speeds.RemoveAtSwap(Index);
+    Chasing.RemoveAtSwap(Index);
+    Cells.RemoveAtSwap(Index);
+    NextInCell.RemoveAtSwap(Index);
+}
+
+void AMonsterDirector::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Stepped by the clock's owner already: drawn one step behind the simulation
+    if (!SimulationClock)
+    {
+        SimulateStep(DeltaTime);
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    ApplyTransforms(SimulationClock ? SimulationClock->GetAlpha() : 1.0f);
+    TotalStepSeconds += FPlatformTime::Seconds() - StartTime;
+}
+
+void AMonsterDirector::SimulateStep(float DeltaTime)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    SyncActors();
+    PreviousPositions = Positions;
+
+    ACharacter* Player = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+    if (Monsters.Num() == 0 || !Player || !MazeManager || !MazeManager->bIsMazeGenerated || MazeManager->CellSize <= 0.0f)
+    {
+        return;
+    }
+
+    // The decision for every monster: one shared distance field from the player's cell
+    const FVector PlayerLocation = Player->GetActorLocation();
+    const TArray<int32>& Distances = MazeManager->GetPlayerDistanceField(MazeManager->GetCellAtLocation(PlayerLocation));
+    const FMazeGrid& Grid = MazeManager->NavGrid;
+    const float CellSize = MazeManager->CellSize;
+    if (Distances.Num() != Grid.Num())
+    {
+        return;
+    }
+
+    BuildCellBuckets(Grid, CellSize);
+
+    // A long hitch moves monsters a tenth of a second at most, never one big jump past a wall
+    const float Step = FMath::Min(DeltaTime, 0.1f);
+    const FVector2D PlayerPoint(PlayerLocation.X, PlayerLocation.Y);
+
+    ParallelFor(TEXT("MonsterDirector.Step"), Monsters.Num(), MinBatchSize, [&](int32 Index)
+    {
+        StepMonster(Index, Grid, CellSize, Distances, PlayerPoint, Step);
+    });
+
+    Swap(Positions, NextPositions);
+    Swap(Velocities, NextVelocities);
+
+    const double StepSeconds = FPlatformTime::Seconds() - StartTime;
+    LastStepMilliseconds = static_cast<float>(StepSeconds * 1000.0);
+    TotalStepSeconds += StepSeconds;
+}
+
+void AMonsterDirector::SyncActors()
+{
+    for (int32 Index = Monsters.Num() - 1; Index >= 0; Index--)
+    {
+        AMonsterAI* Monster = Monsters[Index];
+        if (!IsValid(Monster))
+        {
+            RemoveMonsterAt(Index);
+            continue;
+        }
+
+        Chasing[Index] = Monster->IsChasing() ? 1 : 0;
+
+        // Speed boosts and aggressive mode still go through the movement component
+        const UCharacterMovementComponent* Movement = Monster->GetCharacterMovement();
+        Speeds[Index] = Movement ? Movement->MaxWalkSpeed : Monster->MoveSpeed;
+
+        // Moved by someone else (respawn, teleport): take the new location as the state
+        const FVector Location = Monster->GetActorLocation();
+        if (FVector2D::DistSquared(FVector2D(Location.X, Location.Y), DrawnPositions[Index]) > 1.0)
+        {
+            Positions[Index] = FVector2D(Location.X, Location.Y);
+            PreviousPositions[Index] = Positions[Index];
+            DrawnPositions[Index] = Positions[Index];
+            Velocities[Index] = FVector2D::ZeroVector;
+        }
+        Heights[Index] = Location.Z;
+    }
+}
+
+void AMonsterDirector::BuildCellBuckets(const FMazeGrid& Grid, float CellSize)
+{
+    if (CellFirst.Num() != Grid.Num())
+    {
+        CellFirst.Init(INDEX_NONE, Grid.Num());
+    }
+    else
+    {
+        for (const int32 Cell : OccupiedCells)
+        {
+            CellFirst[Cell] = INDEX_NONE;
+        }
+    }
+    OccupiedCells.Reset();
+
+    for (int32 Index = 0; Index < Monsters.Num(); Index++)
+    {
+        const int32 Row = FMath::RoundToInt(Positions[Index].X / CellSize);
+        const int32 Col = FMath::RoundToInt(Positions[Index].Y / CellSize);
+        const int32 Cell = Grid.IsValid(Row, Col) ? Grid.ToIndex(Row, Col) : INDEX_NONE;
+
+        Cells[Index] = Cell;
+        NextInCell[Index] = INDEX_NONE;
+        if (Cell == INDEX_NONE)
+        {
+            continue;
+        }
+
+        if (CellFirst[Cell] == INDEX_NONE)
+        {
+            OccupiedCells.Add(Cell);
+        }
+        NextInCell[Index] = CellFirst[Cell];
+        CellFirst[Cell] = Index;
+    }
+}
+
+void AMonsterDirector::StepMonster(int32 Index, const FMazeGrid& Grid, float CellSize, const TArray<int32>& Distances,
+                                   const FVector2D& PlayerPoint, float DeltaTime)
+{
+    const FVector2D Position = Positions[Index];
+    FVector2D Velocity = Velocities[Index];
+    const int32 Cell = Cells[Index];
+
+    NextPositions[Index] = Position;
+    NextVelocities[Index] = FVector2D::ZeroVector;
+    if (!Chasing[Index] || Cell == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Decide: the player's position in its own cell, otherwise the center of the neighbor one step
+    // closer on the distance field. Walled off from the player = stand still.
+    const int32 Distance = Distances[Cell];
+    FVector2D Desired = FVector2D::ZeroVector;
+    if (Distance == 0)
+    {
+        Desired = (PlayerPoint - Position).GetSafeNormal();
+    }
+    else if (Distance > 0)
+    {
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+        {
+            if (Distances[Neighbor.Index] == Distance - 1)
+            {
+                const FVector2D Target(Grid.GetRow(Neighbor.Index) * CellSize, Grid.GetCol(Neighbor.Index) * CellSize);
+                Desired = (Target - Position).GetSafeNormal();
+                break;
+            }
+        }
+    }
+
+    if (Desired.IsNearlyZero())
+    {
+        NextVelocities[Index] = FVector2D::ZeroVector;
+        return;
+    }
+
+    // Steer: walls ahead from the wall grid, crowding from the monsters in this cell and the open neighbors
+    Desired += FMazeWallAvoidance::ComputeRepulsion(Grid, CellSize, Position, WallAvoidanceRadius, Desired);
+
+    if (SeparationRadius > 0.0f)
+    {
+        FVector2D Separation = FVector2D::ZeroVector;
+        const double RadiusSquared = FMath::Square(SeparationRadius);
+
+        auto SeparateFrom = [&](int32 BucketCell)
+        {
+            for (int32 Other = CellFirst[BucketCell]; Other != INDEX_NONE; Other = NextInCell[Other])
+            {
+                const FVector2D Offset = Position - Positions[Other];
+                const double DistanceSquared = Offset.SizeSquared();
+                if (Other == Index || DistanceSquared >= RadiusSquared || DistanceSquared <= UE_SMALL_NUMBER)
+                {
+                    continue;
+                }
+                const double Length = FMath::Sqrt(DistanceSquared);
+                Separation += Offset * ((1.0 - Length / SeparationRadius) / Length);
+            }
+        };
+
+        SeparateFrom(Cell);
+        for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Cell))
+        {
+            SeparateFrom(Neighbor.Index);
+        }
+        Desired += Separation * SeparationWeight;
+    }
+
+    const float Speed = Speeds[Index];
+    const FVector2D DesiredVelocity = Desired.GetSafeNormal() * Speed;
+
+    // Acceleration-limited turn towards the desired velocity
+    FVector2D Steering = DesiredVelocity - Velocity;
+    const double MaxDelta = MaxAcceleration * DeltaTime;
+    if (Steering.SizeSquared() > FMath::Square(MaxDelta))
+    {
+        Steering = Steering.GetSafeNormal() * MaxDelta;
+    }
+    Velocity += Steering;
+
+    FVector2D NewPosition = Position + Velocity * DeltaTime;
+    const float Reach = FMath::Max(CellSize * 0.5f - WallInset - BodyRadius, 0.0f);
+    FMazeWallAvoidance::ClampToCell(Grid, CellSize, Grid.GetRow(Cell), Grid.GetCol(Cell), Reach, NewPosition, Velocity);
+
+    NextPositions[Index] = NewPosition;
+    NextVelocities[Index] = Velocity;
+    if (!Velocity.IsNearlyZero())
+    {
+        Yaws[Index] = FMath::RadiansToDegrees(FMath::Atan2(Velocity.Y, Velocity.X));
+    }
+}
+
+void AMonsterDirector::ApplyTransforms(float Alpha)
+{
+    for (int32 Index = 0; Index < Monsters.Num(); Index++)
+    {
+        AMonsterAI* Monster = Monsters[Index];
+        if (!IsValid(Monster))
+        {
+            // Dropped by the next sync
+            continue;
+        }
+        const FVector2D Position = FMath::Lerp(PreviousPositions[Index], Positions[Index], Alpha);
+        const FVector2D& Velocity = Velocities[Index];
+        DrawnPositions[Index] = Position;
+
+        Monster->SetActorLocationAndRotation(FVector(Position.X, Position.Y, Heights[Index]), FRotator(0.0f, Yaws[Index], 0.0f));
+
+        // The animation blueprint reads GetVelocity(), which a character answers from its movement
+        // component even while that one does not tick
+        if (UCharacterMovementComponent* Movement = Monster->GetCharacterMovement())
+        {
+            Movement->Velocity = FVector(Velocity.X, Velocity.Y, 0.0f);
+        }
+    }
+}
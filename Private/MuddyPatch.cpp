@@ -1,6 +1,7 @@
 // MuddyPatch.cpp
 #include "MuddyPatch.h"
 #include "MazeGameMode.h"
+#include "MazeManager.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -76,9 +77,28 @@ void AMuddyPatch::BeginPlay()
     // Bind overlap event
     TriggerSphere->OnComponentBeginOverlap.AddDynamic(this, &AMuddyPatch::OnTriggerBeginOverlap);
     
+    // Mark the cell so weighted searches see the mud
+    TArray<AActor*> FoundManagers;
+    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeManager::StaticClass(), FoundManagers);
+    if (FoundManagers.Num() > 0)
+    {
+        TerrainManager = Cast<AMazeManager>(FoundManagers[0]);
+        TerrainManager->AddTerrain(GetActorLocation(), EMazeTerrain::Mud);
+    }
+    
     UE_LOG(LogTemp, Warning, TEXT("[MuddyPatch] Spawned at %s (Irregular organic sphere)"), *GetActorLocation().ToString());
 }
 
+void AMuddyPatch::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+    
+    if (TerrainManager.IsValid())
+    {
+        TerrainManager->RemoveTerrain(GetActorLocation(), EMazeTerrain::Mud);
+    }
+}
+
 void AMuddyPatch::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, 
                                         UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, 
                                         bool bFromSweep, const FHitResult& SweepResult)
@@ -1,5 +1,6 @@
 // SafeZoneCell.cpp
 #include "SafeZoneCell.h"
+#include "MazeManager.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -70,6 +71,21 @@ void ASafeZoneCell::BeginPlay()
     UE_LOG(LogTemp, Log, TEXT("[SafeZoneCell] Created at %s"), *GetActorLocation().ToString());
 }
 
+void ASafeZoneCell::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+    ClearTerrain();
+}
+
+void ASafeZoneCell::ClearTerrain()
+{
+    if (TerrainManager.IsValid())
+    {
+        TerrainManager->RemoveTerrain(GetActorLocation(), EMazeTerrain::SafeZone);
+    }
+    TerrainManager = nullptr;
+}
+
 void ASafeZoneCell::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -91,6 +107,18 @@ void ASafeZoneCell::ActivateSafeZone()
     SetActorHiddenInGame(false);
     SetActorEnableCollision(true);
     
+    // Monsters' weighted paths give the zone a wide berth
+    if (!TerrainManager.IsValid())
+    {
+        TArray<AActor*> FoundManagers;
+        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeManager::StaticClass(), FoundManagers);
+        if (FoundManagers.Num() > 0)
+        {
+            TerrainManager = Cast<AMazeManager>(FoundManagers[0]);
+            TerrainManager->AddTerrain(GetActorLocation(), EMazeTerrain::SafeZone);
+        }
+    }
+    
     UE_LOG(LogTemp, Warning, TEXT("[SafeZoneCell] ⚠️ SAFE ZONE ACTIVATED at %s"), *GetActorLocation().ToString());
     
     // Visual feedback
@@ -107,6 +135,7 @@ void ASafeZoneCell::DeactivateSafeZone()
     SetActorHiddenInGame(true);
     SetActorEnableCollision(false);
     bPlayerInside = false;
+    ClearTerrain();
     
     UE_LOG(LogTemp, Log, TEXT("[SafeZoneCell] Safe zone deactivated"));
 }
@@ -7,7 +7,6 @@
 #include "Components/StaticMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
 #include "GameFramework/Character.h"
 
 ATrapCell::ATrapCell()
@@ -87,9 +86,27 @@ void ATrapCell::Initialize(AMazeCell* Cell, float CellSize)
         TrapMesh->SetRelativeScale3D(FVector(Scale, Scale, 1.0f));
     }
     
+    // Guide paths route around flagged trap cells
+    AMazeGameMode* GameMode = Cast<AMazeGameMode>(GetWorld()->GetAuthGameMode());
+    if (GameMode && GameMode->MazeManager && !TerrainManager.IsValid())
+    {
+        TerrainManager = GameMode->MazeManager;
+        TerrainManager->AddTerrain(CellLocation, EMazeTerrain::Trap);
+    }
+    
     UE_LOG(LogTemp, Warning, TEXT("[TrapCell] Initialized trap at cell [%d,%d] - keeping small 10 unit trigger"), Cell->Row, Cell->Col);
 }
 
+void ATrapCell::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+    
+    if (TerrainManager.IsValid())
+    {
+        TerrainManager->RemoveTerrain(GetActorLocation(), EMazeTerrain::Trap);
+    }
+}
+
 void ATrapCell::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, 
                                        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, 
                                        bool bFromSweep, const FHitResult& SweepResult)
@@ -142,8 +159,20 @@ void ATrapCell::ActivateTrap(AActor* Player)
         TrapMesh->SetVisibility(false);
     }
     
-    // 4. Set timer for release
-    GetWorldTimerManager().SetTimer(ReleaseTimerHandle, this, &ATrapCell::ReleaseTrap, TrapDuration, false);
+    // 4. Start the release countdown (stepped by the game mode)
+    ReleaseTimeRemaining = FMath::Max(TrapDuration, KINDA_SMALL_NUMBER);
+}
+
+void ATrapCell::SimulateStep(float StepSeconds)
+{
+    if (ReleaseTimeRemaining <= 0.0f) return;
+    
+    ReleaseTimeRemaining -= StepSeconds;
+    if (ReleaseTimeRemaining <= 0.0f)
+    {
+        ReleaseTimeRemaining = 0.0f;
+        ReleaseTrap();
+    }
 }
 
 void ATrapCell::DragPlayerToCenter(AActor* Player)
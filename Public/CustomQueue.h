@@ -13,14 +13,33 @@ class CustomQueue{
     
     Node* FrontNode;
     Node* RearNode;
+    Node* FreeNodes;  // Dequeued nodes kept for reuse, a warmed-up queue never allocates
+    int32 NumFree;
     int32 Size;  
     
 public:
-    CustomQueue():FrontNode(nullptr), RearNode(nullptr), Size(0){}
+    CustomQueue():FrontNode(nullptr), RearNode(nullptr), FreeNodes(nullptr), NumFree(0), Size(0){}
     ~CustomQueue(){
         Clear();
+        while(FreeNodes!=nullptr){
+            Node* OldNode = FreeNodes;
+            FreeNodes=FreeNodes->next;
+            delete OldNode;
+        }
+    }
+    CustomQueue(const CustomQueue&) = delete;
+    CustomQueue& operator=(const CustomQueue&) = delete;
+    
+    // Pre-allocates nodes so the next Count enqueues don't hit the heap
+    void Reserve(int32 Count){
+        while(Size+NumFree<Count){
+            Node* NewNode = new Node(T());
+            NewNode->next=FreeNodes;
+            FreeNodes=NewNode;
+            ++NumFree;
+        }
     }
-    bool IsEmpty(){
+    bool IsEmpty() const{
         return (FrontNode==nullptr);
     }
     void Clear(){
@@ -38,7 +57,17 @@ public:
     }
    
     void Enqueue(T val){
-        Node* NewNode = new Node(val);
+        Node* NewNode;
+        if(FreeNodes!=nullptr){
+            NewNode=FreeNodes;
+            FreeNodes=FreeNodes->next;
+            --NumFree;
+            NewNode->elem=val;
+            NewNode->next=nullptr;
+        }
+        else{
+            NewNode = new Node(val);
+        }
         if(IsEmpty()){
             FrontNode = RearNode = NewNode;
         }
@@ -58,7 +87,9 @@ public:
         if(FrontNode==nullptr){
             FrontNode=RearNode=nullptr;
         }
-        delete OldNode;
+        OldNode->next=FreeNodes;
+        FreeNodes=OldNode;
+        ++NumFree;
         Size--;
     }
     
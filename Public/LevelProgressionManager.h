@@ -156,6 +156,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Level Progression")
     void InitializeLevelConfigs();
     
+    // The shipped level table, no actor needed (the level simulation reads it from a commandlet)
+    static void BuildDefaultLevelConfigs(TArray<FLevelConfig>& OutConfigs);
+    
     UFUNCTION(BlueprintCallable, Category = "Level Progression")
     FLevelConfig GetLevelConfig(int32 LevelNumber) const;
     
@@ -194,11 +197,11 @@ public:
     void LoadProgress();
 
 private:
-    void CreateLevel1Config();
-    void CreateLevel2Config();
-    void CreateLevel3Config();
-    void CreateLevel4Config();
-    void CreateLevel5Config();
+    static FLevelConfig CreateLevel1Config();
+    static FLevelConfig CreateLevel2Config();
+    static FLevelConfig CreateLevel3Config();
+    static FLevelConfig CreateLevel4Config();
+    static FLevelConfig CreateLevel5Config();
     
     // Save game slot name
     FString SaveSlotName = TEXT("MazeRunnerProgress");
@@ -0,0 +1,122 @@
+// MazeAutopilot.h
+// Scripted player for unattended soak and performance runs:
+//   UnrealEditor MazeRunner.uproject -game -nullrhi -autopilot [-seed=N] [-autopilotlevel=N] [-autopilotruns=N]
+// The game mode spawns it instead of showing the main menu. It plays level after level through the
+// normal StartLevel flow, steering the player pawn with movement input like a gamepad would: weighted
+// paths around mud and traps to the golden star, then to the exit, backing away from a monster that
+// gets close. Each run reseeds the global random stream with Seed + run index, so a bad run can be
+// started again on its own with -seed.
+// Every finished run appends one row (outcome, frame-time percentiles, hitches, memory, live
+// UObjects) to Saved/Autopilot/<session>/Level<N>.csv, written as it goes so a crash keeps the
+// night's data. A run with no progress for StuckTimeout seconds, or a level that never starts or
+// ends, is logged as a soft-lock and ended.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MazeAutopilot.generated.h"
+
+class AMazeGameMode;
+class AMazeCell;
+
+UCLASS()
+class MAZERUNNER_API AMazeAutopilot : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMazeAutopilot();
+
+    virtual void Tick(float DeltaTime) override;
+
+    // True when the command line asks for an autopilot session
+    static bool IsRequested();
+
+    // Reads -seed, -autopilotlevel and -autopilotruns; the first run starts on the next tick
+    void Configure(AMazeGameMode* InGameMode);
+
+    // ==================== SETTINGS ====================
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot")
+    int32 Seed = 1337;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "1", ClampMax = "5"))
+    int32 FirstLevel = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "1", ClampMax = "5"))
+    int32 LastLevel = 5;
+
+    // Playthroughs before the session quits the game, 0 = until stopped
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "0"))
+    int32 MaxRuns = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "0.05"))
+    float ReplanInterval = 0.25f;
+
+    // A waypoint counts as reached this close to its cell center
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "10.0"))
+    float WaypointRadius = 80.0f;
+
+    // A monster this many walking cells away or closer is avoided rather than walked into
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "0"))
+    int32 FleeCells = 3;
+
+    // No new cell for this long (traps hold for 5) while playing = soft-lock
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "1.0"))
+    float StuckTimeout = 15.0f;
+
+    // A level that has not started this long after StartLevel (the briefing takes 8) = soft-lock
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "1.0"))
+    float StartTimeout = 30.0f;
+
+    // Frames longer than this count as hitches
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "1.0"))
+    float HitchMilliseconds = 50.0f;
+
+    // Pause between the end of one run and the start of the next
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Autopilot", meta = (ClampMin = "0.0"))
+    float RestartDelay = 1.0f;
+
+private:
+    void StartRun();
+    void FinishRun(const TCHAR* Outcome);
+
+    // Moves the pawn one frame along the current plan, replanning when it is due
+    void Steer(float DeltaTime);
+    void Replan(AMazeCell* PlayerCell);
+
+    // Open neighbor of the player's cell farthest from the monster, nullptr when boxed in
+    AMazeCell* FindFleeCell(AMazeCell* PlayerCell, AMazeCell* MonsterCell);
+
+    void AppendRunRow(const TCHAR* Outcome, float LevelSeconds);
+
+    UPROPERTY()
+    AMazeGameMode* GameMode;
+
+    UPROPERTY()
+    TArray<AMazeCell*> Path;
+
+    UPROPERTY()
+    AMazeCell* LastPlayerCell;
+
+    int32 PathIndex;
+    float ReplanTimer;
+    float StuckTimer;
+
+    // Run state
+    int32 RunIndex;
+    int32 RunLevel;
+    int32 RunSeed;
+    bool bRunActive;
+    bool bLevelPlaying;
+    float StateTimer;           // Seconds since StartRun, or since the last run ended while idle
+    double PlayStartSeconds;
+
+    // Wall-clock frame times of the current run while the level is playing
+    TArray<float> FrameMilliseconds;
+    double LastFrameSeconds;
+
+    TArray<int32> MonsterDistances;
+    FString SessionDirectory;
+};
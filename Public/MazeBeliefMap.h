@@ -0,0 +1,69 @@
+// MazeBeliefMap.h
+// Where the player might be, as a probability per cell.
+// While nobody sees the player the probability spreads through the open passages every step (the
+// player keeps walking), the cells a monster looks at are emptied and the rest renormalized; a
+// sighting collapses it back onto one cell.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+/**
+ * The diffusion is a 5-point stencil over flat float planes padded with a ring of empty cells and
+ * a row length rounded up to the SIMD width, so every row is whole vectors and the neighbor loads
+ * never leave the plane. Walls are folded into per-direction 0/1 passage weights, which keeps the
+ * loop free of branches: four cells per instruction, no per-cell wall tests.
+ */
+class MAZERUNNER_API FMazeBeliefMap
+{
+public:
+    // Largest stable rate: a cell with four open passages gives away all of its probability
+    static constexpr float MaxDiffusionRate = 0.25f;
+
+    FMazeBeliefMap();
+
+    // Sizes the planes for Grid and rebuilds the passage weights once the walls changed. The belief
+    // survives wall changes, a new grid size starts from an even spread.
+    void SyncWalls(const FMazeGrid& Grid);
+
+    bool IsInitialized() const { return Rows > 0; }
+
+    // All the probability on one cell (the player was just sensed there)
+    void CollapseTo(int32 CellIndex);
+
+    // Same probability everywhere (nothing known)
+    void SpreadUniform();
+
+    // Nobody there: the cells are emptied, Normalize hands their share to the rest
+    void ClearCells(TArrayView<const int32> CellIndices);
+
+    // Steps of diffusion. Rate is the fraction of a cell's probability that flows through each of
+    // its open passages per step (clamped to MaxDiffusionRate). Total probability is preserved.
+    void Diffuse(int32 Steps, float Rate);
+
+    // Rescales the total to 1, spreads evenly when everything was cleared. Returns the total before.
+    float Normalize();
+
+    float GetProbability(int32 CellIndex) const;
+
+    // Highest-probability cell, INDEX_NONE when the map is empty
+    int32 FindMostLikelyCell() const;
+
+private:
+    int32 ToPadded(int32 CellIndex) const { return (CellIndex / Cols + 1) * Stride + CellIndex % Cols + 1; }
+
+    int32 Rows;
+    int32 Cols;
+    int32 Stride;   // Padded row length, a multiple of the SIMD width
+    uint32 WallVersion;
+
+    // (Rows + 2) x Stride each, cell (Row, Col) at (Row + 1) * Stride + Col + 1
+    TArray<float> Belief;
+    TArray<float> Scratch;
+    TArray<float> OpenNorth;
+    TArray<float> OpenEast;
+    TArray<float> OpenSouth;
+    TArray<float> OpenWest;
+};
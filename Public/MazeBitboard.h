@@ -0,0 +1,137 @@
+// MazeBitboard.h
+// Bit-parallel BFS over per-row wall bitboards.
+// Each row is stored as 64-bit words (bit = column), so a wide frontier is expanded a whole row
+// at a time with a handful of shifts, ANDs and ORs instead of one queue pop per cell.
+// Narrow frontiers (most layers in a maze) are expanded cell by cell from the packed open masks.
+// Plain 64-bit word operations on every platform: a row is only a few words wide, too short for
+// wider vector registers to pay off, so there is no per-CPU code path to select.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+/**
+ * Per-source distance planes from a multi-source BFS.
+ * Plane N holds the distance of every cell (indexed like FMazeGrid) from Sources[N].
+ */
+struct MAZERUNNER_API FMazeDistancePlanes
+{
+    static constexpr uint16 Unreachable = MAX_uint16;
+    static constexpr uint16 MaxDistance = MAX_uint16 - 1;  // Longer distances saturate here
+
+    int32 NumCells = 0;
+    TArray<int32> Sources;
+    TArray<uint16> Data;  // Sources.Num() planes of NumCells each
+
+    int32 GetNumPlanes() const { return Sources.Num(); }
+
+    TArrayView<const uint16> GetPlane(int32 Plane) const
+    {
+        return TArrayView<const uint16>(Data.GetData() + Plane * NumCells, NumCells);
+    }
+
+    uint16 GetDistance(int32 Plane, int32 CellIndex) const { return Data[Plane * NumCells + CellIndex]; }
+};
+
+class MAZERUNNER_API FMazeBitboard
+{
+public:
+    FMazeBitboard();
+
+    // Rebuild the passage bitboards from the packed grid
+    void Build(const FMazeGrid& Grid);
+
+    // BFS distances in steps from SourceIndex (-1 = unreachable).
+    // Stops early once StopIndex is reached (INDEX_NONE = full distance field).
+    // Returns the number of cells reached.
+    int32 ComputeDistanceField(int32 SourceIndex, TArray<int32>& OutDistances, int32 StopIndex = INDEX_NONE);
+
+    // Steps between two cells, -1 when not connected
+    int32 GetPathDistance(int32 FromIndex, int32 ToIndex);
+
+    // Multi-source BFS: up to 64 traversals share one walk of the grid, one bit per source in a
+    // 64-bit seen/frontier word per cell. Larger source lists run in batches of 64.
+    // The shared walk pays off when the sources are close together (the waves reach a cell on
+    // the same layers); a batch spread over the maze runs as single fields instead.
+    void ComputeDistancePlanes(TArrayView<const int32> Sources, FMazeDistancePlanes& OutPlanes);
+
+    bool IsBuilt() const { return Rows > 0 && Cols > 0; }
+    int32 GetRows() const { return Rows; }
+    int32 GetCols() const { return Cols; }
+
+    // WallVersion of the grid this was built from
+    uint32 GetSourceWallVersion() const { return SourceWallVersion; }
+
+    // Stats from the last search
+    int32 GetLastLayers() const { return LastLayers; }
+    int32 GetLastDenseLayers() const { return LastDenseLayers; }
+
+    // Batches of the last ComputeDistancePlanes call that ran as one shared walk
+    int32 GetLastSharedBatches() const { return LastSharedBatches; }
+
+private:
+    struct FFrontierCell
+    {
+        int32 Index;
+        int32 Row;
+    };
+
+    // Rows are padded with zero words on each side and two zero rows above and below,
+    // so shifted loads and row +/- 1 never need a bounds check. Stride is a power of two.
+    int32 RowOffset(int32 Row) const { return (Row + 2) * Stride + 1; }
+
+    // One BFS step into a single word, returns the newly reached cells
+    uint64 ExpandWord(int32 Offset, const uint64* Frontier, uint64* Next) const;
+
+    // One BFS step into a whole row, returns true when any new cell was reached
+    bool ExpandRow(int32 Row, const uint64* Frontier, uint64* Next) const;
+
+    // Sets the bits of Cells, or clears their whole words
+    void SetCellBits(uint64* Words, const TArray<FFrontierCell>& Cells, bool bSet) const;
+
+    // One batch of at most 64 sources written into the planes starting at FirstPlane
+    void RunMultiSourceBatch(TArrayView<const int32> Sources, int32 FirstPlane, FMazeDistancePlanes& OutPlanes);
+
+    // True when the batch's waves overlap enough for the shared walk to beat single fields
+    bool ShouldShareWalk(TArrayView<const int32> Sources);
+
+    // The batch as one single-source field per plane
+    void RunSingleFieldBatch(TArrayView<const int32> Sources, int32 FirstPlane, FMazeDistancePlanes& OutPlanes);
+
+    int32 Rows;
+    int32 Cols;
+    int32 WordsPerRow;
+    int32 Stride;
+    int32 StrideShift;
+    uint32 SourceWallVersion;
+
+    TArray<uint64> EastOpen;   // Bit C set = passage (Row, C) <-> (Row, C + 1) open
+    TArray<uint64> SouthOpen;  // Bit C set = passage (Row, C) <-> (Row + 1, C) open
+
+    TArray<uint8> OpenMasks;   // Per cell, bit N set = open towards EMazeDirection N
+
+    // Search scratch, the bit buffers are only filled during a dense layer and zeroed right after
+    TArray<uint64> Previous;
+    TArray<uint64> FrontierBits;
+    TArray<uint64> NextBits;
+    TArray<FFrontierCell> PreviousCells;
+    TArray<FFrontierCell> CurrentCells;
+    TArray<FFrontierCell> NextCells;
+    TArray<int32> DistanceScratch;
+
+    // ShouldShareWalk's radius-limited search; all -1 outside of it
+    TArray<int32> ProbeDistances;
+    TArray<int32> ProbeCells;
+
+    // Multi-source scratch, one bit per source
+    TArray<uint64> SeenSources;
+    TArray<uint64> VisitSources;
+    TArray<uint64> VisitNextSources;
+    TArray<int32> ActiveCells;
+    TArray<int32> NextActiveCells;
+    int32 LastLayers;
+    int32 LastDenseLayers;
+    int32 LastSharedBatches;
+};
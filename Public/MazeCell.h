@@ -121,4 +121,5 @@ private:
     void CreateWallComponent(UStaticMeshComponent*& Wall, const FName& Name, UStaticMesh* Mesh);
     void SetupEmissiveMaterial(UMaterialInstanceDynamic*& Material, const FLinearColor& Color, float Intensity);
     UPointLightComponent* CreateHighlightLight(const FLinearColor& Color, float Intensity, float Radius, float Height);
+    void NotifyWallsChanged();
 };
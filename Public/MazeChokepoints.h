@@ -0,0 +1,77 @@
+// MazeChokepoints.h
+// Cells and passages every route to the exit has to go through.
+// Loops give the player choices, but the maze still has articulation cells (removing one cuts the
+// maze in two) and bridge passages. One iterative Tarjan DFS rooted at the exit finds them all in
+// O(cells), and the DFS tree then tells, for any cell, which of them lie on every route from it to
+// the exit: a cell's route is forced through an ancestor exactly when the subtree hanging below that
+// ancestor has no back edge above it.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+enum class EMazeChokepoint : uint8
+{
+    None         = 0,
+    Articulation = 1 << 0,  // Removing the cell disconnects the maze
+    Bridge       = 1 << 1   // The passage from the cell towards the exit (its DFS parent) is the only link
+};
+ENUM_CLASS_FLAGS(EMazeChokepoint);
+
+class MAZERUNNER_API FMazeChokepoints
+{
+public:
+    FMazeChokepoints();
+
+    // Full analysis rooted at ExitIndex, O(cells)
+    void Build(const FMazeGrid& Grid, int32 ExitIndex);
+
+    // Built for these walls and this exit
+    bool IsUpToDate(const FMazeGrid& Grid, int32 ExitIndex) const;
+
+    bool IsBuilt() const { return ExitIndex != INDEX_NONE; }
+    int32 GetExitIndex() const { return ExitIndex; }
+
+    EMazeChokepoint GetFlags(int32 CellIndex) const
+    {
+        return Flags.IsValidIndex(CellIndex) ? static_cast<EMazeChokepoint>(Flags[CellIndex]) : EMazeChokepoint::None;
+    }
+
+    bool IsChokepoint(int32 CellIndex) const { return EnumHasAnyFlags(GetFlags(CellIndex), EMazeChokepoint::Articulation); }
+
+    // The forced cells between CellIndex and the exit (both excluded), read off per-cell tables in O(1).
+    // Next is the one the player meets first, chaining Next from it walks them all in order; Last is
+    // the one closest to the exit. INDEX_NONE when there is none, or the cell cannot reach the exit.
+    int32 GetNextChokepoint(int32 CellIndex) const { return NextChoke.IsValidIndex(CellIndex) ? NextChoke[CellIndex] : INDEX_NONE; }
+    int32 GetLastChokepoint(int32 CellIndex) const { return LastChoke.IsValidIndex(CellIndex) ? LastChoke[CellIndex] : INDEX_NONE; }
+    int32 GetNumChokepointsToExit(int32 CellIndex) const { return ChokeCount.IsValidIndex(CellIndex) ? ChokeCount[CellIndex] : 0; }
+
+    int32 GetNumArticulationPoints() const { return NumArticulationPoints; }
+    int32 GetNumBridges() const { return NumBridges; }
+
+private:
+    struct FFrame
+    {
+        int32 Cell;
+        uint32 OpenMask;    // Passages not explored yet
+    };
+
+    int32 ExitIndex;
+    uint32 WallVersion;
+    int32 NumArticulationPoints;
+    int32 NumBridges;
+
+    TArray<uint8> Flags;
+    TArray<int32> NextChoke;
+    TArray<int32> LastChoke;
+    TArray<int32> ChokeCount;
+
+    // DFS scratch, kept between builds
+    TArray<int32> Discovery;    // Discovery time, -1 = not reached from the exit
+    TArray<int32> Low;          // Earliest discovery time reachable from the subtree through one back edge
+    TArray<int32> Parent;
+    TArray<int32> PreOrder;
+    TArray<FFrame> Stack;
+};
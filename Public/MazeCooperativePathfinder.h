@@ -0,0 +1,107 @@
+// MazeCooperativePathfinder.h
+// Windowed cooperative pathfinding for several monsters chasing the same player.
+// Every monster plans over the next few steps in space-time (cell, step) around the cells the
+// others already reserved, reserves its own plan, and follows the shared player distance field for
+// the rest of the way. The distance field is an exact heuristic, so a search with nobody in the way
+// walks straight down it, and the window bounds the work per monster whatever the monster count.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+/**
+ * Space-time reservations, one ring of slots per cell indexed by absolute step. Live reservations lie
+ * in [NowStep, NowStep + Window], so a ring longer than the window never holds two of them in one
+ * slot and anything older is stale: nothing has to be swept when time moves on. A cell's ring is
+ * contiguous, so "does anyone else pass here in the window" reads one or two cache lines.
+ */
+class MAZERUNNER_API FMazeReservationTable
+{
+public:
+    FMazeReservationTable();
+
+    // Sizes the table, dropping every reservation (the agents stay registered)
+    void Init(int32 NumCells, int32 WindowSteps);
+
+    bool Matches(int32 NumCells, int32 WindowSteps) const { return NumCells == NumTableCells && WindowSteps == Window; }
+
+    // Agents that plan through the table, registered ones are counted even before their first plan
+    void RegisterAgent(int32 AgentId);
+    void UnregisterAgent(int32 AgentId);
+    int32 GetNumAgents() const { return AgentSlots.Num(); }
+
+    // Claims (Cell, Step) unless another agent already holds it
+    void Reserve(int32 AgentId, int32 Cell, int32 Step);
+
+    // Drops every reservation of the agent
+    void Release(int32 AgentId);
+
+    // Agent holding (Cell, Step), INDEX_NONE when free
+    int32 GetOwner(int32 Cell, int32 Step) const;
+
+    // True when another agent holds the cell at any step of [FromStep, ToStep]
+    bool IsClaimedByOther(int32 Cell, int32 AgentId, int32 FromStep, int32 ToStep) const;
+
+private:
+    struct FSlot
+    {
+        int32 Step = MIN_int32;
+        int32 Agent = INDEX_NONE;
+    };
+
+    int32 NumTableCells;
+    int32 Window;
+    int32 RingMask;
+
+    // Cell * (RingMask + 1) + (Step & RingMask)
+    TArray<FSlot> Slots;
+
+    // (Cell, Step) pairs per agent, so a replan releases exactly what the last one reserved
+    TMap<int32, TArray<FIntPoint>> AgentSlots;
+};
+
+class MAZERUNNER_API FMazeCooperativePathfinder
+{
+public:
+    FMazeCooperativePathfinder();
+
+    // Space-time A* from StartIndex at NowStep over at most WindowSteps steps (moving or waiting,
+    // one step each) around the other agents' reservations, no head-on swaps. GoalDistances is the
+    // distance field towards GoalIndex and the cost-to-go at the window's edge. Cells another agent
+    // passes during the window cost CrowdPenalty extra, which sends a second monster down a parallel
+    // corridor rather than single file behind the first.
+    // The plan is reserved for AgentId (after releasing its previous one); OutPath is the planned cells
+    // without waits, continued down GoalDistances to the goal. False when the goal is unreachable.
+    bool FindPath(const FMazeGrid& Grid, FMazeReservationTable& Table, int32 AgentId, int32 StartIndex, int32 GoalIndex,
+                  const TArray<int32>& GoalDistances, int32 NowStep, int32 WindowSteps, int32 CrowdPenalty,
+                  TArray<int32>& OutPath);
+
+    // Space-time states expanded by the last FindPath
+    int32 GetLastExpansions() const { return LastExpansions; }
+
+private:
+    struct FNode
+    {
+        int32 Cell;
+        int32 Time;     // Steps after NowStep
+        int32 G;
+        int32 Parent;   // Node index, INDEX_NONE at the start
+    };
+
+    struct FOpenEntry
+    {
+        int32 F;
+        int32 G;
+        int32 Node;
+
+        bool operator<(const FOpenEntry& Other) const { return F < Other.F || (F == Other.F && G > Other.G); }
+    };
+
+    TArray<FNode> Nodes;
+    TArray<FOpenEntry> OpenHeap;
+    TMap<uint64, int32> StateNodes;   // (Cell, Time) -> best node so far
+    TArray<int32> PlanScratch;
+    int32 LastExpansions;
+};
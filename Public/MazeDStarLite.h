@@ -0,0 +1,101 @@
+// MazeDStarLite.h
+// Incremental replanning (D* Lite) on the packed grid.
+// The search is rooted at the goal, so when the start moves or a few walls change the previous
+// search is repaired in place instead of being thrown away. A goal that moves a few cells moves
+// the root the way Moving-Target D* Lite does: the new goal gets rhs 0 and the old one re-derives
+// its rhs from its neighbors. A goal that jumps further restarts the search.
+// Monsters root it at themselves and pass the player as the start, so the player's moves cost only
+// a km update and the monster's own single steps a root move.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+class MAZERUNNER_API FMazeDStarLite
+{
+public:
+    FMazeDStarLite();
+
+    // Drops the previous search and starts a new one towards GoalIndex
+    void Reset(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex);
+
+    // Shortest path StartIndex..GoalIndex. Picks up start and goal moves and wall changes since
+    // the last call (diffed against the walls it last saw) and repairs only the affected part of
+    // the search. A goal jump past MaxGoalMoveCells or a different grid size restarts the search.
+    bool FindPath(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath);
+
+    bool IsInitialized() const { return GoalIndex != INDEX_NONE; }
+    int32 GetGoal() const { return GoalIndex; }
+
+    // WallVersion of the grid the search is consistent with
+    uint32 GetKnownWallVersion() const { return KnownWallVersion; }
+
+    // Stats from the last FindPath call
+    int32 GetLastExpansions() const { return LastExpansions; }
+    int32 GetLastChangedCells() const { return LastChangedCells; }
+    bool WasLastSearchRestarted() const { return bLastSearchRestarted; }
+
+private:
+    static constexpr int32 Infinity = MAX_int32 / 4;
+
+    // Further than this the old search is mostly wrong and a fresh one expands less than the repair
+    static constexpr int32 MaxGoalMoveCells = 4;
+
+    struct FKey
+    {
+        int32 Primary;
+        int32 Secondary;
+
+        bool operator<(const FKey& Other) const
+        {
+            return Primary < Other.Primary || (Primary == Other.Primary && Secondary < Other.Secondary);
+        }
+    };
+
+    struct FQueueEntry
+    {
+        FKey Key;
+        int32 Cell;
+    };
+
+    FKey CalculateKey(int32 Cell) const;
+    int32 Heuristic(int32 Cell) const;
+
+    // Recomputes rhs from the open neighbors and re-queues the cell when it became inconsistent
+    void UpdateVertex(const FMazeGrid& Grid, int32 Cell);
+    void ComputeShortestPath(const FMazeGrid& Grid);
+
+    // Diffs the grid against KnownMasks, returns false when the change is too large to repair
+    bool ApplyWallChanges(const FMazeGrid& Grid);
+
+    // Moves the root of the search to NewGoalIndex
+    void MoveGoal(const FMazeGrid& Grid, int32 NewGoalIndex);
+
+    // Indexed binary heap keyed by cell, so a cell can be re-keyed or removed in O(log n)
+    void QueueInsertOrUpdate(int32 Cell, const FKey& Key);
+    void QueueRemove(int32 Cell);
+    void SiftUp(int32 Position);
+    void SiftDown(int32 Position);
+    void QueueSwap(int32 A, int32 B);
+
+    int32 Rows;
+    int32 Cols;
+    int32 StartIndex;
+    int32 GoalIndex;
+    int32 LastStartIndex;
+    int32 KeyModifier;  // km: accumulated heuristic drift from start moves
+    uint32 KnownWallVersion;
+
+    TArray<int32> G;
+    TArray<int32> Rhs;
+    TArray<int32> HeapPosition;  // Per cell, INDEX_NONE when not queued
+    TArray<FQueueEntry> Heap;
+    TArray<uint8> KnownMasks;    // Walls the search is consistent with
+    TArray<int32> ChangedScratch;
+
+    int32 LastExpansions;
+    int32 LastChangedCells;
+    bool bLastSearchRestarted;
+};
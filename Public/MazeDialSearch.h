@@ -0,0 +1,82 @@
+// MazeDialSearch.h
+// Terrain-weighted shortest paths with Dial's algorithm.
+// Entering a cell costs a small integer picked from the agent's cost profile by the cell's
+// terrain flags, so the open set is a ring of at least MaxCost + 1 buckets (O(1) push and pop,
+// decrease-key by pushing again) instead of a binary heap.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+// Per-cell terrain flags written by the hazards (one byte per cell in the terrain plane)
+enum class EMazeTerrain : uint8
+{
+    None     = 0,
+    Mud      = 1 << 0,
+    Trap     = 1 << 1,
+    SafeZone = 1 << 2,
+};
+ENUM_CLASS_FLAGS(EMazeTerrain);
+
+/**
+ * What entering a cell costs one kind of agent. Every cost is at least 1, a cell with
+ * several terrain flags costs the highest of them.
+ */
+struct MAZERUNNER_API FMazeCostProfile
+{
+    static constexpr int32 NumTerrainTypes = 3;
+    static constexpr int32 NumTerrainMasks = 1 << NumTerrainTypes;
+
+    uint8 OpenCost = 1;
+    uint8 MudCost = 1;
+    uint8 TrapCost = 1;
+    uint8 SafeZoneCost = 1;
+
+    // Every cell costs 1 (plain BFS distances)
+    static FMazeCostProfile Uniform() { return FMazeCostProfile(); }
+
+    // Monsters wade around mud and keep well away from safe zones
+    static FMazeCostProfile Monster() { return Make(1, 3, 1, 25); }
+
+    // The golden star's guide path steps around traps and, when it is cheap to, mud
+    static FMazeCostProfile PlayerGuide() { return Make(1, 2, 12, 1); }
+
+    static FMazeCostProfile Make(int32 Open, int32 Mud, int32 Trap, int32 SafeZone);
+
+    int32 GetCost(uint8 Terrain) const;
+    int32 GetMaxCost() const;
+};
+
+class MAZERUNNER_API FMazeDialSearch
+{
+public:
+    FMazeDialSearch();
+
+    // Cheapest path Start..Goal. Terrain is one flag byte per cell, or empty for open terrain everywhere.
+    bool FindPath(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                  int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath);
+
+    // Cost from Source to every cell (-1 = unreachable)
+    void ComputeCostField(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+                          int32 SourceIndex, TArray<int32>& OutCosts);
+
+    // Stats from the last call: path cost (FindPath) or the cost of the farthest cell (ComputeCostField)
+    int32 GetLastCost() const { return LastCost; }
+    int32 GetLastExpansions() const { return LastExpansions; }
+
+private:
+    static constexpr int32 Infinity = MAX_int32;
+
+    // Settles cells in cost order from Source until Goal is settled (INDEX_NONE = all of them)
+    void Run(const FMazeGrid& Grid, TArrayView<const uint8> Terrain, const FMazeCostProfile& Profile,
+             int32 SourceIndex, int32 GoalIndex);
+
+    TArray<int32> Cost;
+    TArray<int32> Parent;
+    TArray<TArray<int32>> Buckets;  // Ring of cell stacks, cost C lives in bucket C & (Num - 1)
+
+    int32 LastCost;
+    int32 LastExpansions;
+};
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "MazeSimulationClock.h"
 #include "MazeGameMode.generated.h"
 
 UENUM(BlueprintType)
@@ -85,6 +86,27 @@ public:
     bool bSecondMonsterSpawned;
     bool bAggressiveModeActivated;
     
+    // Level 5 horde: each monster spawn becomes a wave of HordeWaveSize monsters, all moved by one
+    // batched AMonsterDirector instead of ticking on their own
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Horde")
+    bool bHordeMode = false;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Horde", meta = (ClampMin = "1", ClampMax = "1000", EditCondition = "bHordeMode"))
+    int32 HordeWaveSize = 60;
+    
+    UPROPERTY()
+    class AMonsterDirector* MonsterDirector;
+    
+    class AMonsterDirector* EnsureMonsterDirector();
+    
+    // Scripted player of a -autopilot session (soak and performance runs), null otherwise
+    UPROPERTY()
+    class AMazeAutopilot* Autopilot;
+    
+    // Monster stress session (-stresstest or RunStressTest), null otherwise
+    UPROPERTY()
+    class AMazeStressTest* StressTest;
+    
     UPROPERTY()
     class AGoldenStar* SpawnedStar;
     
@@ -225,6 +247,57 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bShowPerformanceStats;
     
+    // Game-thread time of all catch checks so far, the stress test reads the difference over its window
+    double CatchCheckSeconds;
+    
+    // ==================== SIMULATION CLOCK ====================
+    
+    // Level timer, level events, traps and monster AI advance in fixed steps, the same at any frame
+    // rate; the HUD, camera and flashlight follow the frame. Off = one step of each frame's DeltaTime.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+    bool bFixedStepSimulation;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "10.0", ClampMax = "240.0", EditCondition = "bFixedStepSimulation"))
+    float SimulationStepsPerSecond;
+    
+    // Past this many steps in one frame the game falls behind instead of catching up all at once
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "1", EditCondition = "bFixedStepSimulation"))
+    int32 MaxSimulationStepsPerFrame;
+    
+    FMazeSimulationClock SimulationClock;
+    
+    // Seed of the random choices monsters make on the simulation clock (search walks), so a run
+    // replays with the clock. 0 = draw a new seed from the global stream every level.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (EditCondition = "bFixedStepSimulation"))
+    int32 SimulationSeed;
+    
+    FRandomStream SimulationRandom;
+    
+    // Seconds until the level's monster spawns, negative = none pending
+    float MonsterSpawnCountdown;
+    
+    // One step of gameplay: timer, level events, monsters, traps, win and lose checks
+    void SimulateStep(float StepSeconds);
+    
+    // Adds a spawned monster to SpawnedMonsters and puts it on the simulation clock
+    void TrackMonster(class AMonsterAI* Monster);
+    
+    // All monster animation shares one per-frame budget (AnimationBudgetAllocator plugin): far and
+    // hidden monsters update less often and interpolate in between, so more monsters cost the same.
+    // The a.Budget.* console variables override these at runtime. Only built in when the project
+    // enables the plugin (MAZE_WITH_ANIMATION_BUDGET), otherwise these settings do nothing.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bUseAnimationBudget = true;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", EditCondition = "bUseAnimationBudget"))
+    float AnimationBudgetMs = 1.0f;
+    
+    // Hidden monsters that keep animating, the rest hold their pose until seen again
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0", EditCondition = "bUseAnimationBudget"))
+    int32 MaxOffscreenAnimatedMonsters = 4;
+    
+    void ConfigureAnimationBudget();
+    
     float FPSSampleAccumulator;
     int32 FPSSampleCount;
     
@@ -350,6 +423,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Spawning")
     void SpawnMonster();
     
+    // Spawns Count director-driven monsters at least 5 cells of walking away from the player
+    UFUNCTION(Exec, Category = "Spawning")
+    void SpawnHorde(int32 Count = 100);
+    
     // Level 5 Blood Moon functions
     void SpawnSecondMonster();
     void ActivateAggressiveMode();
@@ -481,5 +558,34 @@ public:
     // CHEAT CODE: Instant win
     UFUNCTION(Exec, Category = "Cheats")
     void Win();
+    
+    // DEBUG: Distance field benchmark (bitboard BFS vs queue BFS), plus the live maze if one is loaded
+    UFUNCTION(Exec, Category = "Debug")
+    void BenchmarkPathfinding(int32 Size = 256, int32 Iterations = 20);
+    
+    // DEBUG: Latency/correctness suite over the seeded maze corpus up to MaxSize, CSV under Saved/Benchmarks
+    UFUNCTION(Exec, Category = "Debug")
+    void BenchmarkPathSuite(int32 MaxSize = 256, int32 Queries = 50);
+    
+    // DEBUG: Path request queue depth, latency and per-frame cost, plus path cache hits/misses
+    UFUNCTION(Exec, Category = "Debug")
+    void PathQueueStats();
+    
+    // DEBUG: Monsters per AI LOD tier and the CPU cost of their ticks since the last call (then resets)
+    UFUNCTION(Exec, Category = "Debug")
+    void MonsterLODStats();
+    
+    // DEBUG: Marks the articulation cells (red) and the ones on every route from the player to the exit (yellow)
+    UFUNCTION(Exec, Category = "Debug")
+    void ShowChokepoints();
+    
+    // DEBUG: Headless Monte Carlo sweep of every level (bot player, Runs play-throughs per point), CSV under Saved/Balance
+    UFUNCTION(Exec, Category = "Debug")
+    void SimulateLevels(int32 Runs = 100);
+    
+    // Steps 1 to MaxMonsters monsters through modern, legacy and director AI on a MazeSize maze with
+    // NumHazards mud and trap cells, and writes the per-subsystem frame cost to Saved/Benchmarks
+    UFUNCTION(Exec, Category = "Debug")
+    void RunStressTest(int32 MaxMonsters = 500, int32 MazeSize = 30, int32 NumHazards = 20);
 };
 
@@ -0,0 +1,243 @@
+// MazeGrid.h
+// Packed, actor-free copy of the maze walls used by the pathfinding layers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MazeTopology.h"
+
+// Adjacent (row, col) step -> direction, indexed [row parity][dRow + 1][dCol + 1], built at compile time
+template <typename TTopology>
+struct TMazeDirectionLookup
+{
+    int32 Table[2][3][3];
+
+    constexpr TMazeDirectionLookup()
+        : Table{}
+    {
+        for (int32 Parity = 0; Parity < 2; Parity++)
+        {
+            for (int32 Row = 0; Row < 3; Row++)
+            {
+                for (int32 Col = 0; Col < 3; Col++)
+                {
+                    Table[Parity][Row][Col] = INDEX_NONE;
+                }
+            }
+
+            for (int32 Dir = 0; Dir < TTopology::NumDirections; Dir++)
+            {
+                Table[Parity][TTopology::RowDelta[Dir] + 1][TTopology::ColDelta[Dir] + Parity * TTopology::OddRowColShift[Dir] + 1] = Dir;
+            }
+        }
+    }
+};
+
+/**
+ * One byte per cell, bit N set = wall in direction N of the topology.
+ * Walls are stored as *effective* walls: a passage is only open when neither cell has
+ * its wall up, and the outer boundary is always closed. This keeps the mask symmetric
+ * even after traps show/hide the walls of a single cell.
+ *
+ * The topology is a compile-time policy (see MazeTopology.h) and also the base class, so
+ * FMazeGrid::RowDelta, FMazeGrid::NumDirections etc. are the policy's tables.
+ */
+template <typename TTopology>
+struct TMazeGrid : public TTopology
+{
+    using Topology = TTopology;
+
+    static_assert(TTopology::NumDirections <= 8, "Wall masks are one byte per cell");
+
+    static constexpr int32 NumDirections = TTopology::NumDirections;
+    static constexpr uint8 AllWalls = static_cast<uint8>((1u << NumDirections) - 1);
+    static constexpr TMazeDirectionLookup<TTopology> DirectionLookup{};
+
+    struct FNeighbor
+    {
+        int32 Dir;
+        int32 Index;
+    };
+
+    // Walks the set bits of an open mask, lowest direction first (no per-direction branch)
+    struct FNeighborIterator
+    {
+        int32 Base;
+        const int32* Deltas;
+        uint32 Mask;
+
+        FNeighbor operator*() const
+        {
+            const int32 Dir = static_cast<int32>(FMath::CountTrailingZeros(Mask));
+            return FNeighbor{ Dir, Base + Deltas[Dir] };
+        }
+
+        FNeighborIterator& operator++()
+        {
+            Mask &= Mask - 1;
+            return *this;
+        }
+
+        bool operator!=(const FNeighborIterator& Other) const { return Mask != Other.Mask; }
+    };
+
+    // Fixed-size view over the open neighbors of one cell, nothing is allocated:
+    //     for (const FMazeGrid::FNeighbor Neighbor : Grid.OpenNeighbors(Index)) { ... }
+    struct FNeighborRange
+    {
+        int32 Base;
+        const int32* Deltas;
+        uint32 Mask;
+
+        FNeighborIterator begin() const { return FNeighborIterator{ Base, Deltas, Mask }; }
+        FNeighborIterator end() const { return FNeighborIterator{ Base, Deltas, 0 }; }
+        int32 Num() const { return static_cast<int32>(FMath::CountBits(Mask)); }
+    };
+
+    int32 Rows = 0;
+    int32 Cols = 0;
+    TArray<uint8> WallMasks;
+
+    // Bumped every time any passage opens or closes
+    uint32 WallVersion = 0;
+
+    // Index offset per direction for even/odd rows, filled by Init from the topology tables
+    int32 IndexDelta[2][NumDirections] = {};
+
+    // Resets to a fully walled grid
+    void Init(int32 InRows, int32 InCols);
+
+    // Opens or closes the passage between a cell and its neighbor (both sides are updated)
+    void SetPassage(int32 Index, int32 Dir, bool bOpen);
+
+    int32 Num() const { return Rows * Cols; }
+    int32 ToIndex(int32 Row, int32 Col) const { return Row * Cols + Col; }
+    int32 GetRow(int32 Index) const { return Index / Cols; }
+    int32 GetCol(int32 Index) const { return Index % Cols; }
+    bool IsValid(int32 Row, int32 Col) const { return Row >= 0 && Row < Rows && Col >= 0 && Col < Cols; }
+
+    static constexpr int32 Opposite(int32 Dir) { return TTopology::OppositeDir[Dir]; }
+
+    // Square topologies never look at the row, so they never pay for the divide
+    int32 GetRowParity(int32 Index) const
+    {
+        if constexpr (TTopology::bOffsetRows)
+        {
+            return GetRow(Index) & 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    static int32 GetNeighborRow(int32 Row, int32 Dir) { return Row + TTopology::RowDelta[Dir]; }
+    static int32 GetNeighborCol(int32 Row, int32 Col, int32 Dir)
+    {
+        return Col + TTopology::ColDelta[Dir] + (TTopology::bOffsetRows ? (Row & 1) * TTopology::OddRowColShift[Dir] : 0);
+    }
+
+    // Direction from cell A to the adjacent cell B, INDEX_NONE when they are not neighbors
+    static int32 GetDirectionBetween(int32 RowA, int32 ColA, int32 RowB, int32 ColB)
+    {
+        const int32 DRow = RowB - RowA;
+        const int32 DCol = ColB - ColA;
+        if (static_cast<uint32>(DRow + 1) > 2u || static_cast<uint32>(DCol + 1) > 2u)
+        {
+            return INDEX_NONE;
+        }
+        return DirectionLookup.Table[TTopology::bOffsetRows ? (RowA & 1) : 0][DRow + 1][DCol + 1];
+    }
+
+    bool IsOpen(int32 Index, int32 Dir) const { return (WallMasks[Index] & (1 << Dir)) == 0; }
+    uint8 GetOpenMask(int32 Index) const { return ~WallMasks[Index] & AllWalls; }
+    int32 CountOpenings(int32 Index) const { return static_cast<int32>(FMath::CountBits(GetOpenMask(Index))); }
+
+    FNeighborRange OpenNeighbors(int32 Index) const
+    {
+        return FNeighborRange{ Index, IndexDelta[GetRowParity(Index)], GetOpenMask(Index) };
+    }
+
+    // Only valid when the passage is open (or the neighbor is known to be in bounds)
+    int32 GetNeighborIndex(int32 Index, int32 Dir) const { return Index + IndexDelta[GetRowParity(Index)][Dir]; }
+
+    int32 GetManhattanDistance(int32 A, int32 B) const
+    {
+        return FMath::Abs(GetRow(A) - GetRow(B)) + FMath::Abs(GetCol(A) - GetCol(B));
+    }
+
+    // Fewest steps between the cells on an open grid of this topology (admissible A* heuristic)
+    int32 GetDistance(int32 A, int32 B) const
+    {
+        return TTopology::Distance(GetRow(A), GetCol(A), GetRow(B), GetCol(B));
+    }
+};
+
+template <typename TTopology>
+void TMazeGrid<TTopology>::Init(int32 InRows, int32 InCols)
+{
+    Rows = FMath::Max(0, InRows);
+    Cols = FMath::Max(0, InCols);
+
+    WallMasks.Reset();
+    WallMasks.SetNumUninitialized(Rows * Cols);
+    FMemory::Memset(WallMasks.GetData(), AllWalls, WallMasks.Num());
+
+    for (int32 Parity = 0; Parity < 2; Parity++)
+    {
+        for (int32 Dir = 0; Dir < NumDirections; Dir++)
+        {
+            IndexDelta[Parity][Dir] = TTopology::RowDelta[Dir] * Cols + TTopology::ColDelta[Dir] + Parity * TTopology::OddRowColShift[Dir];
+        }
+    }
+
+    WallVersion++;
+}
+
+template <typename TTopology>
+void TMazeGrid<TTopology>::SetPassage(int32 Index, int32 Dir, bool bOpen)
+{
+    const int32 Row = GetRow(Index);
+    const int32 NeighborRow = GetNeighborRow(Row, Dir);
+    const int32 NeighborCol = GetNeighborCol(Row, GetCol(Index), Dir);
+
+    // Boundary stays closed, the exit opening is handled by the game mode
+    if (!IsValid(NeighborRow, NeighborCol))
+    {
+        return;
+    }
+
+    const int32 NeighborIndex = ToIndex(NeighborRow, NeighborCol);
+    const uint8 Bit = 1 << Dir;
+    const uint8 OppositeBit = 1 << Opposite(Dir);
+
+    const bool bWasOpen = (WallMasks[Index] & Bit) == 0;
+    if (bWasOpen == bOpen)
+    {
+        return;
+    }
+
+    if (bOpen)
+    {
+        WallMasks[Index] &= ~Bit;
+        WallMasks[NeighborIndex] &= ~OppositeBit;
+    }
+    else
+    {
+        WallMasks[Index] |= Bit;
+        WallMasks[NeighborIndex] |= OppositeBit;
+    }
+
+    WallVersion++;
+}
+
+/**
+ * The game's grid: square cells, bit N = EMazeDirection N (North=0, East=1, South=2, West=3).
+ * A struct rather than an alias so the pathfinding headers can keep forward declaring it.
+ */
+struct FMazeGrid : public TMazeGrid<FMazeSquareTopology>
+{
+};
+
+using FMazeOctileGrid = TMazeGrid<FMazeOctileTopology>;
+using FMazeHexGrid = TMazeGrid<FMazeHexTopology>;
@@ -0,0 +1,73 @@
+// MazeGridMovementComponent.h
+// Kinematic movement along precomputed waypoints for actors that only ever walk the maze floor.
+// No floor sweeps, step-ups or capsule collision: the owner walks the waypoint polyline at its walking
+// speed, the wall grid keeps it in the corridor and the transform is set once per tick.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "MazeGridMovementComponent.generated.h"
+
+class AMazeManager;
+
+UCLASS(ClassGroup = (Movement), meta = (BlueprintSpawnableComponent))
+class MAZERUNNER_API UMazeGridMovementComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMazeGridMovementComponent();
+
+    // Needed for the wall clamping, without it the waypoints are followed unchecked
+    void SetMazeManager(AMazeManager* InMazeManager) { MazeManager = InMazeManager; }
+
+    // Replaces the waypoints (world positions, Z is ignored) and starts at the first one
+    void SetWaypoints(const TArray<FVector>& InWaypoints);
+    void ClearWaypoints();
+
+    // Index of the waypoint being walked to, GetNumWaypoints() once the last one is reached
+    int32 GetWaypointIndex() const { return WaypointIndex; }
+    int32 GetNumWaypoints() const { return Waypoints.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Grid Movement")
+    FVector GetMoveVelocity() const { return FVector(Velocity.X, Velocity.Y, 0.0f); }
+
+    // The owner's character movement MaxWalkSpeed when it has one, so everything that scales that
+    // (speed boosts, Blood Moon) scales this too; MaxSpeed otherwise
+    UFUNCTION(BlueprintPure, Category = "Grid Movement")
+    float GetMaxSpeed() const;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Movement", meta = (ClampMin = "0.0"))
+    float MaxSpeed = 300.0f;
+
+    // Speed gained per second from standing, turns at a waypoint keep the current speed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Movement", meta = (ClampMin = "0.0"))
+    float MaxAcceleration = 2000.0f;
+
+    // Yaw degrees per second towards the walking direction
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Movement", meta = (ClampMin = "0.0"))
+    float RotationRate = 540.0f;
+
+    // How far a wall face can reach into a cell (walls are 150 thick and sit on either side of the edge)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Movement", meta = (ClampMin = "0.0"))
+    float WallInset = 150.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Movement", meta = (ClampMin = "0.0"))
+    float BodyRadius = 50.0f;
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+    // Hands the velocity to whatever the animation reads it from
+    void PublishVelocity() const;
+
+    UPROPERTY()
+    AMazeManager* MazeManager;
+
+    TArray<FVector2D> Waypoints;
+    int32 WaypointIndex;
+
+    FVector2D Velocity;
+    float CurrentSpeed;
+};
@@ -0,0 +1,84 @@
+// MazeJunctionGraph.h
+// Corridor-collapsed graph for hierarchical pathfinding.
+// Cells with exactly two openings are folded into weighted edges between junctions and
+// dead ends, so a search only expands junctions and refines the corridors it actually uses.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+class MAZERUNNER_API FMazeJunctionGraph
+{
+public:
+    FMazeJunctionGraph();
+
+    // Full rebuild (after generation / regeneration)
+    void Build(const FMazeGrid& Grid);
+
+    // Incremental repair after the walls around ChangedCells were modified.
+    // Only the corridors touching those cells are re-traced.
+    void UpdateCells(const FMazeGrid& Grid, TArrayView<const int32> ChangedCells);
+
+    // Junction-level A*, then refines the corridors on the result into a cell path (Start..Goal)
+    bool FindPath(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath);
+
+    bool IsBuilt() const { return NodeFlags.Num() > 0; }
+    int32 GetNumNodes() const { return NumNodes; }
+    int32 GetNumEdges() const { return Edges.Num() - FreeEdges.Num(); }
+
+    // Stats from the last FindPath call
+    int32 GetLastNodesExpanded() const { return LastNodesExpanded; }
+
+private:
+    struct FCorridorEdge
+    {
+        int32 NodeA = INDEX_NONE;
+        int32 NodeB = INDEX_NONE;
+        uint8 DirA = 0;       // Direction leaving NodeA
+        uint8 DirB = 0;       // Direction leaving NodeB
+        bool bAlive = false;
+        TArray<int32> Cells;  // Corridor cells ordered from NodeA to NodeB (endpoints excluded)
+
+        int32 Length() const { return Cells.Num() + 1; }
+    };
+
+    struct FOpenEntry
+    {
+        int32 F;
+        int32 G;
+        int32 Node;
+
+        bool operator<(const FOpenEntry& Other) const { return F < Other.F || (F == Other.F && G > Other.G); }
+    };
+
+    bool IsNode(int32 Index) const { return NodeFlags[Index] != 0; }
+    void SetNode(int32 Index, bool bNode);
+    int32 AllocateEdge();
+    void KillEdge(int32 EdgeId);
+    void TraceEdge(const FMazeGrid& Grid, int32 Node, int32 Dir);
+    void TraceAllFrom(const FMazeGrid& Grid, int32 Node);
+
+    // Appends the corridor cells of an edge walked away from FromNode (endpoint not included)
+    void AppendCorridor(const FCorridorEdge& Edge, int32 FromNode, TArray<int32>& OutPath) const;
+
+    TArray<FCorridorEdge> Edges;
+    TArray<int32> FreeEdges;
+
+    TArray<uint8> NodeFlags;   // Per cell
+    TArray<int32> NodeEdges;   // Per cell * 4, edge leaving a node in each direction
+    TArray<int32> CellEdge;    // Per corridor cell, owning edge
+    TArray<int32> CellOffset;  // Per corridor cell, steps from the edge's NodeA
+    int32 NumNodes;
+
+    // Search scratch, stamped so a query never clears the whole grid
+    TArray<uint32> SearchStamp;
+    TArray<int32> SearchCost;
+    TArray<int32> ParentNode;
+    TArray<int32> ParentEdge;
+    TArray<FOpenEntry> OpenHeap;
+    TArray<int32> NodeChainScratch;
+    uint32 CurrentStamp;
+    int32 LastNodesExpanded;
+};
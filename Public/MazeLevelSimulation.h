@@ -0,0 +1,184 @@
+// MazeLevelSimulation.h
+// Headless play-through of a level for balancing FLevelConfig values without playing the game.
+// The maze, a bot player, the monsters, mud, trap cells and the timer run on the packed grid with a
+// fixed time step: agents walk from cell center to cell center at their world speed, so there is no
+// rendering, physics or navmesh and a whole level takes well under a millisecond.
+// FMazeLevelSimulationSweep runs a Monte Carlo sweep over MonsterSpeed, MonsterSpawnDelay, TimeLimit
+// and the star thresholds on every core and reports win rate, time-to-catch and star distributions
+// per level.
+// Run it from the UMazeLevelSimulationCommandlet or the SimulateLevels console command; results
+// go to a CSV under Saved/Balance.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MazeGrid.h"
+
+struct FLevelConfig;
+
+// Game rules the simulation mirrors (AMazeGameMode, AMonsterAI, AMuddyPatch, ATrapCell)
+struct MAZERUNNER_API FMazeSimSettings
+{
+    // Simulated seconds per step. A tenth of a second moves the player 60 units against a 250 unit
+    // catch radius, so no catch is stepped over.
+    float TimeStep = 0.1f;
+
+    float CellSize = 500.0f;
+    float PlayerSpeed = 600.0f;
+    float CatchDistance = 250.0f;
+
+    float MudSpeedScale = 0.3f;
+    float MudDuration = 10.0f;
+    float TrapDuration = 5.0f;
+
+    // First monster x1.5 in the last 30 seconds, every monster x1.5 in aggressive mode
+    float FinalBoostTime = 30.0f;
+    float BoostSpeedScale = 1.5f;
+
+    // Walking distances the spawns keep
+    int32 MinPlayerExitCells = 7;
+    int32 MinMonsterPlayerCells = 5;
+    int32 MinStarPlayerCells = 3;
+
+    // Straight-line cells the bot sees the exit and the golden star from
+    int32 PlayerSightRange = 4;
+
+    // True: the bot walks the shortest path to the exit from the start (best case). False: it explores
+    // depth first like a player without a map until it sees the exit or picks up the golden star.
+    bool bPlayerKnowsExit = false;
+};
+
+struct MAZERUNNER_API FMazeSimResult
+{
+    bool bEscaped = false;
+    bool bCaught = false;
+
+    // Time of the escape, the catch or the time-out
+    float Time = 0.0f;
+
+    // CalculateStarRating of the escape time, 0 when the level was lost
+    int32 Stars = 0;
+
+    int32 CellsWalked = 0;
+};
+
+class MAZERUNNER_API FMazeLevelSimulation
+{
+public:
+    FMazeLevelSimulation();
+
+    // One play-through of Config, deterministic for a seed (maze, spawns and bot choices)
+    FMazeSimResult Run(const FLevelConfig& Config, const FMazeSimSettings& Settings, int32 Seed);
+
+    // Same thresholds as ALevelProgressionManager::CalculateStarRating
+    static int32 CalculateStars(const FLevelConfig& Config, float CompletionTime);
+
+private:
+    // An agent walks from Cell towards Next; Progress is the fraction of the passage behind it
+    struct FAgent
+    {
+        int32 Cell = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+        float Progress = 0.0f;
+        float Speed = 0.0f;
+    };
+
+    void ComputeDistances(int32 SourceIndex, TArray<int32>& OutDistances);
+
+    // Open neighbor one step down a distance field, INDEX_NONE at the bottom
+    int32 GetDownhillNeighbor(int32 CellIndex, const TArray<int32>& Distances) const;
+
+    // Random cell with at least MinCells walking cells from a distance field's source, the last
+    // candidate after 100 attempts (like the game's spawn loops)
+    int32 PickSpawnCell(FRandomStream& Random, const TArray<int32>& Distances, int32 MinCells, int32 ExcludeIndex) const;
+
+    // Where the bot heads from its cell
+    int32 ChoosePlayerStep(FRandomStream& Random, const FMazeSimSettings& Settings, int32 Cell);
+
+    // Agent position in world units
+    FVector2D GetPosition(const FAgent& Agent, float CellSize) const;
+
+    FMazeGrid Grid;
+    int32 ExitIndex;
+    int32 StarIndex;
+
+    TArray<int32> ExitDistances;
+    TArray<int32> StarDistances;
+    TArray<int32> PlayerDistances;      // Towards the player's cell, what the monsters chase down
+
+    // Bot memory
+    TArray<uint8> Visited;
+    TArray<int32> ExploreStack;
+    TArray<int32> VisibleCells;
+    bool bExitKnown;
+    bool bStarSeen;
+
+    // Per-cell hazards
+    TArray<uint8> MudCells;
+    TArray<uint8> TrapCells;            // 1 = armed, 0 = none or already sprung
+
+    TArray<int32> Queue;                // BFS scratch
+};
+
+// ==================== MONTE CARLO SWEEP ====================
+
+struct MAZERUNNER_API FMazeSimSweepSettings
+{
+    // Play-throughs per (level, parameter) point
+    int32 RunsPerPoint = 200;
+    int32 Seed = 1337;
+
+    // Levels to sweep, empty = all
+    TArray<int32> Levels;
+
+    // Multipliers on the level's own values; every combination is one sweep point
+    TArray<float> MonsterSpeedScales = { 0.8f, 1.0f, 1.2f };
+    TArray<float> SpawnDelayScales = { 0.5f, 1.0f, 1.5f };
+    TArray<float> TimeLimitScales = { 0.8f, 1.0f, 1.2f };
+
+    // Scale all three star times together. They only grade the escape time, so every scale re-grades
+    // the same play-throughs instead of simulating them again.
+    TArray<float> StarTimeScales = { 0.8f, 1.0f, 1.2f };
+
+    FMazeSimSettings Sim;
+};
+
+// One (level, parameter) point of the report
+struct MAZERUNNER_API FMazeSimSweepRow
+{
+    int32 Level = 0;
+    float MonsterSpeed = 0.0f;
+    float MonsterSpawnDelay = 0.0f;
+    float TimeLimit = 0.0f;
+    float ThreeStarTime = 0.0f;
+    float TwoStarTime = 0.0f;
+    float OneStarTime = 0.0f;
+    int32 Runs = 0;
+
+    float WinRate = 0.0f;
+    float CatchRate = 0.0f;
+    float TimeoutRate = 0.0f;
+    float MeanEscapeTime = 0.0f;
+
+    // Time-to-catch percentiles over the caught runs, 0 when nobody was caught
+    float CatchP10 = 0.0f;
+    float CatchP50 = 0.0f;
+    float CatchP90 = 0.0f;
+
+    // Runs per star rating, [0] = lost or too slow for one star
+    int32 StarCounts[4] = { 0, 0, 0, 0 };
+};
+
+struct MAZERUNNER_API FMazeLevelSimulationSweep
+{
+    // Runs every point of the sweep across the task graph. Returns simulated seconds per wall-clock
+    // second (the speed-up over real time).
+    static double Run(const TArray<FLevelConfig>& LevelConfigs, const FMazeSimSweepSettings& Settings, TArray<FMazeSimSweepRow>& OutRows);
+
+    static FString ToCsv(const TArray<FMazeSimSweepRow>& Rows);
+
+    // Saved/Balance/LevelSweep-<timestamp>.csv
+    static FString GetDefaultCsvPath();
+
+    static bool WriteCsv(const TArray<FMazeSimSweepRow>& Rows, const FString& Path);
+};
@@ -0,0 +1,20 @@
+// MazeLevelSimulationCommandlet.h
+// Runs the Monte Carlo level balancing sweep without a renderer or a world:
+//   UnrealEditor-Cmd MazeRunner.uproject -run=MazeLevelSimulation [-csv=Path] [-runs=N] [-seed=N] [-level=N] [-knowsexit]
+// -level limits the sweep to one level, -knowsexit makes the bot walk straight to the exit.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MazeLevelSimulationCommandlet.generated.h"
+
+UCLASS()
+class MAZERUNNER_API UMazeLevelSimulationCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMazeLevelSimulationCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
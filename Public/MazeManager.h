@@ -4,8 +4,24 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "MazeCell.h"
+#include "CustomQueue.h"
+#include "MazeGrid.h"
+#include "MazeJunctionGraph.h"
+#include "MazeBitboard.h"
+#include "MazePathRequestQueue.h"
+#include "MazePathCache.h"
+#include "MazeDialSearch.h"
+#include "MazePerception.h"
+#include "MazeBeliefMap.h"
+#include "MazeChokepoints.h"
+#include "MazeCooperativePathfinder.h"
 #include "MazeManager.generated.h"
 
+class FMazeSimulationClock;
+
+// Up to four neighbors held inline, gathering them never touches the heap
+using FMazeCellNeighbors = TArray<AMazeCell*, TFixedAllocator<FMazeGrid::NumDirections>>;
+
 UCLASS()
 class MAZERUNNER_API AMazeManager : public AActor
 {
@@ -18,6 +34,8 @@ protected:
     virtual void BeginPlay() override;
 
 public:    
+    virtual void Tick(float DeltaTime) override;
+    
     // Configuration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Generation")
     TSubclassOf<class AMazeCell> MazeCellClass;
@@ -53,6 +71,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Maze Generation")
     void GenerateMaze(AMazeCell* PreservedCell = nullptr);
     
+    // Spawns one cell per grid cell with the walls of an existing packed grid (no exit, no mud).
+    // Lets headless benchmarks run the cell-actor searches on a seeded maze.
+    void BuildFromGrid(const FMazeGrid& Source);
+    
     void InitializeMaze(AMazeCell* PreservedCell = nullptr);
     void GenerateWithDFS();
     void DFSRecursive(AMazeCell* Current);
@@ -69,9 +91,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
     TArray<AMazeCell*> FindPathAStar(AMazeCell* Start, AMazeCell* Goal);
     
+    // Junction-level search over the corridor graph, only the corridors on the route are expanded
+    UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
+    TArray<AMazeCell*> FindPathHierarchical(AMazeCell* Start, AMazeCell* Goal);
+    
     UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
     TArray<AMazeCell*> GetNeighbors(AMazeCell* Cell, bool bIgnoreWalls = false) const;
     
+    // Allocation-free GetNeighbors for native hot loops
+    void GatherNeighbors(AMazeCell* Cell, FMazeCellNeighbors& OutNeighbors, bool bIgnoreWalls = false) const;
+    
     UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
     AMazeCell* GetNeighborInDirection(AMazeCell* Cell, EMazeDirection Direction) const;
     
@@ -81,6 +110,192 @@ public:
     // A* helper
     float CalculateHeuristic(AMazeCell* From, AMazeCell* To) const;
     
+    // ==================== NAVIGATION GRID ====================
+    
+    // Packed copy of the walls shared by the pathfinding layers (kept in sync with the cell actors)
+    FMazeGrid NavGrid;
+    
+    // Full rebuild of NavGrid and the junction graph (end of generation)
+    void RebuildNavigationGrid();
+    
+    // Called by a cell whenever its walls change after generation
+    void NotifyCellWallsChanged(AMazeCell* Cell);
+    
+    // Spawn (or adopt) an AMazeNavigationData and keep it in sync with NavGrid, so AI controllers
+    // can MoveTo through the maze without a NavMesh
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding")
+    bool bProvideNavigationData = true;
+    
+    UFUNCTION(BlueprintPure, Category = "Maze Pathfinding")
+    class AMazeNavigationData* GetNavigationData() const { return NavigationData; }
+    
+    UFUNCTION(BlueprintPure, Category = "Maze Pathfinding")
+    int32 GetWallVersion() const { return static_cast<int32>(NavGrid.WallVersion); }
+    
+    int32 GetCellIndex(const AMazeCell* Cell) const;
+    AMazeCell* GetCellByIndex(int32 Index) const;
+    
+    // Cell under a world location (nullptr outside the maze)
+    AMazeCell* GetCellAtLocation(const FVector& Location) const;
+    
+    // ==================== DISTANCE FIELDS ====================
+    
+    // Walking distance (in cells) from Source to every cell, indexed like NavGrid (-1 = unreachable)
+    void ComputeDistanceField(AMazeCell* Source, TArray<int32>& OutDistances);
+    
+    // Distance fields from many cells at once (one shared multi-source walk per 64 sources)
+    void ComputeDistancePlanes(const TArray<AMazeCell*>& Sources, FMazeDistancePlanes& OutPlanes);
+    
+    // Distance field from the exit, cached until the walls or the exit change
+    const TArray<int32>& GetExitDistanceField();
+    
+    // True when the cached exit field is still valid (reading it costs no search)
+    bool HasExitDistanceField() const;
+    
+    // Distance field from the player's cell, shared by every monster that asks in the same frame:
+    // recomputed only when the player changes cell or the walls change
+    const TArray<int32>& GetPlayerDistanceField(AMazeCell* PlayerCell);
+    
+    // ==================== PERCEPTION ====================
+    
+    // Straight-line distance (cells) over which monsters see the player through open corridors
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0", ClampMax = "50"))
+    int32 SightRangeCells = 8;
+    
+    // Walking distance (cells) over which monsters hear the player
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0", ClampMax = "50"))
+    int32 HearingRangeCells = 4;
+    
+    // What every cell can see and hear of the player, shared by all monsters: rebuilt only when the
+    // player changes cell, the walls change or the ranges are edited
+    const FMazePerception& GetPlayerPerception(AMazeCell* PlayerCell);
+    
+    // Diffusion steps per second of the shared belief of where the player is
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0.0", ClampMax = "60.0"))
+    float BeliefStepsPerSecond = 4.0f;
+    
+    // Fraction of a cell's probability that moves through each open passage per step
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0.0", ClampMax = "0.25"))
+    float BeliefDiffusionRate = 0.2f;
+    
+    // Shared belief of where the player is, fed by the monsters: one that senses the player collapses
+    // it onto the player's cell, the others empty the cells they can see. Spread and renormalized in Tick.
+    void ReportPlayerSensed(AMazeCell* PlayerCell);
+    void ReportCellsSeen(TArrayView<const int32> CellIndices);
+    
+    // Cell index with the highest belief, INDEX_NONE before any monster reported
+    int32 GetMostLikelyPlayerCellIndex() const;
+    float GetPlayerBelief(int32 CellIndex) const { return PlayerBelief.GetProbability(CellIndex); }
+    
+    // ==================== CHOKEPOINTS ====================
+    
+    // Articulation cells and bridges with respect to the exit, analysed after generation and again
+    // lazily once the walls or the exit change
+    const FMazeChokepoints& GetChokepoints();
+    
+    // The cell every route from PlayerCell to the exit passes through last (nearest the exit), so the one
+    // a monster is most likely to reach first. nullptr once the player has two separate ways out.
+    UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
+    AMazeCell* GetAmbushCell(AMazeCell* PlayerCell);
+    
+    // ==================== COOPERATIVE PATHFINDING ====================
+    
+    // Steps the monsters plan around each other's reservations, the rest of a path follows the player
+    // distance field. Longer windows see conflicts earlier but cost more per plan.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "1", ClampMax = "64"))
+    int32 CooperativeWindowSteps = 8;
+    
+    // Game time of one reservation step, about the time a monster needs to cross a cell
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "0.05"))
+    float ReservationStepSeconds = 0.8f;
+    
+    // Extra cost of a cell another monster passes during the window (0 = only avoid collisions)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "0", ClampMax = "16"))
+    int32 CooperativeCrowdPenalty = 2;
+    
+    // Monsters that plan through the shared reservation table (register while chasing)
+    void RegisterCooperativeAgent(const UObject* Agent);
+    void UnregisterCooperativeAgent(const UObject* Agent);
+    int32 GetNumCooperativeAgents() const { return Reservations.GetNumAgents(); }
+    
+    // Drops the agent's reservations (it stopped following its cooperative plan)
+    void ReleaseCooperativePath(const UObject* Agent);
+    
+    // Current reservation step, plans start here
+    int32 GetReservationStep() const;
+    
+    // Reservation steps follow the game mode's fixed-step clock; nullptr = world time
+    void SetSimulationClock(const FMazeSimulationClock* InClock) { SimulationClock = InClock; }
+    
+    // Windowed cooperative path from Start to the player's cell (Start..PlayerCell). The plan replaces
+    // the agent's previous reservations; false when the player cannot be reached or the agent is boxed in.
+    bool FindCooperativePath(const UObject* Agent, AMazeCell* Start, AMazeCell* PlayerCell, TArray<AMazeCell*>& OutPath);
+    
+    // Walking distance between two cells (-1 = not connected)
+    UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
+    int32 GetPathDistance(AMazeCell* From, AMazeCell* To);
+    
+    // Shortest path to the exit, read straight off the cached exit distance field
+    UFUNCTION(BlueprintCallable, Category = "Maze Pathfinding")
+    TArray<AMazeCell*> FindPathToExit(AMazeCell* Start);
+    
+    // ==================== PATH REQUEST QUEUE ====================
+    
+    // Time spent on queued path requests per frame, unfinished searches resume next frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "10.0", ClampMax = "5000.0"))
+    float PathBudgetMicroseconds = 250.0f;
+    
+    // On the simulation clock the queue is budgeted in cells per simulated step instead, so paths
+    // arrive on the same step at any frame rate and on any machine
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "1"))
+    int32 PathExpansionsPerStep = 256;
+    
+    // Up to this many junction nodes, RequestPath answers through the junction graph right away
+    // instead of queueing. Bigger mazes go through the budgeted queue.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Pathfinding", meta = (ClampMin = "0"))
+    int32 MaxImmediateJunctionNodes = 2048;
+    
+    // Answers from the path cache or the junction graph when it can, otherwise queues the request.
+    // Queued requests towards the same goal share one search, a newer request from the same
+    // Requester replaces the pending one.
+    // OnReady gets Start..Goal, or an empty array when the goal cannot be reached.
+    void RequestPath(const UObject* Requester, AMazeCell* Start, AMazeCell* Goal, EMazePathPriority Priority,
+                     TFunction<void(const TArray<AMazeCell*>&)> OnReady);
+    
+    // Drops the pending request of Requester (call when it goes away)
+    void CancelPathRequest(const UObject* Requester);
+    
+    const FMazePathQueueStats& GetPathQueueStats() const { return PathRequests.GetStats(); }
+    
+    UFUNCTION(BlueprintPure, Category = "Maze Pathfinding")
+    int32 GetPathQueueDepth() const { return PathRequests.GetNumPending(); }
+    
+    // (start, goal) answers reused until the next wall change
+    const FMazePathCacheStats& GetPathCacheStats() const { return PathCache.GetStats(); }
+    
+    UFUNCTION(BlueprintPure, Category = "Maze Pathfinding")
+    int32 GetPathCacheHits() const { return PathCache.GetStats().Hits; }
+    
+    UFUNCTION(BlueprintPure, Category = "Maze Pathfinding")
+    int32 GetPathCacheMisses() const { return PathCache.GetStats().Misses; }
+    
+    // ==================== TERRAIN COSTS ====================
+    
+    // Hazards flag the cell under them while they exist (several hazards may share a cell).
+    // Keyed by location rather than cell actor, regenerating the maze respawns the cells.
+    void AddTerrain(const FVector& Location, EMazeTerrain Terrain);
+    void RemoveTerrain(const FVector& Location, EMazeTerrain Terrain);
+    EMazeTerrain GetCellTerrain(const AMazeCell* Cell) const;
+    
+    // True when any cell carries one of the flags
+    bool HasTerrain(EMazeTerrain Terrain) const;
+    
+    // Bumped whenever a terrain flag changes
+    uint32 GetTerrainVersion() const { return TerrainVersion; }
+    
+    // Cheapest path for an agent with the given cost profile (Dial's bucket queue over the terrain plane)
+    TArray<AMazeCell*> FindPathWeighted(AMazeCell* Start, AMazeCell* Goal, const FMazeCostProfile& Profile);
+    
     // Utility
     UFUNCTION(BlueprintCallable, Category = "Maze Utility")
     AMazeCell* GetCell(int32 Row, int32 Col) const;
@@ -94,22 +309,68 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Maze Utility")
     AMazeCell* GetEscapeCell() const;
     
-    // Settings
+    // Settings (the menus stay within 30x30, the stress test goes larger)
     UFUNCTION(BlueprintCallable, Category = "Maze Settings")
-    void SetMazeSize(int32 NewRows, int32 NewCols);
+    void SetMazeSize(int32 NewRows, int32 NewCols, int32 MaxSize = 30);
 
 private:
     // Helper functions
-    struct FDirectionInfo
-    {
-        EMazeDirection Dir;
-        int32 RowDelta;
-        int32 ColDelta;
-    };
-    
-    static const FDirectionInfo* GetAllDirections();
     static EMazeDirection GetOppositeDirection(EMazeDirection Dir);
     bool IsValidCell(int32 Row, int32 Col) const;
     void RemoveOuterWall(AMazeCell* Cell);
-    TArray<AMazeCell*> GetUnvisitedNeighbors(AMazeCell* Cell) const;
+    void GatherUnvisitedNeighbors(AMazeCell* Cell, FMazeCellNeighbors& OutNeighbors) const;
+    void BuildPathFromParents(AMazeCell* Goal, TArray<AMazeCell*>& OutPath) const;
+    
+    // Search scratch reused by FindPathBFS / FindPathAStar
+    CustomQueue<AMazeCell*> SearchQueue;
+    TArray<AMazeCell*> OpenSetScratch;
+    void RefreshCellPassages(AMazeCell* Cell);
+    
+    UPROPERTY()
+    class AMazeNavigationData* NavigationData;
+    void EnsureNavigationData();
+    
+    // Corridor-collapsed graph, repaired incrementally from NotifyCellWallsChanged
+    FMazeJunctionGraph JunctionGraph;
+    
+    // Row bitboards for distance fields, rebuilt lazily when the wall version moves on
+    FMazeBitboard Bitboard;
+    void EnsureBitboard();
+    
+    FMazePathRequestQueue PathRequests;
+    
+    // Path and distance answers for FindPathHierarchical, RequestPath and GetPathDistance
+    FMazePathCache PathCache;
+    
+    TArray<int32> ExitDistances;
+    uint32 ExitDistancesVersion = 0;
+    int32 ExitDistancesSource = INDEX_NONE;
+    
+    TArray<int32> PlayerDistances;
+    uint32 PlayerDistancesVersion = 0;
+    int32 PlayerDistancesSource = INDEX_NONE;
+    
+    FMazePerception PlayerPerception;
+    
+    FMazeChokepoints Chokepoints;
+    
+    FMazeReservationTable Reservations;
+    FMazeCooperativePathfinder CooperativeSearch;
+    const FMazeSimulationClock* SimulationClock;
+    int64 PathQueueStep = 0;  // Clock step the path queue has been processed up to
+    TArray<int32> CooperativeCells;
+    
+    FMazeBeliefMap PlayerBelief;
+    float BeliefStepAccumulator = 0.0f;
+    void UpdatePlayerBelief(float DeltaTime);
+    
+    // Terrain plane (EMazeTerrain per cell), kept across wall regenerations since hazards stay put.
+    // Counts are per cell and terrain type so overlapping hazards clear their flag only when the last one goes.
+    TArray<uint8> TerrainFlags;
+    TArray<uint8> TerrainCounts;
+    int32 TerrainTotals[FMazeCostProfile::NumTerrainTypes] = {};
+    uint32 TerrainVersion = 0;
+    FMazeDialSearch WeightedSearch;
+    void EnsureTerrainPlane();
+    int32 GetTerrainIndex(const FVector& Location) const;
 };
@@ -0,0 +1,106 @@
+// MazeNavigationData.h
+// Navigation data built straight from the maze wall grid.
+// Registers with the navigation system like a NavMesh, so AAIController::MoveTo and the path
+// following component work in the maze without generating a NavMesh. The walls are a copy of
+// AMazeManager::NavGrid: copied whole after generation, patched cell by cell when traps move walls.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavigationData.h"
+#include "MazeGrid.h"
+#include "MazeDialSearch.h"
+#include "MazePathSmoother.h"
+#include "MazeNavigationData.generated.h"
+
+/**
+ * Node refs are cell indices (Row * Cols + Col). Paths are cell searches on the packed grid,
+ * string-pulled into the few points the path following component has to steer through.
+ * Spawned and kept in sync by AMazeManager; can also be set as the NavDataClass of a
+ * supported agent in the project's navigation settings.
+ */
+UCLASS(notplaceable)
+class MAZERUNNER_API AMazeNavigationData : public ANavigationData
+{
+    GENERATED_BODY()
+
+public:
+    AMazeNavigationData(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    // Kept between the agent's radius and the wall faces on the straight path segments
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Maze Navigation", meta = (ClampMin = "0.0"))
+    float WallClearance = 150.0f;
+
+    // Full copy of the walls (end of generation)
+    void BuildFromGrid(const FMazeGrid& Source, float InCellSize, float InFloorZ);
+
+    // Copies the walls of the changed cells and the neighbors sharing them, then invalidates the
+    // active paths that run over them so their followers repath
+    void UpdateCells(const FMazeGrid& Source, TArrayView<const int32> ChangedCells);
+
+    bool IsBuilt() const { return CellSize > 0.0f && Grid.Num() > 0; }
+    // Reads the grid: queries that can run off the game thread take SearchLock first
+    int32 GetCellIndexAt(const FVector& Location) const;
+    FVector GetCellCenter(int32 Index) const;
+
+    // ANavigationData interface
+    virtual FBox GetBounds() const override;
+    virtual FNavLocation GetRandomPoint(FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual bool GetRandomReachablePointInRadius(const FVector& Origin, float Radius, FNavLocation& OutResult,
+                                                 FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual bool GetRandomPointInNavigableRadius(const FVector& Origin, float Radius, FNavLocation& OutResult,
+                                                 FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual bool ProjectPoint(const FVector& Point, FNavLocation& OutLocation, const FVector& Extent,
+                              FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual void BatchProjectPoints(TArray<FNavigationProjectionWork>& Workload, const FVector& Extent,
+                                    FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual void BatchProjectPoints(TArray<FNavigationProjectionWork>& Workload,
+                                    FSharedConstNavQueryFilter Filter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual void BatchRaycast(TArray<FNavigationRaycastWork>& Workload, FSharedConstNavQueryFilter QueryFilter,
+                              const UObject* Querier = nullptr) const override;
+    virtual ENavigationQueryResult::Type CalcPathCost(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathCost,
+                                                      FSharedConstNavQueryFilter QueryFilter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual ENavigationQueryResult::Type CalcPathLength(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength,
+                                                        FSharedConstNavQueryFilter QueryFilter = nullptr, const UObject* Querier = nullptr) const override;
+    virtual ENavigationQueryResult::Type CalcPathLengthAndCost(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength,
+                                                               FVector::FReal& OutPathCost, FSharedConstNavQueryFilter QueryFilter = nullptr,
+                                                               const UObject* Querier = nullptr) const override;
+    virtual bool DoesNodeContainLocation(NavNodeRef NodeRef, const FVector& WorldSpaceLocation) const override;
+
+    // Query implementations handed to the navigation system
+    static FPathFindingResult FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
+    static bool TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
+    static bool Raycast(const ANavigationData* NavDataInstance, const FVector& RayStart, const FVector& RayEnd, FVector& HitLocation,
+                        FSharedConstNavQueryFilter QueryFilter, const UObject* Querier);
+
+private:
+    // Cell path Start..Goal into CellPathScratch (caller holds SearchLock)
+    bool SearchCells(int32 StartIndex, int32 GoalIndex) const;
+
+    // String-pulls CellPathScratch into path points from Start to End (caller holds SearchLock)
+    void BuildPathPoints(const FVector& Start, const FVector& End, float AgentRadius, TArray<FNavPathPoint>& OutPoints) const;
+
+    ENavigationQueryResult::Type MeasurePath(const FVector& PathStart, const FVector& PathEnd, FVector::FReal& OutPathLength) const;
+
+    // First point from RayStart to RayEnd that is not in clear sight, false when the whole ray is
+    bool TraceWalls(const FVector& RayStart, const FVector& RayEnd, FVector& OutHitLocation) const;
+
+    // Marks active paths with a segment over one of the cells as invalid
+    void InvalidatePathsThrough(TArrayView<const int32> Cells);
+
+    FVector2D ToGridSpace(const FVector& Location) const { return FVector2D(Location.X / CellSize, Location.Y / CellSize); }
+    float GetClearance(float AgentRadius) const { return (FMath::Max(AgentRadius, 0.0f) + WallClearance) / CellSize; }
+
+    FMazeGrid Grid;
+    float CellSize;
+    float FloorZ;
+
+    // Queries can come from the async path finding task while the game thread patches walls
+    mutable FCriticalSection SearchLock;
+    mutable FMazeDialSearch Search;
+    mutable FMazePathSmoother Smoother;
+    mutable TArray<int32> CellPathScratch;
+    mutable TArray<int32> CornerScratch;
+    mutable TArray<int32> CostScratch;
+    mutable TArray<int32> CandidateScratch;
+};
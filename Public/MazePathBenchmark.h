@@ -0,0 +1,70 @@
+// MazePathBenchmark.h
+// Headless pathfinding benchmarks on packed grids (no actors needed, run from the console)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MazeGrid.h"
+
+/**
+ * Counts the heap allocations the calling thread makes while in scope.
+ * A forwarding proxy is put in front of GMalloc for the lifetime of the scope, so this is
+ * for debug commands only - never leave one open across a frame.
+ */
+class MAZERUNNER_API FMazeAllocationScope
+{
+public:
+    FMazeAllocationScope();
+    ~FMazeAllocationScope();
+
+    int32 GetCount() const;
+
+private:
+    class FMalloc* PreviousMalloc;
+    int32 StartCount;
+};
+
+struct MAZERUNNER_API FMazePathBenchmark
+{
+    // Random DFS maze (same algorithm as AMazeManager) written straight into a packed grid.
+    // Instantiated for FMazeGrid, FMazeOctileGrid and FMazeHexGrid.
+    template <typename TGrid>
+    static void GenerateGrid(TGrid& OutGrid, int32 Rows, int32 Cols, float LoopProbability, int32 Seed);
+
+    // Queue-based BFS the way FindPathBFS does it (CustomQueue, open-mask neighbor walk)
+    template <typename TGrid>
+    static void QueueBFS(const TGrid& Grid, int32 SourceIndex, TArray<int32>& OutDistances);
+
+    // Full distance fields on a Size x Size maze: bitboard BFS against the queue-based BFS
+    static FString RunDistanceFieldBenchmark(int32 Size, int32 Iterations, int32 Seed = 1337);
+
+    // NumSources distance fields: one multi-source batch against separate bitboard and queue BFS runs,
+    // for sources spread over the maze and for sources clustered around one cell
+    static FString RunMultiSourceBenchmark(int32 Size, int32 NumSources, int32 Seed = 1337);
+
+    // Terrain-weighted cost fields on a maze with random mud/trap/safe-zone cells:
+    // Dial's bucket queue against a binary-heap Dijkstra
+    static FString RunWeightedBenchmark(int32 Size, int32 Iterations, int32 Seed = 1337);
+
+    // String-pulling of shortest paths between random cells: waypoints kept and time per path
+    static FString RunSmoothingBenchmark(int32 Size, int32 Iterations, int32 Seed = 1337);
+
+    // Player belief map: one diffusion step, and one in-game update (the cells a monster sees
+    // cleared, a step, renormalization, most likely cell)
+    static FString RunBeliefMapBenchmark(int32 Size, int32 Iterations, int32 Seed = 1337);
+
+    // Windowed cooperative planning towards one shared goal, cost per plan from 2 up to MaxAgents agents
+    static FString RunCooperativeBenchmark(int32 Size, int32 MaxAgents, int32 Seed = 1337);
+
+    // Generation and BFS distance fields on square, 8-neighbor and hex mazes of the same size
+    static FString RunTopologyBenchmark(int32 Size, int32 Iterations, int32 Seed = 1337);
+
+    // Runs the warmed-up grid search loops (neighbor walk, junction A*, D* Lite repairs, bitboard
+    // fields, path request queue) under an allocation counter. Every loop must report zero allocations,
+    // generation no more than its up-front buffers.
+    static FString RunAllocationCheck(int32 Size, int32 Seed = 1337);
+
+private:
+    // One source set of RunMultiSourceBenchmark, every plane checked against the queue BFS
+    static FString RunMultiSourceSet(const FMazeGrid& Grid, class FMazeBitboard& Bitboard, const TArray<int32>& Sources);
+};
@@ -0,0 +1,21 @@
+// MazePathBenchmarkCommandlet.h
+// Runs the pathfinding benchmark and correctness suite without a renderer (the cell-actor searches
+// get a transient world of their own):
+//   UnrealEditor-Cmd MazeRunner.uproject -run=MazePathBenchmark [-csv=Path] [-queries=N] [-maxsize=N] [-seed=N]
+// Exits with 1 when any search returns a non-optimal or unwalkable path, so it can gate a build.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MazePathBenchmarkCommandlet.generated.h"
+
+UCLASS()
+class MAZERUNNER_API UMazePathBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UMazePathBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,68 @@
+// MazePathBenchmarkSuite.h
+// Headless latency and correctness suite for the grid path searches.
+// Runs every search over a fixed corpus of seeded mazes (sizes x loop probabilities), checks each
+// answer against the BFS optimum and reports latency percentiles, expansions and allocations.
+// AMazeManager::FindPathBFS / FindPathAStar walk cell actors, so they run on a manager spawned into
+// a transient world of its own (no renderer, nothing ticks, the game world is left alone).
+// Run it from the UMazePathBenchmarkCommandlet or the BenchmarkPathSuite console command; results
+// go to a CSV under Saved/Benchmarks.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct MAZERUNNER_API FMazeBenchmarkSuiteSettings
+{
+    TArray<int32> Sizes = { 10, 32, 64, 128, 256, 512, 1024 };
+    TArray<float> LoopProbabilities = { 0.0f, 0.1f, 0.3f };
+    int32 QueriesPerMaze = 100;
+    int32 Seed = 1337;
+
+    // FindPathBFS / FindPathAStar spawn one actor per cell, above this size only their packed-grid
+    // mirrors run (latency scaling only, not part of the correctness result)
+    int32 MaxCellActorSize = 128;
+
+    // The FindPathAStar mirror scans its open list linearly, above this size it takes minutes
+    int32 MaxLegacyAStarSize = 256;
+};
+
+// One (maze, algorithm) line of the report
+struct MAZERUNNER_API FMazeBenchmarkRow
+{
+    int32 Size = 0;
+    float LoopProbability = 0.0f;
+    int32 Seed = 0;
+    FString Algorithm;
+    int32 Queries = 0;
+
+    // Per-query latency in microseconds
+    double P50 = 0.0;
+    double P90 = 0.0;
+    double P99 = 0.0;
+    double Max = 0.0;
+
+    // 0 for FindPathBFS / FindPathAStar, which do not count their expansions
+    double MeanExpanded = 0.0;
+    double AllocationsPerQuery = 0.0;
+
+    // Answers whose length differs from the BFS optimum, or paths that are not walkable
+    int32 Mismatches = 0;
+
+    // Packed-grid re-implementation of a cell-actor search rather than the shipped code, its
+    // mismatches are reported but left out of the total
+    bool bMirror = false;
+};
+
+struct MAZERUNNER_API FMazePathBenchmarkSuite
+{
+    // Runs the whole corpus, returns the total number of mismatches outside the mirror rows
+    // (0 = every answer optimal)
+    static int32 Run(const FMazeBenchmarkSuiteSettings& Settings, TArray<FMazeBenchmarkRow>& OutRows);
+
+    static FString ToCsv(const TArray<FMazeBenchmarkRow>& Rows);
+
+    // Saved/Benchmarks/PathBenchmark-<timestamp>.csv
+    static FString GetDefaultCsvPath();
+
+    static bool WriteCsv(const TArray<FMazeBenchmarkRow>& Rows, const FString& Path);
+};
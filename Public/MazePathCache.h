@@ -0,0 +1,74 @@
+// MazePathCache.h
+// (start, goal) path and distance cache tagged with the grid's WallVersion.
+// Paths are stored as 2-bit direction codes (4 steps per byte) in one shared pool, so a
+// 100-step path costs 25 bytes. The whole cache is dropped the first time it sees a new
+// wall version, nothing is invalidated while the walls stay put.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+struct MAZERUNNER_API FMazePathCacheStats
+{
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Invalidations = 0;  // Flushes caused by a wall version change
+    int32 Evictions = 0;      // Flushes caused by hitting the size limits
+    int32 Entries = 0;
+    int32 DirectionBytes = 0;
+
+    FString ToString() const;
+};
+
+class MAZERUNNER_API FMazePathCache
+{
+public:
+    static constexpr int32 MaxEntries = 4096;
+    static constexpr int32 MaxDirectionBytes = 256 * 1024;
+
+    FMazePathCache();
+
+    // Start..Goal. A path stored the other way round is returned reversed.
+    bool FindPath(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, TArray<int32>& OutPath);
+
+    // Steps between the cells (-1 = known to be unreachable), from either a path or a distance entry
+    bool FindDistance(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, int32& OutDistance);
+
+    // Path must be a chain of open neighbors, Path[0] = start and Path.Last() = goal
+    void AddPath(const FMazeGrid& Grid, TArrayView<const int32> Path);
+
+    void AddDistance(const FMazeGrid& Grid, int32 StartIndex, int32 GoalIndex, int32 Distance);
+
+    void Reset();
+
+    const FMazePathCacheStats& GetStats() const { return Stats; }
+
+private:
+    struct FEntry
+    {
+        int32 Distance = -1;
+        int32 PoolOffset = INDEX_NONE;  // INDEX_NONE = distance only
+    };
+
+    static uint64 MakeKey(int32 StartIndex, int32 GoalIndex)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(StartIndex)) << 32) | static_cast<uint32>(GoalIndex);
+    }
+
+    // Flushes everything when the grid is not the one the entries were made on
+    void Validate(const FMazeGrid& Grid);
+
+    // Room for one more entry with Bytes of directions, flushes when full
+    void MakeRoom(int32 Bytes);
+
+    void DecodePath(const FMazeGrid& Grid, int32 StartIndex, const FEntry& Entry, TArray<int32>& OutPath) const;
+
+    TMap<uint64, FEntry> Entries;
+    TArray<uint8> DirectionPool;
+
+    uint32 CacheWallVersion;
+    int32 CacheNumCells;
+    FMazePathCacheStats Stats;
+};
@@ -0,0 +1,128 @@
+// MazePathRequestQueue.h
+// Central, time-sliced path request queue.
+// Requests are grouped by goal: every request towards the same goal cell shares one goal-rooted
+// BFS, which is expanded a slice at a time under a per-frame budget and resumed next frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+enum class EMazePathPriority : uint8
+{
+    Low,
+    Normal,
+    High
+};
+
+struct MAZERUNNER_API FMazePathQueueStats
+{
+    int32 QueueDepth = 0;          // Requests still waiting for a path
+    int32 PeakQueueDepth = 0;
+    int32 ActiveSearches = 0;      // Distinct goals being searched
+    int32 TotalRequests = 0;
+    int32 TotalCompleted = 0;
+    int32 TotalCoalesced = 0;      // Requests that joined a search already running for their goal
+    int32 TotalSuperseded = 0;     // Requests dropped unanswered (newer request from the same requester, or cancelled)
+    double AverageLatencyMs = 0.0;
+    double MaxLatencyMs = 0.0;
+    int32 MaxFramesWaited = 0;
+    double LastFrameMicros = 0.0;
+    int32 LastFrameExpansions = 0;
+
+    FString ToString() const;
+};
+
+class MAZERUNNER_API FMazePathRequestQueue
+{
+public:
+    // Path from start to goal as cell indices, empty when not reachable
+    using FOnPathReady = TFunction<void(const TArray<int32>& Path)>;
+
+    FMazePathRequestQueue();
+
+    // Queues a request. A pending request from the same Requester is dropped (superseded).
+    void Enqueue(const void* Requester, int32 StartIndex, int32 GoalIndex, EMazePathPriority Priority, FOnPathReady OnReady);
+
+    // Drops the pending request of Requester without calling it back
+    void Cancel(const void* Requester);
+
+    // Drops everything without calling back
+    void Reset();
+
+    // Expands queued searches until the budget is spent, then calls back every finished request.
+    // At least one slice runs per call so a tiny budget still makes progress.
+    // MaxExpansions > 0 budgets by expanded cells instead of time, so the same requests finish on
+    // the same call on any machine (the simulation clock drives it that way).
+    void Process(const FMazeGrid& Grid, double BudgetMicroseconds, int32 MaxExpansions = 0);
+
+    int32 GetNumPending() const { return Stats.QueueDepth; }
+    const FMazePathQueueStats& GetStats() const { return Stats; }
+
+private:
+    // Expansions between two clock reads
+    static constexpr int32 SliceExpansions = 64;
+
+    // Retired jobs kept for reuse (each holds a per-cell array)
+    static constexpr int32 MaxSpareJobs = 8;
+
+    struct FRequest
+    {
+        const void* Requester = nullptr;
+        int32 StartIndex = INDEX_NONE;
+        EMazePathPriority Priority = EMazePathPriority::Normal;
+        double EnqueueTime = 0.0;
+        uint64 EnqueueFrame = 0;
+        FOnPathReady OnReady;
+    };
+
+    struct FSearchJob
+    {
+        int32 GoalIndex = INDEX_NONE;
+        EMazePathPriority Priority = EMazePathPriority::Low;
+        double OldestEnqueueTime = 0.0;
+        uint32 WallVersion = 0;
+        bool bStarted = false;
+        bool bExhausted = false;
+        TArray<int32> NextStep;  // Per cell, neighbor one step closer to the goal (INDEX_NONE = not reached)
+        TArray<int32> Frontier;
+        int32 FrontierHead = 0;
+        TArray<FRequest> Requests;
+    };
+
+    // Path cells live in FinishedPaths, so finishing a request allocates nothing
+    struct FFinishedRequest
+    {
+        FRequest Request;
+        int32 PathStart = 0;
+        int32 PathLength = 0;
+    };
+
+    void RestartJob(const FMazeGrid& Grid, FSearchJob& Job) const;
+
+    // Expands up to MaxExpansions cells, returns how many were expanded
+    int32 StepJob(const FMazeGrid& Grid, FSearchJob& Job, int32 MaxExpansions) const;
+
+    // Moves every request whose start has been reached (or can never be) into Finished
+    void ResolveRequests(FSearchJob& Job);
+
+    // Removes a job with no requests left, its buffers go to SpareJobs
+    void RetireJob(int32 JobIndex);
+
+    int32 PickNextJob() const;
+    void RecordLatency(const FRequest& Request, double Now);
+
+    TArray<FSearchJob> Jobs;
+
+    // Retired jobs keep their NextStep / Frontier / Requests storage for the next goal
+    TArray<FSearchJob> SpareJobs;
+
+    // Per-frame scratch, Reset() at the start of every Process
+    TArray<FFinishedRequest> Finished;
+    TArray<int32> FinishedPaths;
+    TArray<int32> PathScratch;
+
+    FMazePathQueueStats Stats;
+    uint64 FrameCounter;
+};
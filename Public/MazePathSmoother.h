@@ -0,0 +1,49 @@
+// MazePathSmoother.h
+// String-pulling for cell paths.
+// A cell path zig-zags through cell centers; the smoother keeps only the cells where the path has
+// to turn, so an agent walks straight lines between them. Every kept segment is checked
+// analytically against the packed walls with a clearance radius, no physics traces.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+/**
+ * Works in cell units: the center of cell (Row, Col) is (Row, Col) and a wall lies on the shared
+ * edge half a cell away. Clearance is the agent radius plus the wall thickness, in cells, and is
+ * kept under half a cell so a step between two connected cells is always clear.
+ */
+class MAZERUNNER_API FMazePathSmoother
+{
+public:
+    static constexpr float MaxClearance = 0.45f;
+
+    FMazePathSmoother();
+
+    // Indices into Path of the cells to steer through: the first cell, every turn that cannot be
+    // cut and the last cell. Shortcuts only cross cells of Path itself, so a cost-weighted route
+    // is never traded for a cheaper-looking line through mud or a safe zone.
+    void SmoothPath(const FMazeGrid& Grid, TArrayView<const int32> Path, float Clearance, TArray<int32>& OutCorners);
+
+    // True when a disc of radius Clearance can slide from From to To without touching a wall
+    // (points in cell units, both inside the grid)
+    bool HasLineOfSight(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To, float Clearance) const;
+    bool HasLineOfSight(const FMazeGrid& Grid, int32 FromIndex, int32 ToIndex, float Clearance) const;
+
+    // Cells visited by the segment tests of the last SmoothPath call
+    int32 GetLastCellsVisited() const { return LastCellsVisited; }
+
+private:
+    // Walks the cells under the segment and tests the walls near each of them. With bCorridorOnly
+    // every visited cell must be stamped with CorridorStamp.
+    bool IsSegmentClear(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To, float Clearance,
+                        bool bCorridorOnly) const;
+
+    // Per-cell generation stamps marking the path being smoothed (no clearing between calls)
+    TArray<uint32> CorridorStamps;
+    uint32 CorridorStamp;
+
+    mutable int32 LastCellsVisited;
+};
@@ -0,0 +1,65 @@
+// MazePerception.h
+// What can be perceived of the player from every cell, rebuilt once per player cell change.
+// Sight walks the wall grid from the player's cell center with a DDA ray per cell in range and stops at
+// the first closed edge; hearing is the walking distance through the corridors (sound goes around
+// corners, not through walls). Every monster then reads the flags of its own cell.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+enum class EMazePerception : uint8
+{
+    None  = 0,
+    Seen  = 1 << 0,
+    Heard = 1 << 1
+};
+ENUM_CLASS_FLAGS(EMazePerception);
+
+class MAZERUNNER_API FMazePerception
+{
+public:
+    FMazePerception();
+
+    // Rebuilds the flags around PlayerIndex. PlayerDistances is the walking distance field from the
+    // player's cell (-1 = unreachable), ranges are in cells (sight is a straight-line radius).
+    void Update(const FMazeGrid& Grid, int32 PlayerIndex, const TArray<int32>& PlayerDistances,
+                int32 SightRange, int32 HearingRange);
+
+    // Same player cell, walls and ranges as the last Update
+    bool IsUpToDate(const FMazeGrid& Grid, int32 PlayerIndex, int32 SightRange, int32 HearingRange) const;
+
+    EMazePerception GetPerception(int32 CellIndex) const
+    {
+        return Flags.IsValidIndex(CellIndex) ? static_cast<EMazePerception>(Flags[CellIndex]) : EMazePerception::None;
+    }
+
+    bool CanSense(int32 CellIndex) const { return GetPerception(CellIndex) != EMazePerception::None; }
+
+    int32 GetPlayerIndex() const { return PlayerIndex; }
+
+    // Rays cast by the last Update
+    int32 GetLastRaysCast() const { return LastRaysCast; }
+
+    // True when the segment between two points (cell units, cell (Row, Col) centered at (Row, Col))
+    // crosses no closed edge. Walls are treated as lines: a ray through a grid corner needs all four
+    // edges meeting there open.
+    static bool HasLineOfSight(const FMazeGrid& Grid, const FVector2D& From, const FVector2D& To);
+
+    // Cells in clear line of sight of FromIndex within SightRange (straight-line cells), FromIndex
+    // included. Returns the number of rays cast.
+    static int32 GatherVisibleCells(const FMazeGrid& Grid, int32 FromIndex, int32 SightRange, TArray<int32>& OutCells);
+
+private:
+    // EMazePerception per cell, indexed like the grid
+    TArray<uint8> Flags;
+    TArray<int32> VisibleScratch;
+
+    int32 PlayerIndex;
+    uint32 WallVersion;
+    int32 LastSightRange;
+    int32 LastHearingRange;
+    int32 LastRaysCast;
+};
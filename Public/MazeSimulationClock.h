@@ -0,0 +1,44 @@
+// MazeSimulationClock.h
+// Fixed-step clock for gameplay. Frames add their variable DeltaTime to an accumulator and the
+// simulation runs as many whole steps as fit, so the level timer, monster decisions and level
+// events see the same step sequence at 30 or 144 FPS and a run can be replayed.
+// A frame never runs more than MaxStepsPerFrame steps: after a long hitch the rest is dropped and
+// the game falls behind the wall clock instead of spending the next frames catching up.
+// GetAlpha() is how far the frame is into the next step, for drawing between two simulated states.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class MAZERUNNER_API FMazeSimulationClock
+{
+public:
+    FMazeSimulationClock();
+
+    void Configure(float StepsPerSecond, int32 InMaxStepsPerFrame);
+
+    // Step 0, nothing accumulated
+    void Reset();
+
+    // Adds a frame and returns how many steps of GetStepSeconds() to run for it
+    int32 Advance(float DeltaTime);
+
+    float GetStepSeconds() const { return StepSeconds; }
+
+    // Steps handed out since the reset, and the simulated time they add up to
+    int64 GetStep() const { return Step; }
+    double GetTime() const { return Step * static_cast<double>(StepSeconds); }
+
+    // 0..1 between the last step and the next
+    float GetAlpha() const { return StepSeconds > 0.0f ? Accumulator / StepSeconds : 0.0f; }
+
+    // Seconds thrown away by the per-frame step limit since the reset
+    double GetDroppedSeconds() const { return DroppedSeconds; }
+
+private:
+    float StepSeconds;
+    int32 MaxStepsPerFrame;
+    float Accumulator;
+    int64 Step;
+    double DroppedSeconds;
+};
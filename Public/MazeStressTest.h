@@ -0,0 +1,149 @@
+// MazeStressTest.h
+// Monster stress mode, to find where the game thread runs out of frame before designing larger levels:
+//   UnrealEditor MazeRunner.uproject -game -nullrhi -stresstest [-stressmonsters=N] [-stressmaze=N] [-stresshazards=N]
+// or the RunStressTest console command in a running game. It builds one maze of the requested size
+// with mud and trap cells, then steps a chasing pack through increasing monster counts, once with the
+// modern AI, once with legacy waypoint following and once under the batched monster director.
+// Each step warms up, then samples frames and splits the game-thread time into monster AI,
+// pathfinding, movement, audio and catch (overlap) checks. What is left of the frame is the engine:
+// character movement, physics and, without -nullrhi, waiting on the renderer.
+// The player is moved to a far cell every few seconds so the pack keeps replanning.
+// The scaling curve goes to Saved/Benchmarks/StressTest-<timestamp>.csv, one row per step.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MazeStressTest.generated.h"
+
+class AMazeGameMode;
+class AMazeCell;
+
+enum class EMazeStressAIMode : uint8
+{
+    Modern,     // Own tick, steering on the A* path (bUseModernAI)
+    Legacy,     // Own tick, straight waypoint following
+    Director    // Batched by AMonsterDirector, no per-monster tick
+};
+
+// One (AI mode, monster count) step of the scaling curve
+struct MAZERUNNER_API FMazeStressRow
+{
+    EMazeStressAIMode Mode = EMazeStressAIMode::Modern;
+    int32 Monsters = 0;
+    int32 MazeSize = 0;
+    int32 Hazards = 0;
+    int32 Frames = 0;
+
+    // Wall-clock frame time
+    float MeanFrameMs = 0.0f;
+    float P95FrameMs = 0.0f;
+
+    // Game-thread milliseconds per frame by subsystem
+    float AIMs = 0.0f;
+    float PathfindingMs = 0.0f;     // In-tick searches and the manager's request queue
+    float MovementMs = 0.0f;
+    float AudioMs = 0.0f;
+    float OverlapMs = 0.0f;         // Catch checks of the game mode
+    float OtherMs = 0.0f;           // The rest of the frame
+
+    // The measured subsystems per monster per frame: what one more monster costs
+    float MicrosPerMonster = 0.0f;
+};
+
+UCLASS()
+class MAZERUNNER_API AMazeStressTest : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMazeStressTest();
+
+    virtual void Tick(float DeltaTime) override;
+
+    // True when the command line asks for a stress session
+    static bool IsRequested();
+
+    // Reads -stressmonsters, -stressmaze and -stresshazards and starts; the game quits when done
+    void Configure(AMazeGameMode* InGameMode);
+
+    // Builds the maze and starts stepping through the monster counts, up to MaxMonsters
+    void Begin(AMazeGameMode* InGameMode, int32 MaxMonsters, int32 MazeSize, int32 NumHazards);
+
+    bool IsRunning() const { return bRunning; }
+
+    static const TCHAR* GetModeName(EMazeStressAIMode Mode);
+
+    static FString ToCsv(const TArray<FMazeStressRow>& Rows);
+
+    // Saved/Benchmarks/StressTest-<timestamp>.csv
+    static FString GetDefaultCsvPath();
+
+    static bool WriteCsv(const TArray<FMazeStressRow>& Rows, const FString& Path);
+
+    // ==================== SETTINGS ====================
+
+    // Monster counts of the curve, the ones above the session's maximum are skipped
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Test")
+    TArray<int32> MonsterCounts = { 1, 10, 25, 50, 100, 250, 500 };
+
+    // Seconds after spawning before sampling, so the first searches and spawn hitches are left out
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Test", meta = (ClampMin = "0.0"))
+    float WarmupSeconds = 3.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Test", meta = (ClampMin = "0.5"))
+    float SampleSeconds = 8.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Test", meta = (ClampMin = "0.5"))
+    float RelocateInterval = 4.0f;
+
+    // The report names the first step of each mode whose 95th percentile frame is over this
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stress Test", meta = (ClampMin = "1.0"))
+    float FrameBudgetMs = 16.67f;
+
+    static constexpr int32 MaxStressMonsters = 500;
+    static constexpr int32 MaxStressMazeSize = 100;
+
+private:
+    void StartStep();
+    void FinishStep();
+    void FinishSession();
+
+    void SpawnMonsters(int32 Count, EMazeStressAIMode Mode);
+    void ClearMonsters();
+
+    // Moves the player to a random cell at least MinCells of walking away
+    void RelocatePlayer();
+
+    // Random non-exit cell at least MinCells of walking from the player, nullptr when there is none
+    AMazeCell* PickCellAwayFromPlayer(int32 MinCells);
+
+    UPROPERTY()
+    AMazeGameMode* GameMode;
+
+    struct FStep
+    {
+        EMazeStressAIMode Mode;
+        int32 Monsters;
+    };
+    TArray<FStep> Steps;
+    int32 StepIndex;
+
+    int32 SessionMazeSize;
+    int32 SessionHazards;
+    bool bRunning;
+    bool bExitWhenDone;
+    bool bSampling;
+    float StepTimer;
+    float RelocateTimer;
+
+    // Sample window of the current step
+    TArray<float> FrameMilliseconds;
+    double LastFrameSeconds;
+    double PathQueueSeconds;
+    double DirectorStartSeconds;
+    double CatchCheckStartSeconds;
+
+    TArray<FMazeStressRow> Results;
+    TArray<int32> Distances;
+};
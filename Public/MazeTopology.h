@@ -0,0 +1,77 @@
+// MazeTopology.h
+// Compile-time grid topologies for TMazeGrid.
+// A topology is a set of constexpr direction tables, so each TMazeGrid instantiation resolves
+// neighbors with table loads and adds, no switch on the direction and no runtime dispatch.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Policy layout (every topology provides the same members):
+ *   NumDirections              walls per cell, bit N of a wall mask = direction N
+ *   bOffsetRows                odd rows are shifted half a cell (neighbor columns depend on the row)
+ *   RowDelta[Dir]              row step
+ *   ColDelta[Dir]              column step on even rows
+ *   OddRowColShift[Dir]        added to ColDelta on odd rows (all zero unless bOffsetRows)
+ *   OppositeDir[Dir]           direction pointing back
+ *   Distance(...)              admissible step-count heuristic between two cells
+ */
+
+// 4-neighbor square grid, directions match EMazeDirection (North=0, East=1, South=2, West=3)
+struct FMazeSquareTopology
+{
+    static constexpr int32 NumDirections = 4;
+    static constexpr bool bOffsetRows = false;
+
+    static constexpr int32 RowDelta[NumDirections] = { -1, 0, 1, 0 };
+    static constexpr int32 ColDelta[NumDirections] = { 0, 1, 0, -1 };
+    static constexpr int32 OddRowColShift[NumDirections] = { 0, 0, 0, 0 };
+    static constexpr int32 OppositeDir[NumDirections] = { 2, 3, 0, 1 };
+
+    static int32 Distance(int32 RowA, int32 ColA, int32 RowB, int32 ColB)
+    {
+        return FMath::Abs(RowA - RowB) + FMath::Abs(ColA - ColB);
+    }
+};
+
+// 8-neighbor square grid. The first four directions are the square ones so masks stay
+// compatible, then NE=4, SE=5, SW=6, NW=7. Diagonal steps cost one step like straight ones.
+struct FMazeOctileTopology
+{
+    static constexpr int32 NumDirections = 8;
+    static constexpr bool bOffsetRows = false;
+
+    static constexpr int32 RowDelta[NumDirections] = { -1, 0, 1, 0, -1, 1, 1, -1 };
+    static constexpr int32 ColDelta[NumDirections] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+    static constexpr int32 OddRowColShift[NumDirections] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    static constexpr int32 OppositeDir[NumDirections] = { 2, 3, 0, 1, 6, 7, 4, 5 };
+
+    static int32 Distance(int32 RowA, int32 ColA, int32 RowB, int32 ColB)
+    {
+        return FMath::Max(FMath::Abs(RowA - RowB), FMath::Abs(ColA - ColB));
+    }
+};
+
+// Pointy-top hex grid in odd-row offset layout (odd rows shifted half a cell east).
+// Directions go clockwise: NE=0, E=1, SE=2, SW=3, W=4, NW=5.
+struct FMazeHexTopology
+{
+    static constexpr int32 NumDirections = 6;
+    static constexpr bool bOffsetRows = true;
+
+    static constexpr int32 RowDelta[NumDirections] = { -1, 0, 1, 1, 0, -1 };
+    static constexpr int32 ColDelta[NumDirections] = { 0, 1, 0, -1, -1, -1 };
+    static constexpr int32 OddRowColShift[NumDirections] = { 1, 0, 1, 1, 0, 1 };
+    static constexpr int32 OppositeDir[NumDirections] = { 3, 4, 5, 0, 1, 2 };
+
+    // Offset -> axial coordinates, then the usual cube distance
+    static int32 Distance(int32 RowA, int32 ColA, int32 RowB, int32 ColB)
+    {
+        const int32 QA = ColA - (RowA - (RowA & 1)) / 2;
+        const int32 QB = ColB - (RowB - (RowB & 1)) / 2;
+        const int32 DQ = QA - QB;
+        const int32 DR = RowA - RowB;
+        return (FMath::Abs(DQ) + FMath::Abs(DR) + FMath::Abs(DQ + DR)) / 2;
+    }
+};
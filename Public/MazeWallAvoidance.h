@@ -0,0 +1,26 @@
+// MazeWallAvoidance.h
+// Wall proximity from the packed wall masks instead of physics traces.
+// The walls around a point are the edges of its cell and the edges leaving the cell's corners,
+// all known from the grid, so the push away from them is a handful of clamps and dot products.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMazeGrid;
+
+struct MAZERUNNER_API FMazeWallAvoidance
+{
+    // Push away from the walls closer than Radius to Location, in world units (cell (Row, Col)
+    // centered at (Row * CellSize, Col * CellSize)). Each wall pushes along the line from its
+    // closest point with weight 1 - Distance / Radius; walls behind Heading are ignored (pass a zero
+    // heading to count all of them). Returns the unit direction of the sum, zero when nothing is near.
+    // Radius is capped at half a cell: farther walls belong to the next cell's query.
+    static FVector2D ComputeRepulsion(const FMazeGrid& Grid, float CellSize, const FVector2D& Location,
+                                      float Radius, const FVector2D& Heading = FVector2D::ZeroVector);
+
+    // Keeps a point within Reach of the center of cell (Row, Col) on the walled sides and zeroes the
+    // velocity into them. Open sides let it through into the next cell, whose walls take over there.
+    static void ClampToCell(const FMazeGrid& Grid, float CellSize, int32 Row, int32 Col, float Reach,
+                            FVector2D& InOutLocation, FVector2D& InOutVelocity);
+};
@@ -4,19 +4,59 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Components/AudioComponent.h"
+#include "MazeDStarLite.h"
+#include "MazePathSmoother.h"
 #include "MonsterAI.generated.h"
 
+// How much work a monster does, picked from its walking distance to the player and whether it is on screen
+UENUM(BlueprintType)
+enum class EMonsterAILOD : uint8
+{
+    Full,       // Every frame: steering, character movement, footstep volume
+    Reduced,    // Every ReducedTickInterval: cell-to-cell moves, no character movement tick
+    Dormant     // Every DormantTickInterval: cell-to-cell moves, footsteps at minimum volume
+};
+
+// Game-thread cost of the monster's own tick per LOD tier, since the last reset
+struct FMonsterLODStats
+{
+    static constexpr int32 NumTiers = 3;
+    
+    int32 Ticks[NumTiers] = {};
+    double TickSeconds[NumTiers] = {};   // CPU time of the AI steps
+    double TierSeconds[NumTiers] = {};   // Game time spent in the tier
+};
+
+// Game-thread cost of the monster's own tick split by subsystem, since the last reset (stress mode)
+struct FMonsterTickBreakdown
+{
+    int32 Ticks = 0;
+    double AISeconds = 0.0;             // LOD, perception and replan decisions: the rest of the tick
+    double PathfindingSeconds = 0.0;    // Searches run inside the tick, queued ones are the manager's
+    double MovementSeconds = 0.0;       // Path following and steering input
+    double AudioSeconds = 0.0;          // Footstep volume
+};
+
 UCLASS()
 class MAZERUNNER_API AMonsterAI : public ACharacter
 {
     GENERATED_BODY()
     
 public:
-    AMonsterAI();
+    AMonsterAI(const FObjectInitializer& ObjectInitializer);
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     float MoveSpeed = 600.0f;
     
+    // Walk the computed path with the grid movement component instead of the character movement:
+    // no floor sweeps, step-ups or capsule collision, the wall grid keeps the monster in the corridor.
+    // Speed still comes from MaxWalkSpeed. Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    bool bUseKinematicMovement = false;
+    
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement")
+    class UMazeGridMovementComponent* GridMovement;
+    
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster AI")
     bool bStopWhenReachesPlayer = true;
     
@@ -37,9 +77,38 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
     float FootstepMaxVolume = 1.0f;  // Volume when close
 
+    // Replan only when the player changes cell, the walls change or the monster leaves its path
+    // (incremental D* Lite repair). Off = the old full replan every PathUpdateInterval.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bEventDrivenReplanning = true;
+    
+    // With mud or an active safe zone on the map, chase along the cheapest path instead of the
+    // shortest one. Costs are per cell entered, 1 = plain floor.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bUseTerrainCosts = true;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI", meta = (ClampMin = "1", ClampMax = "255", EditCondition = "bUseTerrainCosts"))
+    int32 MudPathCost = 3;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI", meta = (ClampMin = "1", ClampMax = "255", EditCondition = "bUseTerrainCosts"))
+    int32 SafeZonePathCost = 25;
+    
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
     float PathUpdateInterval = 1.0f;
     
+    // With other monsters on the player too, plan the next few steps around the cells they reserved
+    // (the maze manager's cooperative window), so they spread over parallel corridors instead of stacking
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bCooperativePathing = true;
+    
+    // Chase with the AI controller's MoveTo over the maze's grid navigation data instead of the
+    // hand-rolled path following (terrain costs and event-driven replanning do not apply)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    bool bUseNavigationMoveTo = false;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI", meta = (ClampMin = "0.0", EditCondition = "bUseNavigationMoveTo"))
+    float MoveToAcceptanceRadius = 100.0f;
+    
     // ==================== MODERN AI NAVIGATION ====================
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modern AI")
@@ -51,9 +120,87 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modern AI", meta = (ClampMin = "0.0", ClampMax = "1.0"))
     float SteeringUpdateInterval = 0.1f;
     
+    // Distance from a wall at which steering starts pushing away from it (capped at half a cell)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modern AI")
     float AvoidanceRadius = 200.0f;
     
+    // Steer straight at the farthest path cell in clear line of sight instead of every cell center.
+    // The lines are checked against the wall grid, so no obstacle traces are needed while on them.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modern AI")
+    bool bSmoothPath = true;
+    
+    // Distance kept between the monster's center and the wall faces on smoothed lines
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modern AI", meta = (ClampMin = "0.0", EditCondition = "bSmoothPath"))
+    float PathClearance = 200.0f;
+    
+    // ==================== PERCEPTION ====================
+    
+    // Chase only what the monster can see or hear (ranges on the maze manager) instead of always
+    // knowing where the player is. Out of contact it heads for where it last sensed the player, then
+    // searches the corridors around that cell.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception")
+    bool bUsePerception = true;
+    
+    // Walking distance (cells) from the last known cell that the search wanders
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "1", EditCondition = "bUsePerception"))
+    int32 SearchRadiusCells = 4;
+    
+    // Out of contact this long, the monster picks up the player's trail again (one fresh fix), so
+    // hiding cannot stall the round
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0.0", EditCondition = "bUsePerception"))
+    float LoseTrackTime = 8.0f;
+    
+    // Search where the player most likely went instead of wandering: monsters share a belief map on
+    // the maze manager, fix it when they sense the player and empty the cells they can see
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (EditCondition = "bUsePerception"))
+    bool bUseBeliefMap = true;
+    
+    // Lie in wait instead of searching: out of contact the monster holds the cell the player has to
+    // pass last on the way to the exit (AMazeManager::GetAmbushCell), and searches once there is none
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (EditCondition = "bUsePerception"))
+    bool bAmbushPlayer = false;
+    
+    UFUNCTION(BlueprintPure, Category = "Perception")
+    bool IsPlayerSensed() const { return bPlayerSensed; }
+    
+    // ==================== AI LEVEL OF DETAIL ====================
+    
+    // Tick far monsters less often and move them cell to cell instead of steering. Monsters on
+    // screen always get full detail, so the coarse moves are never seen.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+    bool bUseAILOD = true;
+    
+    // Walking distance to the player (cells) up to which the monster gets full detail
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0", EditCondition = "bUseAILOD"))
+    int32 FullDetailDistance = 6;
+    
+    // Walking distance up to which the monster stays in the reduced tier, dormant beyond
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0", EditCondition = "bUseAILOD"))
+    int32 ReducedDetailDistance = 15;
+    
+    // Extra cells needed before dropping to a lower tier, so a monster on a tier boundary does not flip every tick
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0", EditCondition = "bUseAILOD"))
+    int32 LODHysteresisCells = 1;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0", EditCondition = "bUseAILOD"))
+    float ReducedTickInterval = 0.1f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0", EditCondition = "bUseAILOD"))
+    float DormantTickInterval = 0.5f;
+    
+    // Rendered within this many seconds = on screen (full detail)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0", EditCondition = "bUseAILOD"))
+    float VisibilityGraceTime = 0.25f;
+    
+    UFUNCTION(BlueprintPure, Category = "AI LOD")
+    EMonsterAILOD GetAILOD() const { return CurrentLOD; }
+    
+    const FMonsterLODStats& GetLODStats() const { return LODStats; }
+    void ResetLODStats() { LODStats = FMonsterLODStats(); }
+    
+    const FMonsterTickBreakdown& GetTickBreakdown() const { return TickBreakdown; }
+    void ResetTickBreakdown() { TickBreakdown = FMonsterTickBreakdown(); }
+    
     // Functions
     UFUNCTION(BlueprintCallable, Category = "AI")
     void StartChasing(AActor* Target);
@@ -71,9 +218,27 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI")
     void Initialize();
     
+    // Set before BeginPlay (deferred spawn) to skip the actor search
+    void SetMazeManager(class AMazeManager* InMazeManager) { MazeManager = InMazeManager; }
+    
+    // Moved by an AMonsterDirector: no own tick, no character movement, no footstep loop
+    void SetDirectorControlled(bool bControlled);
+    bool IsDirectorControlled() const { return bDirectorControlled; }
+    
+    // Hands the AI to ClockOwner, which calls AdvanceSimulationClock at a fixed rate; the own tick
+    // then only feeds the last steering decision to the character movement. Null = step every tick.
+    // Random choices draw from the owner's Random stream (null = the global stream).
+    void SetSimulationClockOwner(AActor* ClockOwner, const FRandomStream* Random);
+    bool IsOnSimulationClock() const { return bOnSimulationClock; }
+    
+    // One fixed step of the owner's clock. Steps are collected up to the LOD tier's tick interval,
+    // so far monsters still think less often.
+    void AdvanceSimulationClock(float StepSeconds);
+    
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     
 private:
     // References
@@ -90,16 +255,77 @@ private:
     TArray<class AMazeCell*> CurrentPath;
     int32 CurrentWaypointIndex;
     float PathUpdateTimer;
+    
+    // String-pulled waypoints: ascending indices into CurrentPath
+    FMazePathSmoother PathSmoother;
+    TArray<int32> PathCorners;
+    TArray<int32> PathCellScratch;
+    
+    // Waypoints handed to GridMovement and the CurrentPath index of each
+    TArray<FVector> KinematicWaypoints;
+    TArray<int32> KinematicWaypointCells;
+    int32 KinematicFirstCell;
     bool bIsChasing;
+    bool bDirectorControlled;
+    
+    // Event-driven replanning state
+    FMazeDStarLite PathPlanner;
+    int32 LastPlayerCellIndex;
+    int32 LastMonsterCellIndex;
+    int32 LastPathWallVersion;
+    uint32 LastPathTerrainVersion;
+    int32 CooperativePlanStep;  // Reservation step the current path was planned at, INDEX_NONE = not cooperative
+    
+    // Perception state (cell indices into the maze manager's grid)
+    bool bPlayerSensed;
+    int32 LastKnownPlayerCellIndex;
+    int32 SearchCellIndex;
+    float TimeSincePlayerSensed;
+    
+    // Cells in sight of VisibleCellsSource, regathered when the monster changes cell or the walls change
+    TArray<int32> VisibleCells;
+    int32 VisibleCellsSource;
+    uint32 VisibleCellsWallVersion;
+    
+    // Level of detail
+    EMonsterAILOD CurrentLOD;
+    FMonsterLODStats LODStats;
+    FMonsterTickBreakdown TickBreakdown;
     
     // Modern AI state
     float SteeringUpdateTimer;
-    FVector LastPlayerPosition;
     FVector PlayerVelocity;
     
+    // Simulation clock state
+    bool bOnSimulationClock;
+    float SimulationClockTime;      // Steps collected towards the next AI step
+    const FRandomStream* SimulationRandom;  // Owned by the clock owner
+    FVector PendingMoveInput;       // Steering of the last AI step, applied every frame until the next
+    
     // Internal functions
+    
+    // LOD, perception, replanning and path following for DeltaTime of game time
+    void SimulateStep(float DeltaTime);
     void UpdatePathToPlayer();
+    void ApplyPath(const TArray<class AMazeCell*>& NewPath);
+    bool NeedsReplan();
+    void RebuildPathCorners();
+    int32 GetSteeringWaypointIndex() const;
     void MoveAlongPath(float DeltaTime);
+    void MoveAlongPathCoarse(float DeltaTime);
+    bool UsesKinematicMovement() const;
+    void SetKinematicMovementActive(bool bActive);
+    void SyncKinematicWaypoints();
+    void UpdateKinematicProgress();
+    void UpdatePerception(float DeltaTime);
+    void ResetPerception();
+    int32 PickSearchCell(int32 AroundIndex) const;
+    void ReportVisibleCells(int32 MonsterIndex);
+    class AMazeCell* GetChaseGoalCell() const;
+    void UpdateAILOD();
+    void SetAILOD(EMonsterAILOD NewLOD);
+    void UpdateFootstepVolume();
+    void UpdateNavigationMove();
     class AMazeCell* GetCurrentCell() const;
     class AMazeCell* GetPlayerCell() const;
     
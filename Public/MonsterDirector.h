@@ -0,0 +1,124 @@
+// MonsterDirector.h
+// Batched simulation for large monster counts (the level 5 horde).
+// The director owns the state of its monsters in parallel arrays and steps all of them in one pass
+// per frame: every monster walks down the player's shared distance field (no per-monster search),
+// decides and steers on worker threads, and only the resulting transforms go back to the actors.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MonsterDirector.generated.h"
+
+class AMonsterAI;
+class AMazeManager;
+struct FMazeGrid;
+class FMazeSimulationClock;
+
+UCLASS()
+class MAZERUNNER_API AMonsterDirector : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AMonsterDirector();
+
+    // Takes over a monster: its own tick and character movement stop, the director moves it.
+    // Destroyed monsters drop out on the next frame by themselves.
+    void AddMonster(AMonsterAI* Monster);
+    void RemoveMonster(AMonsterAI* Monster);
+    void RemoveAllMonsters();
+
+    void SetMazeManager(AMazeManager* InMazeManager) { MazeManager = InMazeManager; }
+
+    // Hands the stepping to ClockOwner, which calls SimulateStep at the clock's fixed rate; the own
+    // tick then only draws the monsters between the last two steps. Null = step every frame.
+    void SetSimulationClock(const FMazeSimulationClock* InClock, AActor* ClockOwner);
+
+    // Sync, decision, steering and integration of every monster, without touching the actors' transforms
+    void SimulateStep(float DeltaTime);
+
+    UFUNCTION(BlueprintPure, Category = "Monster Director")
+    int32 GetNumMonsters() const { return Monsters.Num(); }
+
+    // Game-thread time of the last batched step (sync and parallel step)
+    UFUNCTION(BlueprintPure, Category = "Monster Director")
+    float GetLastStepMilliseconds() const { return LastStepMilliseconds; }
+
+    // Game-thread time of every step and transform write-back so far
+    double GetTotalStepSeconds() const { return TotalStepSeconds; }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float MaxAcceleration = 2000.0f;
+
+    // Monsters start pushing off walls closer than this
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float WallAvoidanceRadius = 200.0f;
+
+    // How far a wall face can reach into a cell (walls are 150 thick and sit on either side of the edge)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float WallInset = 150.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float BodyRadius = 50.0f;
+
+    // Monsters closer than this to each other spread apart instead of stacking in the corridor
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float SeparationRadius = 150.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "0.0"))
+    float SeparationWeight = 0.8f;
+
+    // Monsters per worker task (ParallelFor runs on the game thread alone below this)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Monster Director", meta = (ClampMin = "1"))
+    int32 MinBatchSize = 16;
+
+protected:
+    virtual void Tick(float DeltaTime) override;
+
+private:
+    // Drops destroyed monsters and reads what gameplay may have changed on the actors
+    // (chasing, walk speed, teleports)
+    void SyncActors();
+
+    // Monsters per cell as linked lists through NextInCell, for the separation lookups
+    void BuildCellBuckets(const FMazeGrid& Grid, float CellSize);
+
+    // Decision, steering and integration of one monster. Reads the current state of every monster,
+    // writes only slot Index of the Next* arrays (safe to run in parallel).
+    void StepMonster(int32 Index, const FMazeGrid& Grid, float CellSize, const TArray<int32>& Distances,
+                     const FVector2D& PlayerPoint, float DeltaTime);
+
+    // Actors placed Alpha of the way from the previous step's positions to the current ones
+    void ApplyTransforms(float Alpha);
+    void RemoveMonsterAt(int32 Index);
+
+    UPROPERTY()
+    AMazeManager* MazeManager;
+
+    UPROPERTY()
+    TArray<AMonsterAI*> Monsters;
+
+    // Structure of arrays, slot i = Monsters[i]
+    TArray<FVector2D> Positions;
+    TArray<FVector2D> Velocities;
+    TArray<FVector2D> NextPositions;
+    TArray<FVector2D> NextVelocities;
+    TArray<FVector2D> PreviousPositions;    // Before the last step, the start of the interpolation
+    TArray<FVector2D> DrawnPositions;       // Where ApplyTransforms left the actors
+    TArray<float> Heights;
+    TArray<float> Yaws;
+    TArray<float> Speeds;
+    TArray<uint8> Chasing;
+    TArray<int32> Cells;
+
+    // Cell buckets: first monster per cell, next monster in the same cell, cells to clear next frame
+    TArray<int32> CellFirst;
+    TArray<int32> NextInCell;
+    TArray<int32> OccupiedCells;
+
+    float LastStepMilliseconds;
+    double TotalStepSeconds;
+
+    const FMazeSimulationClock* SimulationClock;
+};
@@ -17,6 +17,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:    
     // Components
@@ -37,6 +38,9 @@ public:
     UMaterialInterface* MuddyMaterial;  // Custom muddy material
     
 private:
+    // Manager whose terrain plane has this patch's cell flagged as mud
+    TWeakObjectPtr<class AMazeManager> TerrainManager;
+    
     // Overlap events
     UFUNCTION()
     void OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, 
@@ -18,6 +18,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:    
     virtual void Tick(float DeltaTime) override;
@@ -65,6 +66,10 @@ public:
 private:
     float PulseTimer;
     
+    // Manager whose terrain plane has this cell flagged while the zone is active
+    TWeakObjectPtr<class AMazeManager> TerrainManager;
+    void ClearTerrain();
+    
     UFUNCTION()
     void OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
                                UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
@@ -17,6 +17,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:    
     // Components
@@ -42,6 +43,9 @@ public:
     
     // Initialize with cell reference
     void Initialize(AMazeCell* Cell, float CellSize);
+    
+    // Counts down a sprung trap on the game mode's simulation clock, releasing it when the time is up
+    void SimulateStep(float StepSeconds);
 
 private:
     // Overlap events
@@ -56,5 +60,9 @@ private:
     void ShowCellWalls();
     void ReleaseTrap();
     
-    FTimerHandle ReleaseTimerHandle;
+    // Seconds until a sprung trap releases the player, 0 when not sprung
+    float ReleaseTimeRemaining = 0.0f;
+    
+    // Manager whose terrain plane has this trap's cell flagged
+    TWeakObjectPtr<class AMazeManager> TerrainManager;
 };